@@ -11,12 +11,27 @@ namespace mono
 inline constexpr const char* envMode      = "mono.envMode";      // choice: Retrigger, Legato
 inline constexpr const char* glideEnable  = "mono.glideEnable";  // bool
 inline constexpr const char* glideTimeMs  = "mono.glideTimeMs";  // float ms
+inline constexpr const char* voiceMode    = "mono.voiceMode";    // choice: Mono, Poly
+inline constexpr const char* polyVoices   = "mono.polyVoices";   // int 2..8
+inline constexpr const char* wtInterp     = "mono.wtInterp";     // choice: Linear, Cubic
 
 enum EnvMode
 {
     retrigger = 0,
     legato = 1
 };
+
+enum VoiceMode
+{
+    voiceMono = 0,
+    voicePoly = 1
+};
+
+enum WtInterp
+{
+    wtLinear = 0,
+    wtCubic = 1
+};
 }
 
 namespace osc
@@ -27,6 +42,10 @@ inline constexpr const char* coarse = "coarse"; // int -24..24
 inline constexpr const char* fine   = "fine";   // float cents -100..100
 inline constexpr const char* phase  = "phase";  // float 0..1
 inline constexpr const char* detune = "detune"; // float 0..1 (unstable drift)
+inline constexpr const char* unison        = "unison";        // int 1..16 voices
+inline constexpr const char* unisonDetune  = "unisonDetune";  // float 0..1 (outer voices +-50 cents)
+inline constexpr const char* unisonSpread  = "unisonSpread";  // float 0..1 (start phase spread)
+inline constexpr const char* unisonBlend   = "unisonBlend";   // float 0..1 (side voice level)
 
 enum Wave
 {
@@ -44,6 +63,10 @@ inline constexpr const char* coarse = "osc1.coarse";
 inline constexpr const char* fine   = "osc1.fine";
 inline constexpr const char* phase  = "osc1.phase";
 inline constexpr const char* detune = "osc1.detune";
+inline constexpr const char* unison       = "osc1.unison";
+inline constexpr const char* unisonDetune = "osc1.unisonDetune";
+inline constexpr const char* unisonSpread = "osc1.unisonSpread";
+inline constexpr const char* unisonBlend  = "osc1.unisonBlend";
 }
 
 namespace osc2
@@ -54,6 +77,10 @@ inline constexpr const char* coarse = "osc2.coarse";
 inline constexpr const char* fine   = "osc2.fine";
 inline constexpr const char* phase  = "osc2.phase";
 inline constexpr const char* detune = "osc2.detune";
+inline constexpr const char* unison       = "osc2.unison";
+inline constexpr const char* unisonDetune = "osc2.unisonDetune";
+inline constexpr const char* unisonSpread = "osc2.unisonSpread";
+inline constexpr const char* unisonBlend  = "osc2.unisonBlend";
 inline constexpr const char* sync   = "osc2.sync"; // bool
 }
 
@@ -65,6 +92,10 @@ inline constexpr const char* coarse = "osc3.coarse";
 inline constexpr const char* fine   = "osc3.fine";
 inline constexpr const char* phase  = "osc3.phase";
 inline constexpr const char* detune = "osc3.detune";
+inline constexpr const char* unison       = "osc3.unison";
+inline constexpr const char* unisonDetune = "osc3.unisonDetune";
+inline constexpr const char* unisonSpread = "osc3.unisonSpread";
+inline constexpr const char* unisonBlend  = "osc3.unisonBlend";
 }
 
 namespace noise
@@ -184,13 +215,25 @@ enum ModMode
 };
 
 // Oversampling for the Destroy chain (quality/aliasing control).
-inline constexpr const char* oversample = "destroy.oversample"; // choice: Off, 2x, 4x
+inline constexpr const char* oversample = "destroy.oversample"; // choice: Off, 2x, 4x, Auto
 
 enum OversampleMode
 {
-    osOff = 0,
-    os2x  = 1,
-    os4x  = 2
+    osOff  = 0,
+    os2x   = 1,
+    os4x   = 2,
+    osAuto = 3 // 1x..8x per block from oscillator pitch and drive
+};
+
+// Antiderivative anti-aliasing per stage (works with or without oversampling).
+inline constexpr const char* foldAntiAlias = "destroy.foldAntiAlias"; // choice: Off, ADAA 1, ADAA 2
+inline constexpr const char* clipAntiAlias = "destroy.clipAntiAlias"; // choice: Off, ADAA 1, ADAA 2
+
+enum AntiAlias
+{
+    aaOff = 0,
+    aaFirstOrder = 1,
+    aaSecondOrder = 2
 };
 
 // Bitcrusher / SRR
@@ -217,6 +260,7 @@ inline constexpr const char* enable    = "shaper.enable";    // bool
 inline constexpr const char* placement = "shaper.placement"; // choice: Pre Destroy / Post Destroy
 inline constexpr const char* driveDb   = "shaper.driveDb";   // -24..24 dB
 inline constexpr const char* mix       = "shaper.mix";       // 0..1
+inline constexpr const char* antiAlias = "shaper.antiAlias"; // choice: Off, ADAA 1, ADAA 2 (destroy::AntiAlias)
 
 // Fixed curve control points (x is fixed/evenly distributed; y is automatable).
 inline constexpr int numPoints = 7;
@@ -278,6 +322,28 @@ inline constexpr const char* slot8Src   = "mod.slot8.src";
 inline constexpr const char* slot8Dst   = "mod.slot8.dst";
 inline constexpr const char* slot8Depth = "mod.slot8.depth";
 
+inline constexpr const char* controlRate   = "mod.controlRate";   // choice (matrix evaluation interval)
+inline constexpr const char* audioRateFast = "mod.audioRateFast"; // bool (osc levels + filter cutoff/reso stay audio-rate)
+
+enum ControlRate
+{
+    rateAudio = 0,
+    rate8 = 1,
+    rate16 = 2,
+    rate32 = 3
+};
+
+inline int controlRateInterval (int rateIndex) noexcept
+{
+    switch (rateIndex)
+    {
+        case rate8:  return 8;
+        case rate16: return 16;
+        case rate32: return 32;
+        default:     return 1;
+    }
+}
+
 enum Source
 {
     srcOff = 0,
@@ -292,7 +358,10 @@ enum Source
     srcFilterEnv = 9,
     srcAmpEnv = 10,
     srcRandom = 11,
-    srcMseg = 12
+    srcMseg = 12,
+    srcDrift = 13,
+
+    srcLast = srcDrift
 };
 
 enum Dest
@@ -525,6 +594,7 @@ inline constexpr const char* lowCutHz    = "tone.lowCutHz";    // float Hz
 inline constexpr const char* highCutHz   = "tone.highCutHz";   // float Hz
 inline constexpr const char* lowCutSlope = "tone.lowCutSlope"; // choice: 12/24/36/48 dB/oct
 inline constexpr const char* highCutSlope = "tone.highCutSlope";
+inline constexpr const char* phaseMode   = "tone.phaseMode";   // choice: Minimum, Linear (static response, adds latency)
 
 enum PeakType
 {
@@ -543,6 +613,12 @@ enum CutSlope
     slope48 = 3
 };
 
+enum PhaseMode
+{
+    phaseMinimum = 0,
+    phaseLinear = 1
+};
+
 // Multiple peak nodes (Serum-like EQ editing). Keep IDs stable once shipped.
 // NOTE: Peaks beyond #3 default to disabled. UI can enable/disable nodes.
 inline constexpr int maxPeaks = 8;
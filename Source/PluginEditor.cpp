@@ -1035,6 +1035,7 @@ static int getNumFactoryPresets() noexcept
 IndustrialEnergySynthAudioProcessorEditor::IndustrialEnergySynthAudioProcessorEditor (IndustrialEnergySynthAudioProcessor& p)
     : AudioProcessorEditor (&p), audioProcessor (p)
 {
+    audioProcessor.setUiEditorAttached (true);
     setLookAndFeel (&lnf);
     toneEqWindowContent.setLookAndFeel (&lnf);
     modLastSlotByDest.fill (-1);
@@ -1647,6 +1648,18 @@ IndustrialEnergySynthAudioProcessorEditor::IndustrialEnergySynthAudioProcessorEd
     envMode.getCombo().addItem ("Legato", 2);
     envModeAttachment = std::make_unique<APVTS::ComboBoxAttachment> (audioProcessor.getAPVTS(), params::mono::envMode, envMode.getCombo());
 
+    addAndMakeVisible (voiceMode);
+    voiceMode.setLayout (ies::ui::ComboWithLabel::Layout::labelTop);
+    voiceMode.getCombo().addItem ("Mono", 1);
+    voiceMode.getCombo().addItem ("Poly", 2);
+    voiceModeAttachment = std::make_unique<APVTS::ComboBoxAttachment> (audioProcessor.getAPVTS(), params::mono::voiceMode, voiceMode.getCombo());
+
+    addAndMakeVisible (wtInterp);
+    wtInterp.setLayout (ies::ui::ComboWithLabel::Layout::labelTop);
+    wtInterp.getCombo().addItem ("Linear", 1);
+    wtInterp.getCombo().addItem ("Cubic", 2);
+    wtInterpAttachment = std::make_unique<APVTS::ComboBoxAttachment> (audioProcessor.getAPVTS(), params::mono::wtInterp, wtInterp.getCombo());
+
     glideEnable.setButtonText ("Glide");
     addAndMakeVisible (glideEnable);
     glideEnableAttachment = std::make_unique<APVTS::ButtonAttachment> (audioProcessor.getAPVTS(), params::mono::glideEnable, glideEnable);
@@ -1665,6 +1678,13 @@ IndustrialEnergySynthAudioProcessorEditor::IndustrialEnergySynthAudioProcessorEd
     };
     setupSliderDoubleClickDefault (glideTime.getSlider(), params::mono::glideTimeMs);
 
+    addAndMakeVisible (polyVoices);
+    polyVoicesAttachment = std::make_unique<APVTS::SliderAttachment> (audioProcessor.getAPVTS(), params::mono::polyVoices, polyVoices.getSlider());
+    polyVoices.getSlider().setSliderStyle (juce::Slider::LinearHorizontal);
+    polyVoices.getSlider().setTextBoxStyle (juce::Slider::TextBoxRight, false, 78, 18);
+    polyVoices.getSlider().setNumDecimalPlacesToDisplay (0);
+    setupSliderDoubleClickDefault (polyVoices.getSlider(), params::mono::polyVoices);
+
     addAndMakeVisible (outGain);
     outGainAttachment = std::make_unique<APVTS::SliderAttachment> (audioProcessor.getAPVTS(), params::out::gainDb, outGain.getSlider());
     outGain.getSlider().setSliderStyle (juce::Slider::LinearHorizontal);
@@ -1745,6 +1765,29 @@ IndustrialEnergySynthAudioProcessorEditor::IndustrialEnergySynthAudioProcessorEd
     osc1Detune.getSlider().valueFromTextFunction = osc1Level.getSlider().valueFromTextFunction;
     setupSliderDoubleClickDefault (osc1Detune.getSlider(), params::osc1::detune);
 
+    addAndMakeVisible (osc1Unison);
+    osc1Unison.getSlider().setNumDecimalPlacesToDisplay (0);
+    osc1UnisonAttachment = std::make_unique<APVTS::SliderAttachment> (audioProcessor.getAPVTS(), params::osc1::unison, osc1Unison.getSlider());
+    setupSliderDoubleClickDefault (osc1Unison.getSlider(), params::osc1::unison);
+
+    addAndMakeVisible (osc1UnisonDetune);
+    osc1UnisonDetuneAttachment = std::make_unique<APVTS::SliderAttachment> (audioProcessor.getAPVTS(), params::osc1::unisonDetune, osc1UnisonDetune.getSlider());
+    osc1UnisonDetune.getSlider().textFromValueFunction = osc1Level.getSlider().textFromValueFunction;
+    osc1UnisonDetune.getSlider().valueFromTextFunction = osc1Level.getSlider().valueFromTextFunction;
+    setupSliderDoubleClickDefault (osc1UnisonDetune.getSlider(), params::osc1::unisonDetune);
+
+    addAndMakeVisible (osc1UnisonSpread);
+    osc1UnisonSpreadAttachment = std::make_unique<APVTS::SliderAttachment> (audioProcessor.getAPVTS(), params::osc1::unisonSpread, osc1UnisonSpread.getSlider());
+    osc1UnisonSpread.getSlider().textFromValueFunction = osc1Level.getSlider().textFromValueFunction;
+    osc1UnisonSpread.getSlider().valueFromTextFunction = osc1Level.getSlider().valueFromTextFunction;
+    setupSliderDoubleClickDefault (osc1UnisonSpread.getSlider(), params::osc1::unisonSpread);
+
+    addAndMakeVisible (osc1UnisonBlend);
+    osc1UnisonBlendAttachment = std::make_unique<APVTS::SliderAttachment> (audioProcessor.getAPVTS(), params::osc1::unisonBlend, osc1UnisonBlend.getSlider());
+    osc1UnisonBlend.getSlider().textFromValueFunction = osc1Level.getSlider().textFromValueFunction;
+    osc1UnisonBlend.getSlider().valueFromTextFunction = osc1Level.getSlider().valueFromTextFunction;
+    setupSliderDoubleClickDefault (osc1UnisonBlend.getSlider(), params::osc1::unisonBlend);
+
     // --- Osc 2 ---
     osc2Group.setText ("Osc 2");
     addAndMakeVisible (osc2Group);
@@ -1798,6 +1841,29 @@ IndustrialEnergySynthAudioProcessorEditor::IndustrialEnergySynthAudioProcessorEd
     osc2Detune.getSlider().valueFromTextFunction = osc1Detune.getSlider().valueFromTextFunction;
     setupSliderDoubleClickDefault (osc2Detune.getSlider(), params::osc2::detune);
 
+    addAndMakeVisible (osc2Unison);
+    osc2Unison.getSlider().setNumDecimalPlacesToDisplay (0);
+    osc2UnisonAttachment = std::make_unique<APVTS::SliderAttachment> (audioProcessor.getAPVTS(), params::osc2::unison, osc2Unison.getSlider());
+    setupSliderDoubleClickDefault (osc2Unison.getSlider(), params::osc2::unison);
+
+    addAndMakeVisible (osc2UnisonDetune);
+    osc2UnisonDetuneAttachment = std::make_unique<APVTS::SliderAttachment> (audioProcessor.getAPVTS(), params::osc2::unisonDetune, osc2UnisonDetune.getSlider());
+    osc2UnisonDetune.getSlider().textFromValueFunction = osc1UnisonDetune.getSlider().textFromValueFunction;
+    osc2UnisonDetune.getSlider().valueFromTextFunction = osc1UnisonDetune.getSlider().valueFromTextFunction;
+    setupSliderDoubleClickDefault (osc2UnisonDetune.getSlider(), params::osc2::unisonDetune);
+
+    addAndMakeVisible (osc2UnisonSpread);
+    osc2UnisonSpreadAttachment = std::make_unique<APVTS::SliderAttachment> (audioProcessor.getAPVTS(), params::osc2::unisonSpread, osc2UnisonSpread.getSlider());
+    osc2UnisonSpread.getSlider().textFromValueFunction = osc1UnisonSpread.getSlider().textFromValueFunction;
+    osc2UnisonSpread.getSlider().valueFromTextFunction = osc1UnisonSpread.getSlider().valueFromTextFunction;
+    setupSliderDoubleClickDefault (osc2UnisonSpread.getSlider(), params::osc2::unisonSpread);
+
+    addAndMakeVisible (osc2UnisonBlend);
+    osc2UnisonBlendAttachment = std::make_unique<APVTS::SliderAttachment> (audioProcessor.getAPVTS(), params::osc2::unisonBlend, osc2UnisonBlend.getSlider());
+    osc2UnisonBlend.getSlider().textFromValueFunction = osc1UnisonBlend.getSlider().textFromValueFunction;
+    osc2UnisonBlend.getSlider().valueFromTextFunction = osc1UnisonBlend.getSlider().valueFromTextFunction;
+    setupSliderDoubleClickDefault (osc2UnisonBlend.getSlider(), params::osc2::unisonBlend);
+
     osc2Sync.setButtonText ("Sync");
     addAndMakeVisible (osc2Sync);
     osc2SyncAttachment = std::make_unique<APVTS::ButtonAttachment> (audioProcessor.getAPVTS(), params::osc2::sync, osc2Sync);
@@ -1855,6 +1921,29 @@ IndustrialEnergySynthAudioProcessorEditor::IndustrialEnergySynthAudioProcessorEd
     osc3Detune.getSlider().valueFromTextFunction = osc1Detune.getSlider().valueFromTextFunction;
     setupSliderDoubleClickDefault (osc3Detune.getSlider(), params::osc3::detune);
 
+    addAndMakeVisible (osc3Unison);
+    osc3Unison.getSlider().setNumDecimalPlacesToDisplay (0);
+    osc3UnisonAttachment = std::make_unique<APVTS::SliderAttachment> (audioProcessor.getAPVTS(), params::osc3::unison, osc3Unison.getSlider());
+    setupSliderDoubleClickDefault (osc3Unison.getSlider(), params::osc3::unison);
+
+    addAndMakeVisible (osc3UnisonDetune);
+    osc3UnisonDetuneAttachment = std::make_unique<APVTS::SliderAttachment> (audioProcessor.getAPVTS(), params::osc3::unisonDetune, osc3UnisonDetune.getSlider());
+    osc3UnisonDetune.getSlider().textFromValueFunction = osc1UnisonDetune.getSlider().textFromValueFunction;
+    osc3UnisonDetune.getSlider().valueFromTextFunction = osc1UnisonDetune.getSlider().valueFromTextFunction;
+    setupSliderDoubleClickDefault (osc3UnisonDetune.getSlider(), params::osc3::unisonDetune);
+
+    addAndMakeVisible (osc3UnisonSpread);
+    osc3UnisonSpreadAttachment = std::make_unique<APVTS::SliderAttachment> (audioProcessor.getAPVTS(), params::osc3::unisonSpread, osc3UnisonSpread.getSlider());
+    osc3UnisonSpread.getSlider().textFromValueFunction = osc1UnisonSpread.getSlider().textFromValueFunction;
+    osc3UnisonSpread.getSlider().valueFromTextFunction = osc1UnisonSpread.getSlider().valueFromTextFunction;
+    setupSliderDoubleClickDefault (osc3UnisonSpread.getSlider(), params::osc3::unisonSpread);
+
+    addAndMakeVisible (osc3UnisonBlend);
+    osc3UnisonBlendAttachment = std::make_unique<APVTS::SliderAttachment> (audioProcessor.getAPVTS(), params::osc3::unisonBlend, osc3UnisonBlend.getSlider());
+    osc3UnisonBlend.getSlider().textFromValueFunction = osc1UnisonBlend.getSlider().textFromValueFunction;
+    osc3UnisonBlend.getSlider().valueFromTextFunction = osc1UnisonBlend.getSlider().valueFromTextFunction;
+    setupSliderDoubleClickDefault (osc3UnisonBlend.getSlider(), params::osc3::unisonBlend);
+
     // --- Osc wave previews (templates + draw) ---
     auto hookWaveUi = [this] (ies::ui::ComboWithLabel& wave,
                               ies::ui::WavePreview& preview,
@@ -1880,29 +1969,15 @@ IndustrialEnergySynthAudioProcessorEditor::IndustrialEnergySynthAudioProcessorEd
             const bool draw = (idx == 13);
             preview.setEditable (draw);
 
-            if (const auto* wt = audioProcessor.getWavetableForUi (oscIndex, idx))
+            if (draw)
             {
-                if (draw)
-                {
-                    std::array<float, (size_t) ies::ui::WavePreview::drawPoints> pts {};
-                    const auto* table = wt->mip[0].data();
-                    for (int i = 0; i < ies::ui::WavePreview::drawPoints; ++i)
-                    {
-                        const float ph = (float) i / (float) (ies::ui::WavePreview::drawPoints - 1);
-                        const float tidx = ph * (float) ies::dsp::WavetableSet::tableSize;
-                        const int i0 = juce::jlimit (0, ies::dsp::WavetableSet::tableSize - 1, (int) std::floor (tidx));
-                        const int i1 = (i0 + 1) % ies::dsp::WavetableSet::tableSize;
-                        const float frac = tidx - (float) i0;
-                        const float a = table[(size_t) i0];
-                        const float b = table[(size_t) i1];
-                        pts[(size_t) i] = a + frac * (b - a);
-                    }
-                    preview.setDrawPoints (pts.data(), (int) pts.size());
-                }
-                else
-                {
-                    preview.setDisplayFromTable (wt->mip[0].data(), ies::dsp::WavetableSet::tableSize);
-                }
+                std::array<float, (size_t) ies::ui::WavePreview::drawPoints> pts {};
+                audioProcessor.getCustomWavePointsForUi (oscIndex, pts.data(), (int) pts.size());
+                preview.setDrawPoints (pts.data(), (int) pts.size());
+            }
+            else if (const auto* wt = audioProcessor.getWavetableForUi (oscIndex, idx))
+            {
+                preview.setDisplayFromTable (wt->level (0), ies::dsp::WavetableSet::tableSize);
             }
             else
             {
@@ -1948,8 +2023,23 @@ IndustrialEnergySynthAudioProcessorEditor::IndustrialEnergySynthAudioProcessorEd
     destroyOversample.getCombo().addItem ("Off", 1);
     destroyOversample.getCombo().addItem ("2x", 2);
     destroyOversample.getCombo().addItem ("4x", 3);
+    destroyOversample.getCombo().addItem ("Auto", 4);
     destroyOversampleAttachment = std::make_unique<APVTS::ComboBoxAttachment> (audioProcessor.getAPVTS(), params::destroy::oversample, destroyOversample.getCombo());
 
+    addAndMakeVisible (foldAntiAlias);
+    foldAntiAlias.setLayout (ies::ui::ComboWithLabel::Layout::labelTop);
+    foldAntiAlias.getCombo().addItem ("Off", 1);
+    foldAntiAlias.getCombo().addItem ("ADAA 1", 2);
+    foldAntiAlias.getCombo().addItem ("ADAA 2", 3);
+    foldAntiAliasAttachment = std::make_unique<APVTS::ComboBoxAttachment> (audioProcessor.getAPVTS(), params::destroy::foldAntiAlias, foldAntiAlias.getCombo());
+
+    addAndMakeVisible (clipAntiAlias);
+    clipAntiAlias.setLayout (ies::ui::ComboWithLabel::Layout::labelTop);
+    clipAntiAlias.getCombo().addItem ("Off", 1);
+    clipAntiAlias.getCombo().addItem ("ADAA 1", 2);
+    clipAntiAlias.getCombo().addItem ("ADAA 2", 3);
+    clipAntiAliasAttachment = std::make_unique<APVTS::ComboBoxAttachment> (audioProcessor.getAPVTS(), params::destroy::clipAntiAlias, clipAntiAlias.getCombo());
+
     foldPanel.setText ("Fold");
     addAndMakeVisible (foldPanel);
     clipPanel.setText ("Clip");
@@ -2116,6 +2206,15 @@ IndustrialEnergySynthAudioProcessorEditor::IndustrialEnergySynthAudioProcessorEd
                                                                               params::shaper::placement,
                                                                               shaperPlacement.getCombo());
 
+    addAndMakeVisible (shaperAntiAlias);
+    shaperAntiAlias.setLayout (ies::ui::ComboWithLabel::Layout::labelTop);
+    shaperAntiAlias.getCombo().addItem ("Off", 1);
+    shaperAntiAlias.getCombo().addItem ("ADAA 1", 2);
+    shaperAntiAlias.getCombo().addItem ("ADAA 2", 3);
+    shaperAntiAliasAttachment = std::make_unique<APVTS::ComboBoxAttachment> (audioProcessor.getAPVTS(),
+                                                                              params::shaper::antiAlias,
+                                                                              shaperAntiAlias.getCombo());
+
     toneEqOpenButton.setButtonText ("EQ");
     toneEqOpenButton.onClick = [this] { openToneEqWindow(); };
     addAndMakeVisible (toneEqOpenButton);
@@ -2356,6 +2455,7 @@ IndustrialEnergySynthAudioProcessorEditor::IndustrialEnergySynthAudioProcessorEd
         src.addItem ("Amp Env", 11);
         src.addItem ("Random", 12);
         src.addItem ("MSEG", 13);
+        src.addItem ("Drift", 14);
         addAndMakeVisible (src);
         modSlotSrcAttachment[(size_t) i] = std::make_unique<APVTS::ComboBoxAttachment> (audioProcessor.getAPVTS(), kModSlotSrcIds[i], src);
 
@@ -2436,7 +2536,7 @@ IndustrialEnergySynthAudioProcessorEditor::IndustrialEnergySynthAudioProcessorEd
                                                                                                                      (int) params::mod::dstLast,
                                                                                                                      modSlotDst[(size_t) s].getSelectedItemIndex());
                                                                   const auto srcNow = (params::mod::Source) juce::jlimit ((int) params::mod::srcOff,
-                                                                                                                          (int) params::mod::srcMseg,
+                                                                                                                          (int) params::mod::srcLast,
                                                                                                                           modSlotSrc[(size_t) s].getSelectedItemIndex());
                                                                   if (dNow == wantDst && srcNow != params::mod::srcOff)
                                                                       return s;
@@ -2450,7 +2550,7 @@ IndustrialEnergySynthAudioProcessorEditor::IndustrialEnergySynthAudioProcessorEd
                                                                                                                  (int) params::mod::dstLast,
                                                                                                                  modSlotDst[(size_t) i].getSelectedItemIndex());
                                                               const auto srcNow = (params::mod::Source) juce::jlimit ((int) params::mod::srcOff,
-                                                                                                                      (int) params::mod::srcMseg,
+                                                                                                                      (int) params::mod::srcLast,
                                                                                                                       modSlotSrc[(size_t) i].getSelectedItemIndex());
                                                               if (dNow == wantDst && srcNow != params::mod::srcOff)
                                                                   return i;
@@ -3557,6 +3657,14 @@ IndustrialEnergySynthAudioProcessorEditor::IndustrialEnergySynthAudioProcessorEd
                                                                                params::tone::highCutSlope,
                                                                                toneHighCutSlope.getCombo());
 
+    toneEqWindowContent.addAndMakeVisible (tonePhaseMode);
+    tonePhaseMode.setLayout (ies::ui::ComboWithLabel::Layout::labelTop);
+    tonePhaseMode.getCombo().addItem ("Minimum", 1);
+    tonePhaseMode.getCombo().addItem ("Linear", 2);
+    tonePhaseModeAttachment = std::make_unique<APVTS::ComboBoxAttachment> (audioProcessor.getAPVTS(),
+                                                                            params::tone::phaseMode,
+                                                                            tonePhaseMode.getCombo());
+
     toneEqWindowContent.addAndMakeVisible (toneDynBand);
     toneDynBand.setLayout (ies::ui::ComboWithLabel::Layout::labelTop);
     for (int i = 0; i < 8; ++i)
@@ -3784,6 +3892,8 @@ IndustrialEnergySynthAudioProcessorEditor::IndustrialEnergySynthAudioProcessorEd
     setGroupAccent (modNoteSync, cDestroy);
     setGroupAccent (destroyPitchLockEnable, cDestroy);
     setGroupAccent (destroyPitchLockMode, cDestroy);
+    setGroupAccent (foldAntiAlias, cDestroy);
+    setGroupAccent (clipAntiAlias, cDestroy);
     setGroupAccent (shaperEnable, cShaper);
     setGroupAccent (toneEqOpenButton, cTone);
     setGroupAccent (filterKeyTrack, cFilter);
@@ -3816,6 +3926,7 @@ IndustrialEnergySynthAudioProcessorEditor::IndustrialEnergySynthAudioProcessorEd
     setGroupAccent (toneEnable, cTone);
     setGroupAccent (toneLowCutSlope, cTone);
     setGroupAccent (toneHighCutSlope, cTone);
+    setGroupAccent (tonePhaseMode, cTone);
     setGroupAccent (toneDynBand, cTone);
     setGroupAccent (toneDynEnable, cTone);
     setGroupAccent (toneDynRange, cTone);
@@ -3922,6 +4033,7 @@ IndustrialEnergySynthAudioProcessorEditor::IndustrialEnergySynthAudioProcessorEd
     setGroupAccent (modPanel, cDestroy);
     setGroupAccent (crushPanel, cDestroy);
     setGroupAccent (shaperPlacement, cShaper);
+    setGroupAccent (shaperAntiAlias, cShaper);
 
     auto setSliderAccent = [] (juce::Slider& s, juce::Colour col)
     {
@@ -3930,16 +4042,19 @@ IndustrialEnergySynthAudioProcessorEditor::IndustrialEnergySynthAudioProcessorEd
         s.setColour (juce::Slider::thumbColourId, col);
     };
 
-    for (auto* s : { &glideTime.getSlider() })
+    for (auto* s : { &glideTime.getSlider(), &polyVoices.getSlider() })
         setSliderAccent (*s, cMono);
 
-    for (auto* s : { &osc1Level.getSlider(), &osc1Coarse.getSlider(), &osc1Fine.getSlider(), &osc1Phase.getSlider(), &osc1Detune.getSlider() })
+    for (auto* s : { &osc1Level.getSlider(), &osc1Coarse.getSlider(), &osc1Fine.getSlider(), &osc1Phase.getSlider(), &osc1Detune.getSlider(),
+                     &osc1Unison.getSlider(), &osc1UnisonDetune.getSlider(), &osc1UnisonSpread.getSlider(), &osc1UnisonBlend.getSlider() })
         setSliderAccent (*s, cOsc1);
 
-    for (auto* s : { &osc2Level.getSlider(), &osc2Coarse.getSlider(), &osc2Fine.getSlider(), &osc2Phase.getSlider(), &osc2Detune.getSlider() })
+    for (auto* s : { &osc2Level.getSlider(), &osc2Coarse.getSlider(), &osc2Fine.getSlider(), &osc2Phase.getSlider(), &osc2Detune.getSlider(),
+                     &osc2Unison.getSlider(), &osc2UnisonDetune.getSlider(), &osc2UnisonSpread.getSlider(), &osc2UnisonBlend.getSlider() })
         setSliderAccent (*s, cOsc2);
 
-    for (auto* s : { &osc3Level.getSlider(), &osc3Coarse.getSlider(), &osc3Fine.getSlider(), &osc3Phase.getSlider(), &osc3Detune.getSlider() })
+    for (auto* s : { &osc3Level.getSlider(), &osc3Coarse.getSlider(), &osc3Fine.getSlider(), &osc3Phase.getSlider(), &osc3Detune.getSlider(),
+                     &osc3Unison.getSlider(), &osc3UnisonDetune.getSlider(), &osc3UnisonSpread.getSlider(), &osc3UnisonBlend.getSlider() })
         setSliderAccent (*s, cOsc3);
 
     for (auto* s : { &noiseLevel.getSlider(), &noiseColor.getSlider() })
@@ -4039,10 +4154,13 @@ IndustrialEnergySynthAudioProcessorEditor::IndustrialEnergySynthAudioProcessorEd
 
     // Force text-box refresh after custom text formatting is attached.
     auto refreshSliderText = [] (juce::Slider& s) { s.updateText(); };
-    for (auto* s : { &glideTime.getSlider(), &outGain.getSlider(),
+    for (auto* s : { &glideTime.getSlider(), &polyVoices.getSlider(), &outGain.getSlider(),
                      &osc1Level.getSlider(), &osc1Coarse.getSlider(), &osc1Fine.getSlider(), &osc1Phase.getSlider(), &osc1Detune.getSlider(),
+                     &osc1Unison.getSlider(), &osc1UnisonDetune.getSlider(), &osc1UnisonSpread.getSlider(), &osc1UnisonBlend.getSlider(),
                      &osc2Level.getSlider(), &osc2Coarse.getSlider(), &osc2Fine.getSlider(), &osc2Phase.getSlider(), &osc2Detune.getSlider(),
+                     &osc2Unison.getSlider(), &osc2UnisonDetune.getSlider(), &osc2UnisonSpread.getSlider(), &osc2UnisonBlend.getSlider(),
                      &osc3Level.getSlider(), &osc3Coarse.getSlider(), &osc3Fine.getSlider(), &osc3Phase.getSlider(), &osc3Detune.getSlider(),
+                     &osc3Unison.getSlider(), &osc3UnisonDetune.getSlider(), &osc3UnisonSpread.getSlider(), &osc3UnisonBlend.getSlider(),
                      &noiseLevel.getSlider(), &noiseColor.getSlider(),
                      &foldDrive.getSlider(), &foldAmount.getSlider(), &foldMix.getSlider(),
                      &clipDrive.getSlider(), &clipAmount.getSlider(), &clipMix.getSlider(),
@@ -4094,6 +4212,7 @@ IndustrialEnergySynthAudioProcessorEditor::IndustrialEnergySynthAudioProcessorEd
 
 IndustrialEnergySynthAudioProcessorEditor::~IndustrialEnergySynthAudioProcessorEditor()
 {
+    audioProcessor.setUiEditorAttached (false);
     if (futureHubWindow != nullptr)
     {
         futureHubWindow->setVisible (false);
@@ -4557,7 +4676,15 @@ void IndustrialEnergySynthAudioProcessorEditor::resized()
     // Mono group internal
     {
         auto gr = monoGroup.getBounds().reduced (8, 22);
-        envMode.setBounds (gr.removeFromTop (34));
+        auto modeRow = gr.removeFromTop (34);
+        const int modeW = (modeRow.getWidth() - 12) / 3;
+        envMode.setBounds (modeRow.removeFromLeft (modeW));
+        modeRow.removeFromLeft (6);
+        voiceMode.setBounds (modeRow.removeFromLeft (modeW));
+        modeRow.removeFromLeft (6);
+        wtInterp.setBounds (modeRow);
+        gr.removeFromTop (4);
+        polyVoices.setBounds (gr.removeFromTop (juce::jlimit (30, 44, gr.getHeight() / 4)));
         gr.removeFromTop (4);
         glideEnable.setBounds (gr.removeFromTop (24));
         gr.removeFromTop (4);
@@ -4576,7 +4703,8 @@ void IndustrialEnergySynthAudioProcessorEditor::resized()
         osc1Preview.setBounds (gr.removeFromTop (previewH));
         gr.removeFromTop (4);
 
-        layoutKnobGrid (gr, { &osc1Level, &osc1Coarse, &osc1Fine, &osc1Phase, &osc1Detune });
+        layoutKnobGrid (gr, { &osc1Level, &osc1Coarse, &osc1Fine, &osc1Phase, &osc1Detune,
+                              &osc1Unison, &osc1UnisonDetune, &osc1UnisonSpread, &osc1UnisonBlend });
     }
 
     // Osc 2 internal
@@ -4591,7 +4719,8 @@ void IndustrialEnergySynthAudioProcessorEditor::resized()
         osc2Preview.setBounds (gr.removeFromTop (previewH));
         gr.removeFromTop (4);
 
-        layoutKnobGrid (gr, { &osc2Level, &osc2Coarse, &osc2Fine, &osc2Phase, &osc2Detune });
+        layoutKnobGrid (gr, { &osc2Level, &osc2Coarse, &osc2Fine, &osc2Phase, &osc2Detune,
+                              &osc2Unison, &osc2UnisonDetune, &osc2UnisonSpread, &osc2UnisonBlend });
     }
 
     // Osc 3 internal
@@ -4604,7 +4733,8 @@ void IndustrialEnergySynthAudioProcessorEditor::resized()
         osc3Preview.setBounds (gr.removeFromTop (previewH));
         gr.removeFromTop (4);
 
-        layoutKnobGrid (gr, { &osc3Level, &osc3Coarse, &osc3Fine, &osc3Phase, &osc3Detune });
+        layoutKnobGrid (gr, { &osc3Level, &osc3Coarse, &osc3Fine, &osc3Phase, &osc3Detune,
+                              &osc3Unison, &osc3UnisonDetune, &osc3UnisonSpread, &osc3UnisonBlend });
     }
 
     // Noise internal
@@ -4644,6 +4774,10 @@ void IndustrialEnergySynthAudioProcessorEditor::resized()
                                                       : ies::ui::ComboWithLabel::Layout::labelTop);
             destroyPitchLockMode.setLayout (useLabelLeft ? ies::ui::ComboWithLabel::Layout::labelLeft
                                                         : ies::ui::ComboWithLabel::Layout::labelTop);
+            foldAntiAlias.setLayout (useLabelLeft ? ies::ui::ComboWithLabel::Layout::labelLeft
+                                                  : ies::ui::ComboWithLabel::Layout::labelTop);
+            clipAntiAlias.setLayout (useLabelLeft ? ies::ui::ComboWithLabel::Layout::labelLeft
+                                                  : ies::ui::ComboWithLabel::Layout::labelTop);
             modMode.setLayout (useLabelLeft ? ies::ui::ComboWithLabel::Layout::labelLeft
                                             : ies::ui::ComboWithLabel::Layout::labelTop);
 
@@ -4654,6 +4788,11 @@ void IndustrialEnergySynthAudioProcessorEditor::resized()
                                             : juce::jmin (180, juce::jmax (120, headRow1.getWidth() / 2));
             destroyOversample.setBounds (headRow1.removeFromRight (osW));
             headRow1.removeFromRight (6);
+            const auto aaW = juce::jmin (osW, juce::jmax (90, headRow1.getWidth() / 4));
+            clipAntiAlias.setBounds (headRow1.removeFromRight (aaW));
+            headRow1.removeFromRight (6);
+            foldAntiAlias.setBounds (headRow1.removeFromRight (aaW));
+            headRow1.removeFromRight (6);
             destroyPitchLockEnable.setBounds (headRow1.reduced (0, destroyCompact ? 4 : 7));
 
             if (destroyCompact)
@@ -4805,6 +4944,9 @@ void IndustrialEnergySynthAudioProcessorEditor::resized()
         auto bottom = gr.removeFromBottom (juce::jmin (112, juce::jmax (66, gr.getHeight() / 2)));
         shaperEditor.setBounds (gr);
         bottom.removeFromTop (4);
+        auto aaArea = bottom.removeFromRight (juce::jlimit (110, 160, bottom.getWidth() / 3));
+        bottom.removeFromRight (6);
+        shaperAntiAlias.setBounds (aaArea.withSizeKeepingCentre (aaArea.getWidth(), juce::jmin (40, aaArea.getHeight())));
         layoutKnobGrid (bottom, { &shaperDrive, &shaperMix });
     }
 
@@ -5818,10 +5960,12 @@ void IndustrialEnergySynthAudioProcessorEditor::layoutToneEqIn (juce::Rectangle<
     gr.removeFromTop (6);
     auto row3 = gr.removeFromTop (44);
     const int row3Gap = 8;
-    const int row3ColW = juce::jmax (100, (row3.getWidth() - row3Gap) / 2);
+    const int row3ColW = juce::jmax (100, (row3.getWidth() - row3Gap * 2) / 3);
     toneLowCutSlope.setBounds (row3.removeFromLeft (row3ColW));
     row3.removeFromLeft (row3Gap);
-    toneHighCutSlope.setBounds (row3);
+    toneHighCutSlope.setBounds (row3.removeFromLeft (row3ColW));
+    row3.removeFromLeft (row3Gap);
+    tonePhaseMode.setBounds (row3);
 
     gr.removeFromTop (6);
     const int dynRowH = juce::jmin (104, juce::jmax (78, gr.getHeight() / 4));
@@ -6076,6 +6220,9 @@ void IndustrialEnergySynthAudioProcessorEditor::applyUiPageVisibility()
     // Synth page: core sound design.
     monoGroup.setVisible (showSynth);
     envMode.setVisible (showSynth);
+    voiceMode.setVisible (showSynth);
+    wtInterp.setVisible (showSynth);
+    polyVoices.setVisible (showSynth);
     glideEnable.setVisible (showSynth);
     glideTime.setVisible (showSynth);
 
@@ -6087,6 +6234,10 @@ void IndustrialEnergySynthAudioProcessorEditor::applyUiPageVisibility()
     osc1Fine.setVisible (showSynth);
     osc1Phase.setVisible (showSynth);
     osc1Detune.setVisible (showSynth);
+    osc1Unison.setVisible (showSynth);
+    osc1UnisonDetune.setVisible (showSynth);
+    osc1UnisonSpread.setVisible (showSynth);
+    osc1UnisonBlend.setVisible (showSynth);
 
     osc2Group.setVisible (showSynth);
     osc2Wave.setVisible (showSynth);
@@ -6096,6 +6247,10 @@ void IndustrialEnergySynthAudioProcessorEditor::applyUiPageVisibility()
     osc2Fine.setVisible (showSynth);
     osc2Phase.setVisible (showSynth);
     osc2Detune.setVisible (showSynth);
+    osc2Unison.setVisible (showSynth);
+    osc2UnisonDetune.setVisible (showSynth);
+    osc2UnisonSpread.setVisible (showSynth);
+    osc2UnisonBlend.setVisible (showSynth);
     osc2Sync.setVisible (showSynth);
 
     osc3Group.setVisible (showSynth);
@@ -6106,6 +6261,10 @@ void IndustrialEnergySynthAudioProcessorEditor::applyUiPageVisibility()
     osc3Fine.setVisible (showSynth);
     osc3Phase.setVisible (showSynth);
     osc3Detune.setVisible (showSynth);
+    osc3Unison.setVisible (showSynth);
+    osc3UnisonDetune.setVisible (showSynth);
+    osc3UnisonSpread.setVisible (showSynth);
+    osc3UnisonBlend.setVisible (showSynth);
 
     noiseGroup.setVisible (showSynth);
     noiseEnable.setVisible (showSynth);
@@ -6114,6 +6273,8 @@ void IndustrialEnergySynthAudioProcessorEditor::applyUiPageVisibility()
 
     destroyGroup.setVisible (showSynth);
     destroyOversample.setVisible (showSynth);
+    foldAntiAlias.setVisible (showSynth);
+    clipAntiAlias.setVisible (showSynth);
     foldPanel.setVisible (showSynth);
     clipPanel.setVisible (showSynth);
     modPanel.setVisible (showSynth);
@@ -6139,6 +6300,7 @@ void IndustrialEnergySynthAudioProcessorEditor::applyUiPageVisibility()
     shaperGroup.setVisible (showLab);
     shaperEnable.setVisible (showLab);
     shaperPlacement.setVisible (showLab);
+    shaperAntiAlias.setVisible (showLab);
     toneEqOpenButton.setVisible (showLab);
     shaperDrive.setVisible (showLab);
     shaperMix.setVisible (showLab);
@@ -6768,6 +6930,13 @@ void IndustrialEnergySynthAudioProcessorEditor::refreshLabels()
     envMode.setLabelText (ies::ui::tr (ies::ui::Key::envMode, langIdx));
     envMode.getCombo().changeItemText (1, ies::ui::tr (ies::ui::Key::envModeRetrigger, langIdx));
     envMode.getCombo().changeItemText (2, ies::ui::tr (ies::ui::Key::envModeLegato, langIdx));
+    voiceMode.setLabelText (ies::ui::tr (ies::ui::Key::voiceMode, langIdx));
+    voiceMode.getCombo().changeItemText (1, ies::ui::tr (ies::ui::Key::voiceModeMono, langIdx));
+    voiceMode.getCombo().changeItemText (2, ies::ui::tr (ies::ui::Key::voiceModePoly, langIdx));
+    polyVoices.setLabelText (ies::ui::tr (ies::ui::Key::polyVoices, langIdx));
+    wtInterp.setLabelText (ies::ui::tr (ies::ui::Key::wtInterp, langIdx));
+    wtInterp.getCombo().changeItemText (1, ies::ui::tr (ies::ui::Key::wtInterpLinear, langIdx));
+    wtInterp.getCombo().changeItemText (2, ies::ui::tr (ies::ui::Key::wtInterpCubic, langIdx));
     glideEnable.setButtonText (ies::ui::tr (ies::ui::Key::glideEnable, langIdx));
     glideTime.setLabelText (ies::ui::tr (ies::ui::Key::glideTime, langIdx));
 
@@ -6792,6 +6961,10 @@ void IndustrialEnergySynthAudioProcessorEditor::refreshLabels()
     osc1Fine.setLabelText (ies::ui::tr (ies::ui::Key::fine, langIdx));
     osc1Phase.setLabelText (ies::ui::tr (ies::ui::Key::phase, langIdx));
     osc1Detune.setLabelText (ies::ui::tr (ies::ui::Key::detune, langIdx));
+    osc1Unison.setLabelText (ies::ui::tr (ies::ui::Key::unison, langIdx));
+    osc1UnisonDetune.setLabelText (ies::ui::tr (ies::ui::Key::unisonDetune, langIdx));
+    osc1UnisonSpread.setLabelText (ies::ui::tr (ies::ui::Key::unisonSpread, langIdx));
+    osc1UnisonBlend.setLabelText (ies::ui::tr (ies::ui::Key::unisonBlend, langIdx));
 
     osc2Group.setText (ies::ui::tr (ies::ui::Key::osc2, langIdx));
     osc2Wave.setLabelText (ies::ui::tr (ies::ui::Key::wave, langIdx));
@@ -6814,6 +6987,10 @@ void IndustrialEnergySynthAudioProcessorEditor::refreshLabels()
     osc2Fine.setLabelText (ies::ui::tr (ies::ui::Key::fine, langIdx));
     osc2Phase.setLabelText (ies::ui::tr (ies::ui::Key::phase, langIdx));
     osc2Detune.setLabelText (ies::ui::tr (ies::ui::Key::detune, langIdx));
+    osc2Unison.setLabelText (ies::ui::tr (ies::ui::Key::unison, langIdx));
+    osc2UnisonDetune.setLabelText (ies::ui::tr (ies::ui::Key::unisonDetune, langIdx));
+    osc2UnisonSpread.setLabelText (ies::ui::tr (ies::ui::Key::unisonSpread, langIdx));
+    osc2UnisonBlend.setLabelText (ies::ui::tr (ies::ui::Key::unisonBlend, langIdx));
     osc2Sync.setButtonText (ies::ui::tr (ies::ui::Key::sync, langIdx));
 
     osc3Group.setText (ies::ui::tr (ies::ui::Key::osc3, langIdx));
@@ -6837,6 +7014,10 @@ void IndustrialEnergySynthAudioProcessorEditor::refreshLabels()
     osc3Fine.setLabelText (ies::ui::tr (ies::ui::Key::fine, langIdx));
     osc3Phase.setLabelText (ies::ui::tr (ies::ui::Key::phase, langIdx));
     osc3Detune.setLabelText (ies::ui::tr (ies::ui::Key::detune, langIdx));
+    osc3Unison.setLabelText (ies::ui::tr (ies::ui::Key::unison, langIdx));
+    osc3UnisonDetune.setLabelText (ies::ui::tr (ies::ui::Key::unisonDetune, langIdx));
+    osc3UnisonSpread.setLabelText (ies::ui::tr (ies::ui::Key::unisonSpread, langIdx));
+    osc3UnisonBlend.setLabelText (ies::ui::tr (ies::ui::Key::unisonBlend, langIdx));
 
     noiseGroup.setText (ies::ui::tr (ies::ui::Key::noise, langIdx));
     noiseEnable.setButtonText (ies::ui::tr (ies::ui::Key::noiseEnable, langIdx));
@@ -6848,6 +7029,15 @@ void IndustrialEnergySynthAudioProcessorEditor::refreshLabels()
     destroyOversample.getCombo().changeItemText (1, ies::ui::tr (ies::ui::Key::oversampleOff, langIdx));
     destroyOversample.getCombo().changeItemText (2, ies::ui::tr (ies::ui::Key::oversample2x, langIdx));
     destroyOversample.getCombo().changeItemText (3, ies::ui::tr (ies::ui::Key::oversample4x, langIdx));
+    destroyOversample.getCombo().changeItemText (4, ies::ui::tr (ies::ui::Key::oversampleAuto, langIdx));
+    foldAntiAlias.setLabelText (ies::ui::tr (ies::ui::Key::foldAntiAlias, langIdx));
+    foldAntiAlias.getCombo().changeItemText (1, ies::ui::tr (ies::ui::Key::antiAliasOff, langIdx));
+    foldAntiAlias.getCombo().changeItemText (2, ies::ui::tr (ies::ui::Key::antiAliasAdaa1, langIdx));
+    foldAntiAlias.getCombo().changeItemText (3, ies::ui::tr (ies::ui::Key::antiAliasAdaa2, langIdx));
+    clipAntiAlias.setLabelText (ies::ui::tr (ies::ui::Key::clipAntiAlias, langIdx));
+    clipAntiAlias.getCombo().changeItemText (1, ies::ui::tr (ies::ui::Key::antiAliasOff, langIdx));
+    clipAntiAlias.getCombo().changeItemText (2, ies::ui::tr (ies::ui::Key::antiAliasAdaa1, langIdx));
+    clipAntiAlias.getCombo().changeItemText (3, ies::ui::tr (ies::ui::Key::antiAliasAdaa2, langIdx));
     foldPanel.setText (ies::ui::tr (ies::ui::Key::destroyFold, langIdx));
     clipPanel.setText (ies::ui::tr (ies::ui::Key::destroyClip, langIdx));
     modPanel.setText (ies::ui::tr (ies::ui::Key::destroyMod, langIdx));
@@ -6883,6 +7073,10 @@ void IndustrialEnergySynthAudioProcessorEditor::refreshLabels()
     shaperPlacement.getCombo().changeItemText (2, ies::ui::tr (ies::ui::Key::shaperPlacementPost, langIdx));
     shaperDrive.setLabelText (ies::ui::tr (ies::ui::Key::shaperDrive, langIdx));
     shaperMix.setLabelText (ies::ui::tr (ies::ui::Key::shaperMix, langIdx));
+    shaperAntiAlias.setLabelText (ies::ui::tr (ies::ui::Key::shaperAntiAlias, langIdx));
+    shaperAntiAlias.getCombo().changeItemText (1, ies::ui::tr (ies::ui::Key::antiAliasOff, langIdx));
+    shaperAntiAlias.getCombo().changeItemText (2, ies::ui::tr (ies::ui::Key::antiAliasAdaa1, langIdx));
+    shaperAntiAlias.getCombo().changeItemText (3, ies::ui::tr (ies::ui::Key::antiAliasAdaa2, langIdx));
 
     modGroup.setText (ies::ui::tr (ies::ui::Key::modulation, langIdx));
     macrosPanel.setText (ies::ui::tr (ies::ui::Key::macros, langIdx));
@@ -7127,6 +7321,7 @@ void IndustrialEnergySynthAudioProcessorEditor::refreshLabels()
         modSlotSrc[(size_t) i].changeItemText (11, ies::ui::tr (ies::ui::Key::modSrcAmpEnv, langIdx));
         modSlotSrc[(size_t) i].changeItemText (12, ies::ui::tr (ies::ui::Key::modSrcRandom, langIdx));
         modSlotSrc[(size_t) i].changeItemText (13, "MSEG");
+        modSlotSrc[(size_t) i].changeItemText (14, ies::ui::tr (ies::ui::Key::modSrcDrift, langIdx));
 
         // Destination menu
         modSlotDst[(size_t) i].changeItemText (1, ies::ui::tr (ies::ui::Key::modOff, langIdx));
@@ -7208,6 +7403,9 @@ void IndustrialEnergySynthAudioProcessorEditor::refreshLabels()
     toneHighCutSlope.getCombo().changeItemText (2, (langIdx == (int) params::ui::ru) ? juce::String::fromUTF8 (u8"24 дБ/окт") : juce::String ("24 dB/oct"));
     toneHighCutSlope.getCombo().changeItemText (3, (langIdx == (int) params::ui::ru) ? juce::String::fromUTF8 (u8"36 дБ/окт") : juce::String ("36 dB/oct"));
     toneHighCutSlope.getCombo().changeItemText (4, (langIdx == (int) params::ui::ru) ? juce::String::fromUTF8 (u8"48 дБ/окт") : juce::String ("48 dB/oct"));
+    tonePhaseMode.setLabelText (ies::ui::tr (ies::ui::Key::tonePhaseMode, langIdx));
+    tonePhaseMode.getCombo().changeItemText (1, ies::ui::tr (ies::ui::Key::tonePhaseMinimum, langIdx));
+    tonePhaseMode.getCombo().changeItemText (2, ies::ui::tr (ies::ui::Key::tonePhaseLinear, langIdx));
     toneDynBand.setLabelText ((langIdx == (int) params::ui::ru) ? juce::String::fromUTF8 (u8"Dyn пик") : juce::String ("Dyn Band"));
     for (int i = 0; i < 8; ++i)
         toneDynBand.getCombo().changeItemText (i + 1,
@@ -7405,6 +7603,48 @@ void IndustrialEnergySynthAudioProcessorEditor::refreshTooltips()
         glideTime.getSlider().setTooltip (tip);
         glideTime.getLabel().setTooltip (tip);
     }
+    {
+        const auto tip = T ("Voice mode. Mono = one voice with legato/glide. Poly = chords, each note gets its own voice.",
+                            u8"Режим голосов. Моно = один голос с легато/глайдом. Поли = аккорды, каждой ноте свой голос.");
+        voiceMode.getCombo().setTooltip (tip);
+        voiceMode.getLabel().setTooltip (tip);
+    }
+    {
+        const auto tip = T ("Maximum number of voices in Poly mode. Extra notes reuse the quietest released voice, then the oldest held one.",
+                            u8"Максимум голосов в режиме Поли. Лишние ноты забирают самый тихий отпущенный голос, затем самый старый удерживаемый.");
+        polyVoices.getSlider().setTooltip (tip);
+        polyVoices.getLabel().setTooltip (tip);
+    }
+    {
+        const auto tip = T ("Read interpolation for table waves (all except Saw/Square/Triangle). Cubic is cleaner on low notes and costs a little more CPU.",
+                            u8"Интерполяция чтения табличных волн (все, кроме Пилы/Квадрата/Треугольника). Кубическая чище на низких нотах и чуть дороже по CPU.");
+        wtInterp.getCombo().setTooltip (tip);
+        wtInterp.getLabel().setTooltip (tip);
+    }
+
+    {
+        auto setKnobTips = [] (std::initializer_list<ies::ui::KnobWithLabel*> knobs, const juce::String& tip)
+        {
+            for (auto* k : knobs)
+            {
+                k->getSlider().setTooltip (tip);
+                k->getLabel().setTooltip (tip);
+            }
+        };
+
+        setKnobTips ({ &osc1Unison, &osc2Unison, &osc3Unison },
+                     T ("Unison voices for this oscillator (1 = off).",
+                        u8"Голоса унисона для этого осциллятора (1 = выкл)."));
+        setKnobTips ({ &osc1UnisonDetune, &osc2UnisonDetune, &osc3UnisonDetune },
+                     T ("Unison detune. At 100% the outer voices sit +/-50 cents from the centre.",
+                        u8"Детюн унисона. На 100% крайние голоса уходят на +/-50 центов от центра."));
+        setKnobTips ({ &osc1UnisonSpread, &osc2UnisonSpread, &osc3UnisonSpread },
+                     T ("Start phase spread between unison voices on note-on.",
+                        u8"Разброс стартовой фазы голосов унисона при нажатии ноты."));
+        setKnobTips ({ &osc1UnisonBlend, &osc2UnisonBlend, &osc3UnisonBlend },
+                     T ("Level of the side unison voices against the centre voice.",
+                        u8"Громкость боковых голосов унисона относительно центрального."));
+    }
 
     {
         const auto tip = T ("Macros are modulation sources (0..100%). Assign them in the Mod Matrix.",
@@ -7679,11 +7919,24 @@ void IndustrialEnergySynthAudioProcessorEditor::refreshTooltips()
     }
 
     {
-        const auto tip = T ("Destroy oversampling: reduces aliasing, increases CPU (applies to Fold/Clip/Mod).",
-                            u8"Оверсэмплинг Destroy: уменьшает алиасинг, увеличивает нагрузку CPU (применяется к Fold/Clip/Mod).");
+        const auto tip = T ("Destroy oversampling: reduces aliasing, increases CPU (applies to Fold/Clip/Mod). "
+                            "Auto picks 1x..8x from the note pitch and drive.",
+                            u8"Оверсэмплинг Destroy: уменьшает алиасинг, увеличивает нагрузку CPU (применяется к Fold/Clip/Mod). "
+                            u8"Авто выбирает 1x..8x по высоте ноты и драйву.");
         destroyOversample.getCombo().setTooltip (tip);
         destroyOversample.getLabel().setTooltip (tip);
     }
+    {
+        const auto tip = T ("Antiderivative anti-aliasing for Fold/Clip. ADAA 1 removes most aliasing at low CPU; "
+                            "ADAA 2 is cleaner still. Stacks with oversampling.",
+                            u8"Антиалиасинг через первообразную для Fold/Clip. ADAA 1 убирает большую часть алиасинга при малой нагрузке; "
+                            u8"ADAA 2 ещё чище. Работает вместе с оверсэмплингом.");
+        for (auto* c : { &foldAntiAlias, &clipAntiAlias })
+        {
+            c->getCombo().setTooltip (tip);
+            c->getLabel().setTooltip (tip);
+        }
+    }
 
     filterKeyTrack.setTooltip (T ("When ON, cutoff follows note pitch (key tracking).",
                                   u8"Если ВКЛ, срез фильтра следует высоте ноты (key tracking)."));
@@ -7702,6 +7955,11 @@ void IndustrialEnergySynthAudioProcessorEditor::refreshTooltips()
     toneHighCutSlope.getCombo().setTooltip (T ("High-cut slope. Higher slope cuts highs more aggressively.",
                                                u8"Крутизна ВЧ-среза. Чем выше, тем агрессивнее срез верхов."));
     toneHighCutSlope.getLabel().setTooltip (toneHighCutSlope.getCombo().getTooltip());
+    tonePhaseMode.getCombo().setTooltip (T ("EQ phase. Linear keeps the phase intact; dynamic peaks then use their static curve. "
+                                            "The plugin always reports the linear-phase latency, so switching does not shift timing.",
+                                            u8"Фаза EQ. Линейная не искажает фазу; динамические пики тогда работают по статичной кривой. "
+                                            u8"Плагин всегда сообщает задержку линейной фазы, поэтому переключение не сдвигает тайминг."));
+    tonePhaseMode.getLabel().setTooltip (tonePhaseMode.getCombo().getTooltip());
     toneDynBand.getCombo().setTooltip (T ("Select which EQ peak's dynamic controls are shown below.",
                                           u8"Выбери пик эквалайзера, чьи динамические параметры показаны ниже."));
     toneDynBand.getLabel().setTooltip (toneDynBand.getCombo().getTooltip());
@@ -7735,6 +7993,9 @@ void IndustrialEnergySynthAudioProcessorEditor::refreshTooltips()
     shaperPlacement.getCombo().setTooltip (T ("Shaper placement in signal flow: before or after Destroy.",
                                               u8"Позиция shaper в цепочке: до или после блока Destroy."));
     shaperPlacement.getLabel().setTooltip (shaperPlacement.getCombo().getTooltip());
+    shaperAntiAlias.getCombo().setTooltip (T ("Antiderivative anti-aliasing for the shaper curve. ADAA 2 is cleaner, ADAA 1 is cheaper.",
+                                              u8"Антиалиасинг через первообразную для кривой shaper. ADAA 2 чище, ADAA 1 дешевле."));
+    shaperAntiAlias.getLabel().setTooltip (shaperAntiAlias.getCombo().getTooltip());
     {
         const auto tip = T ("Shaper drive before the transfer curve.", u8"Драйв shaper перед кривой переноса.");
         shaperDrive.getSlider().setTooltip (tip);
@@ -7769,6 +8030,11 @@ void IndustrialEnergySynthAudioProcessorEditor::updateEnabledStates()
     if (glideTime.isEnabled() != glideOn)
         glideTime.setEnabled (glideOn);
 
+    // Voice count only matters in Poly mode.
+    const auto polyOn = (voiceMode.getCombo().getSelectedItemIndex() == (int) params::mono::voicePoly);
+    if (polyVoices.isEnabled() != polyOn)
+        polyVoices.setEnabled (polyOn);
+
     // Mod Freq has no effect in note-sync mode, so disable it.
     const auto noteSyncOn = modNoteSync.getToggleState();
     if (modFreq.isEnabled() == noteSyncOn)
@@ -8608,8 +8874,8 @@ void IndustrialEnergySynthAudioProcessorEditor::timerCallback()
         const auto loudRisk = juce::jmax (audioProcessor.getUiPreClipRisk(), audioProcessor.getUiOutClipRisk());
         const auto cpuRisk = audioProcessor.getUiCpuRisk();
 
-        const auto osIdx = destroyOversample.getCombo().getSelectedItemIndex(); // 0=off,1=2x,2=4x
-        const auto osMitigation = (osIdx == 2) ? 0.45f : (osIdx == 1) ? 0.65f : 1.0f;
+        const auto osIdx = destroyOversample.getCombo().getSelectedItemIndex(); // 0=off,1=2x,2=4x,3=auto
+        const auto osMitigation = (osIdx == 2 || osIdx == 3) ? 0.45f : (osIdx == 1) ? 0.65f : 1.0f;
         const auto aliasCore = juce::jlimit (0.0f, 1.0f,
                                              0.38f * (float) foldAmount.getSlider().getValue()
                                            + 0.38f * (float) clipAmount.getSlider().getValue()
@@ -8998,6 +9264,7 @@ void IndustrialEnergySynthAudioProcessorEditor::timerCallback()
             float sumAEnv = 0.0f;
             float sumRand = 0.0f;
             float sumMseg = 0.0f;
+            float sumDrift = 0.0f;
 
             for (int i = 0; i < params::mod::numSlots; ++i)
             {
@@ -9005,7 +9272,7 @@ void IndustrialEnergySynthAudioProcessorEditor::timerCallback()
                 if (d != dst)
                     continue;
 
-                const auto src = (params::mod::Source) juce::jlimit ((int) params::mod::srcOff, (int) params::mod::srcMseg, modSlotSrc[(size_t) i].getSelectedItemIndex());
+                const auto src = (params::mod::Source) juce::jlimit ((int) params::mod::srcOff, (int) params::mod::srcLast, modSlotSrc[(size_t) i].getSelectedItemIndex());
                 const auto dep = (float) modSlotDepth[(size_t) i].getValue();
 
                 switch (src)
@@ -9023,12 +9290,13 @@ void IndustrialEnergySynthAudioProcessorEditor::timerCallback()
                     case params::mod::srcAmpEnv: sumAEnv += dep; break;
                     case params::mod::srcRandom: sumRand += dep; break;
                     case params::mod::srcMseg: sumMseg += dep; break;
+                    case params::mod::srcDrift: sumDrift += dep; break;
                     default: break;
                 }
             }
 
             struct Arc final { float depth; juce::Colour col; };
-            std::array<Arc, 12> arcs {};
+            std::array<Arc, 13> arcs {};
             int count = 0;
 
             auto addArc = [&] (float d, juce::Colour c)
@@ -9050,6 +9318,7 @@ void IndustrialEnergySynthAudioProcessorEditor::timerCallback()
             addArc (sumAEnv, colAEnv);
             addArc (sumRand, colRand);
             addArc (sumMseg, colMacro2.brighter (0.2f));
+            addArc (sumDrift, colRand.darker (0.3f));
 
             bool changed = false;
             changed |= setIfChanged (s, "modArcCount", count);
@@ -10352,7 +10621,7 @@ void IndustrialEnergySynthAudioProcessorEditor::clearAllModForDest (params::mod:
     for (int i = 0; i < params::mod::numSlots; ++i)
     {
         const auto d = (params::mod::Dest) juce::jlimit ((int) params::mod::dstOff, (int) params::mod::dstLast, modSlotDst[(size_t) i].getSelectedItemIndex());
-        const auto s = (params::mod::Source) juce::jlimit ((int) params::mod::srcOff, (int) params::mod::srcMseg, modSlotSrc[(size_t) i].getSelectedItemIndex());
+        const auto s = (params::mod::Source) juce::jlimit ((int) params::mod::srcOff, (int) params::mod::srcLast, modSlotSrc[(size_t) i].getSelectedItemIndex());
         if (d == dst && s != params::mod::srcOff)
             clearModSlot (i);
     }
@@ -10376,7 +10645,7 @@ void IndustrialEnergySynthAudioProcessorEditor::assignModulation (params::mod::S
 
     for (int i = 0; i < params::mod::numSlots; ++i)
     {
-        const auto s = (params::mod::Source) juce::jlimit ((int) params::mod::srcOff, (int) params::mod::srcMseg, modSlotSrc[(size_t) i].getSelectedItemIndex());
+        const auto s = (params::mod::Source) juce::jlimit ((int) params::mod::srcOff, (int) params::mod::srcLast, modSlotSrc[(size_t) i].getSelectedItemIndex());
         const auto d = (params::mod::Dest) juce::jlimit ((int) params::mod::dstOff, (int) params::mod::dstLast, modSlotDst[(size_t) i].getSelectedItemIndex());
 
         if (s == src && d == dst)
@@ -10409,6 +10678,8 @@ void IndustrialEnergySynthAudioProcessorEditor::assignModulation (params::mod::S
             defDepth = 0.5f;
         else if (src == params::mod::srcMseg)
             defDepth = 0.7f;
+        else if (src == params::mod::srcDrift)
+            defDepth = 0.25f;
         setParamValue (kModSlotDepthIds[slot], defDepth);
     }
 
@@ -10438,6 +10709,7 @@ void IndustrialEnergySynthAudioProcessorEditor::assignModulation (params::mod::S
                 case params::mod::srcAmpEnv: return isRu ? juce::String::fromUTF8 (u8"Огиб. амплитуды") : "Amp Env";
                 case params::mod::srcRandom: return isRu ? juce::String::fromUTF8 (u8"Случайно") : "Random";
                 case params::mod::srcMseg: return "MSEG";
+                case params::mod::srcDrift: return ies::ui::tr (ies::ui::Key::modSrcDrift, getLanguageIndex());
                 default: break;
             }
             return "Off";
@@ -10513,7 +10785,7 @@ void IndustrialEnergySynthAudioProcessorEditor::showModulationMenu (params::mod:
     for (int i = 0; i < params::mod::numSlots; ++i)
     {
         const auto d = (params::mod::Dest) juce::jlimit ((int) params::mod::dstOff, (int) params::mod::dstLast, modSlotDst[(size_t) i].getSelectedItemIndex());
-        const auto s = (params::mod::Source) juce::jlimit ((int) params::mod::srcOff, (int) params::mod::srcMseg, modSlotSrc[(size_t) i].getSelectedItemIndex());
+        const auto s = (params::mod::Source) juce::jlimit ((int) params::mod::srcOff, (int) params::mod::srcLast, modSlotSrc[(size_t) i].getSelectedItemIndex());
         if (d == dst && s != params::mod::srcOff)
             matchingSlots.add (i);
     }
@@ -10888,14 +11160,14 @@ void IndustrialEnergySynthAudioProcessorEditor::setLastTouchedModDest (params::m
     }();
 
     float sumL1 = 0.0f, sumL2 = 0.0f, sumM1 = 0.0f, sumM2 = 0.0f, sumMW = 0.0f, sumAT = 0.0f, sumV = 0.0f, sumN = 0.0f;
-    float sumFE = 0.0f, sumAE = 0.0f, sumR = 0.0f, sumMS = 0.0f;
+    float sumFE = 0.0f, sumAE = 0.0f, sumR = 0.0f, sumMS = 0.0f, sumDR = 0.0f;
     for (int i = 0; i < params::mod::numSlots; ++i)
     {
         const auto d = (params::mod::Dest) juce::jlimit ((int) params::mod::dstOff, (int) params::mod::dstLast, modSlotDst[(size_t) i].getSelectedItemIndex());
         if (d != dst)
             continue;
 
-        const auto s = (params::mod::Source) juce::jlimit ((int) params::mod::srcOff, (int) params::mod::srcMseg, modSlotSrc[(size_t) i].getSelectedItemIndex());
+        const auto s = (params::mod::Source) juce::jlimit ((int) params::mod::srcOff, (int) params::mod::srcLast, modSlotSrc[(size_t) i].getSelectedItemIndex());
         const auto dep = (float) modSlotDepth[(size_t) i].getValue();
 
         switch (s)
@@ -10912,6 +11184,7 @@ void IndustrialEnergySynthAudioProcessorEditor::setLastTouchedModDest (params::m
             case params::mod::srcAmpEnv: sumAE += dep; break;
             case params::mod::srcRandom: sumR += dep; break;
             case params::mod::srcMseg: sumMS += dep; break;
+            case params::mod::srcDrift: sumDR += dep; break;
             case params::mod::srcOff:    break;
         }
     }
@@ -10939,6 +11212,7 @@ void IndustrialEnergySynthAudioProcessorEditor::setLastTouchedModDest (params::m
     addPart (modInfo, "AE", sumAE);
     addPart (modInfo, "R", sumR);
     addPart (modInfo, "MS", sumMS);
+    addPart (modInfo, "DR", sumDR);
 
     auto targetText = (isRu ? juce::String::fromUTF8 (u8"Цель: ") : juce::String ("Target: ")) + dstName;
     if (modInfo.isNotEmpty())
@@ -178,6 +178,12 @@ private:
     std::unique_ptr<APVTS::ButtonAttachment> glideEnableAttachment;
     ies::ui::KnobWithLabel glideTime;
     std::unique_ptr<APVTS::SliderAttachment> glideTimeAttachment;
+    ies::ui::ComboWithLabel voiceMode;
+    std::unique_ptr<APVTS::ComboBoxAttachment> voiceModeAttachment;
+    ies::ui::KnobWithLabel polyVoices;
+    std::unique_ptr<APVTS::SliderAttachment> polyVoicesAttachment;
+    ies::ui::ComboWithLabel wtInterp;
+    std::unique_ptr<APVTS::ComboBoxAttachment> wtInterpAttachment;
 
     // Osc 1
     juce::GroupComponent osc1Group;
@@ -194,6 +200,14 @@ private:
     std::unique_ptr<APVTS::SliderAttachment> osc1PhaseAttachment;
     ies::ui::KnobWithLabel osc1Detune;
     std::unique_ptr<APVTS::SliderAttachment> osc1DetuneAttachment;
+    ies::ui::KnobWithLabel osc1Unison;
+    std::unique_ptr<APVTS::SliderAttachment> osc1UnisonAttachment;
+    ies::ui::KnobWithLabel osc1UnisonDetune;
+    std::unique_ptr<APVTS::SliderAttachment> osc1UnisonDetuneAttachment;
+    ies::ui::KnobWithLabel osc1UnisonSpread;
+    std::unique_ptr<APVTS::SliderAttachment> osc1UnisonSpreadAttachment;
+    ies::ui::KnobWithLabel osc1UnisonBlend;
+    std::unique_ptr<APVTS::SliderAttachment> osc1UnisonBlendAttachment;
 
     // Osc 2
     juce::GroupComponent osc2Group;
@@ -210,6 +224,14 @@ private:
     std::unique_ptr<APVTS::SliderAttachment> osc2PhaseAttachment;
     ies::ui::KnobWithLabel osc2Detune;
     std::unique_ptr<APVTS::SliderAttachment> osc2DetuneAttachment;
+    ies::ui::KnobWithLabel osc2Unison;
+    std::unique_ptr<APVTS::SliderAttachment> osc2UnisonAttachment;
+    ies::ui::KnobWithLabel osc2UnisonDetune;
+    std::unique_ptr<APVTS::SliderAttachment> osc2UnisonDetuneAttachment;
+    ies::ui::KnobWithLabel osc2UnisonSpread;
+    std::unique_ptr<APVTS::SliderAttachment> osc2UnisonSpreadAttachment;
+    ies::ui::KnobWithLabel osc2UnisonBlend;
+    std::unique_ptr<APVTS::SliderAttachment> osc2UnisonBlendAttachment;
     juce::ToggleButton osc2Sync;
     std::unique_ptr<APVTS::ButtonAttachment> osc2SyncAttachment;
 
@@ -228,6 +250,14 @@ private:
     std::unique_ptr<APVTS::SliderAttachment> osc3PhaseAttachment;
     ies::ui::KnobWithLabel osc3Detune;
     std::unique_ptr<APVTS::SliderAttachment> osc3DetuneAttachment;
+    ies::ui::KnobWithLabel osc3Unison;
+    std::unique_ptr<APVTS::SliderAttachment> osc3UnisonAttachment;
+    ies::ui::KnobWithLabel osc3UnisonDetune;
+    std::unique_ptr<APVTS::SliderAttachment> osc3UnisonDetuneAttachment;
+    ies::ui::KnobWithLabel osc3UnisonSpread;
+    std::unique_ptr<APVTS::SliderAttachment> osc3UnisonSpreadAttachment;
+    ies::ui::KnobWithLabel osc3UnisonBlend;
+    std::unique_ptr<APVTS::SliderAttachment> osc3UnisonBlendAttachment;
 
     // Noise (Serum-ish helper oscillator)
     juce::GroupComponent noiseGroup;
@@ -242,6 +272,10 @@ private:
     juce::GroupComponent destroyGroup;
     ies::ui::ComboWithLabel destroyOversample;
     std::unique_ptr<APVTS::ComboBoxAttachment> destroyOversampleAttachment;
+    ies::ui::ComboWithLabel foldAntiAlias;
+    std::unique_ptr<APVTS::ComboBoxAttachment> foldAntiAliasAttachment;
+    ies::ui::ComboWithLabel clipAntiAlias;
+    std::unique_ptr<APVTS::ComboBoxAttachment> clipAntiAliasAttachment;
     juce::GroupComponent foldPanel;
     juce::GroupComponent clipPanel;
     juce::GroupComponent modPanel;
@@ -290,6 +324,8 @@ private:
     std::unique_ptr<APVTS::ButtonAttachment> shaperEnableAttachment;
     ies::ui::ComboWithLabel shaperPlacement;
     std::unique_ptr<APVTS::ComboBoxAttachment> shaperPlacementAttachment;
+    ies::ui::ComboWithLabel shaperAntiAlias;
+    std::unique_ptr<APVTS::ComboBoxAttachment> shaperAntiAliasAttachment;
     juce::TextButton toneEqOpenButton;
     ies::ui::KnobWithLabel shaperDrive;
     std::unique_ptr<APVTS::SliderAttachment> shaperDriveAttachment;
@@ -342,6 +378,8 @@ private:
     std::unique_ptr<APVTS::ComboBoxAttachment> toneLowCutSlopeAttachment;
     ies::ui::ComboWithLabel toneHighCutSlope;
     std::unique_ptr<APVTS::ComboBoxAttachment> toneHighCutSlopeAttachment;
+    ies::ui::ComboWithLabel tonePhaseMode;
+    std::unique_ptr<APVTS::ComboBoxAttachment> tonePhaseModeAttachment;
     ies::ui::ComboWithLabel toneDynBand;
     juce::ToggleButton toneDynEnable;
     std::unique_ptr<APVTS::ButtonAttachment> toneDynEnableAttachment;
@@ -10,11 +10,22 @@ namespace
 {
 static void migrateStateIfNeeded (juce::ValueTree& state)
 {
-    // Migrate old Tone EQ single-peak params -> new multi-peak params.
-    // Keeps older projects/user-presets working after the Tone EQ upgrade.
     if (! state.isValid())
         return;
 
+    // States saved before the mod matrix had a control rate ran every route at audio rate. Keep them that way so
+    // old patches sound the same; only fresh instances start at the cheaper default. (APVTS keeps each parameter
+    // as a PARAM child with "id" and "value".)
+    if (! state.getChildWithProperty ("id", params::mod::controlRate).isValid())
+    {
+        juce::ValueTree rate ("PARAM");
+        rate.setProperty ("id", params::mod::controlRate, nullptr);
+        rate.setProperty ("value", (int) params::mod::rateAudio, nullptr);
+        state.appendChild (rate, nullptr);
+    }
+
+    // Migrate old Tone EQ single-peak params -> new multi-peak params.
+    // Keeps older projects/user-presets working after the Tone EQ upgrade.
     const bool hasLegacy = state.hasProperty (params::tone::legacyPeakFreqHz)
                         || state.hasProperty (params::tone::legacyPeakGainDb)
                         || state.hasProperty (params::tone::legacyPeakQ);
@@ -79,41 +90,14 @@ static bool decodeWavePointsBase64 (const juce::String& b64, float* points, int
     return true;
 }
 
-static void pointsToWavetable (ies::dsp::WavetableSet& out, const float* points, int numPoints)
-{
-    // points: y values at equidistant x in [0..1]. Ensure periodic by forcing endpoints to match.
-    std::array<float, (size_t) IndustrialEnergySynthAudioProcessor::waveDrawNumPoints> p {};
-    const int n = juce::jmin (IndustrialEnergySynthAudioProcessor::waveDrawNumPoints, juce::jmax (2, numPoints));
-    for (int i = 0; i < n; ++i)
-        p[(size_t) i] = juce::jlimit (-1.0f, 1.0f, points[i]);
-    p[0] = p[(size_t) (n - 1)];
-
-    auto& t0 = out.mip[0];
-    for (int i = 0; i < ies::dsp::WavetableSet::tableSize; ++i)
-    {
-        const float x = (float) i / (float) ies::dsp::WavetableSet::tableSize;
-        const float pos = x * (float) (n - 1);
-        const int i0 = juce::jlimit (0, n - 2, (int) std::floor (pos));
-        const int i1 = i0 + 1;
-        const float frac = pos - (float) i0;
-        const float a = p[(size_t) i0];
-        const float b = p[(size_t) i1];
-        t0[(size_t) i] = a + frac * (b - a);
-    }
-
-    ies::dsp::removeDcAndNormalise (t0.data(), ies::dsp::WavetableSet::tableSize);
-    ies::dsp::buildMipsFromLevel0 (out);
-}
-
 static void fillTemplate (ies::dsp::WavetableSet& out, const std::function<float(float)>& fn)
 {
-    auto& t0 = out.mip[0];
+    auto* t0 = out.level (0);
     for (int i = 0; i < ies::dsp::WavetableSet::tableSize; ++i)
     {
         const float ph = (float) i / (float) ies::dsp::WavetableSet::tableSize;
-        t0[(size_t) i] = juce::jlimit (-1.0f, 1.0f, fn (ph));
+        t0[i] = juce::jlimit (-1.0f, 1.0f, fn (ph));
     }
-    ies::dsp::removeDcAndNormalise (t0.data(), ies::dsp::WavetableSet::tableSize);
     ies::dsp::buildMipsFromLevel0 (out);
 }
 
@@ -224,13 +208,11 @@ void IndustrialEnergySynthAudioProcessor::loadCustomWavesFromState()
             storeCustomWavePointsToState (o, customWaves.points[(size_t) o].data(), waveDrawNumPoints);
         }
 
-        const int inactive = 1 - customWaves.activeIndex[(size_t) o].load (std::memory_order_relaxed);
-        pointsToWavetable (customWaves.tableDoubleBuffer[(size_t) o][(size_t) inactive],
-                           customWaves.points[(size_t) o].data(),
-                           waveDrawNumPoints);
-        customWaves.activeIndex[(size_t) o].store (inactive, std::memory_order_release);
-        engine.setCustomWavetable (o, &customWaves.tableDoubleBuffer[(size_t) o][(size_t) inactive]);
+        customWaveBuilder.request (o, customWaves.points[(size_t) o].data(), waveDrawNumPoints);
     }
+
+    // State loads build right away so the tables are in place before the next block.
+    customWaveBuilder.flush();
 }
 
 const ies::dsp::WavetableSet* IndustrialEnergySynthAudioProcessor::getWavetableForUi (int oscIndex, int waveIndex) const noexcept
@@ -238,14 +220,22 @@ const ies::dsp::WavetableSet* IndustrialEnergySynthAudioProcessor::getWavetableF
     if (waveIndex >= 3 && waveIndex <= 12)
         return &wavetableTemplates[(size_t) juce::jlimit (0, waveTableNumTemplates - 1, waveIndex - 3)];
 
-    if (waveIndex == 13)
+    return nullptr;
+}
+
+void IndustrialEnergySynthAudioProcessor::getCustomWavePointsForUi (int oscIndex, float* dest, int numPoints) const noexcept
+{
+    if (dest == nullptr || numPoints <= 0)
+        return;
+
+    const auto& src = customWaves.points[(size_t) juce::jlimit (0, 2, oscIndex)];
+    for (int i = 0; i < numPoints; ++i)
     {
-        const int o = juce::jlimit (0, 2, oscIndex);
-        const int idx = customWaves.activeIndex[(size_t) o].load (std::memory_order_acquire);
-        return &customWaves.tableDoubleBuffer[(size_t) o][(size_t) juce::jlimit (0, 1, idx)];
+        const float pos = numPoints > 1 ? (float) i * (float) (waveDrawNumPoints - 1) / (float) (numPoints - 1) : 0.0f;
+        const int i0 = juce::jlimit (0, waveDrawNumPoints - 2, (int) std::floor (pos));
+        const float frac = pos - (float) i0;
+        dest[i] = src[(size_t) i0] + frac * (src[(size_t) i0 + 1] - src[(size_t) i0]);
     }
-
-    return nullptr;
 }
 
 void IndustrialEnergySynthAudioProcessor::setCustomWaveFromUi (int oscIndex, const float* points, int numPoints)
@@ -262,13 +252,8 @@ void IndustrialEnergySynthAudioProcessor::setCustomWaveFromUi (int oscIndex, con
 
     storeCustomWavePointsToState (oscIndex, customWaves.points[(size_t) oscIndex].data(), waveDrawNumPoints);
 
-    const int inactive = 1 - customWaves.activeIndex[(size_t) oscIndex].load (std::memory_order_relaxed);
-    pointsToWavetable (customWaves.tableDoubleBuffer[(size_t) oscIndex][(size_t) inactive],
-                       customWaves.points[(size_t) oscIndex].data(),
-                       waveDrawNumPoints);
-
-    customWaves.activeIndex[(size_t) oscIndex].store (inactive, std::memory_order_release);
-    engine.setCustomWavetable (oscIndex, &customWaves.tableDoubleBuffer[(size_t) oscIndex][(size_t) inactive]);
+    // Built and published on the builder thread; drag updates that pile up are coalesced there.
+    customWaveBuilder.request (oscIndex, customWaves.points[(size_t) oscIndex].data(), waveDrawNumPoints);
 }
 
 // --- Arp (Sequencer) ---------------------------------------------------------
@@ -751,6 +736,9 @@ IndustrialEnergySynthAudioProcessor::IndustrialEnergySynthAudioProcessor()
     paramPointers.monoEnvMode   = apvts.getRawParameterValue (params::mono::envMode);
     paramPointers.glideEnable   = apvts.getRawParameterValue (params::mono::glideEnable);
     paramPointers.glideTimeMs   = apvts.getRawParameterValue (params::mono::glideTimeMs);
+    paramPointers.voiceMode     = apvts.getRawParameterValue (params::mono::voiceMode);
+    paramPointers.polyVoices    = apvts.getRawParameterValue (params::mono::polyVoices);
+    paramPointers.wtInterp      = apvts.getRawParameterValue (params::mono::wtInterp);
 
     paramPointers.osc1Wave      = apvts.getRawParameterValue (params::osc1::wave);
     paramPointers.osc1Level     = apvts.getRawParameterValue (params::osc1::level);
@@ -758,6 +746,10 @@ IndustrialEnergySynthAudioProcessor::IndustrialEnergySynthAudioProcessor()
     paramPointers.osc1Fine      = apvts.getRawParameterValue (params::osc1::fine);
     paramPointers.osc1Phase     = apvts.getRawParameterValue (params::osc1::phase);
     paramPointers.osc1Detune    = apvts.getRawParameterValue (params::osc1::detune);
+    paramPointers.osc1Unison       = apvts.getRawParameterValue (params::osc1::unison);
+    paramPointers.osc1UnisonDetune = apvts.getRawParameterValue (params::osc1::unisonDetune);
+    paramPointers.osc1UnisonSpread = apvts.getRawParameterValue (params::osc1::unisonSpread);
+    paramPointers.osc1UnisonBlend  = apvts.getRawParameterValue (params::osc1::unisonBlend);
 
     paramPointers.osc2Wave      = apvts.getRawParameterValue (params::osc2::wave);
     paramPointers.osc2Level     = apvts.getRawParameterValue (params::osc2::level);
@@ -765,6 +757,10 @@ IndustrialEnergySynthAudioProcessor::IndustrialEnergySynthAudioProcessor()
     paramPointers.osc2Fine      = apvts.getRawParameterValue (params::osc2::fine);
     paramPointers.osc2Phase     = apvts.getRawParameterValue (params::osc2::phase);
     paramPointers.osc2Detune    = apvts.getRawParameterValue (params::osc2::detune);
+    paramPointers.osc2Unison       = apvts.getRawParameterValue (params::osc2::unison);
+    paramPointers.osc2UnisonDetune = apvts.getRawParameterValue (params::osc2::unisonDetune);
+    paramPointers.osc2UnisonSpread = apvts.getRawParameterValue (params::osc2::unisonSpread);
+    paramPointers.osc2UnisonBlend  = apvts.getRawParameterValue (params::osc2::unisonBlend);
     paramPointers.osc2Sync      = apvts.getRawParameterValue (params::osc2::sync);
 
     paramPointers.osc3Wave      = apvts.getRawParameterValue (params::osc3::wave);
@@ -773,6 +769,10 @@ IndustrialEnergySynthAudioProcessor::IndustrialEnergySynthAudioProcessor()
     paramPointers.osc3Fine      = apvts.getRawParameterValue (params::osc3::fine);
     paramPointers.osc3Phase     = apvts.getRawParameterValue (params::osc3::phase);
     paramPointers.osc3Detune    = apvts.getRawParameterValue (params::osc3::detune);
+    paramPointers.osc3Unison       = apvts.getRawParameterValue (params::osc3::unison);
+    paramPointers.osc3UnisonDetune = apvts.getRawParameterValue (params::osc3::unisonDetune);
+    paramPointers.osc3UnisonSpread = apvts.getRawParameterValue (params::osc3::unisonSpread);
+    paramPointers.osc3UnisonBlend  = apvts.getRawParameterValue (params::osc3::unisonBlend);
 
     paramPointers.noiseEnable   = apvts.getRawParameterValue (params::noise::enable);
     paramPointers.noiseLevel    = apvts.getRawParameterValue (params::noise::level);
@@ -792,6 +792,8 @@ IndustrialEnergySynthAudioProcessor::IndustrialEnergySynthAudioProcessor()
     paramPointers.clipMix       = apvts.getRawParameterValue (params::destroy::clipMix);
 
     paramPointers.destroyOversample = apvts.getRawParameterValue (params::destroy::oversample);
+    paramPointers.foldAntiAlias     = apvts.getRawParameterValue (params::destroy::foldAntiAlias);
+    paramPointers.clipAntiAlias     = apvts.getRawParameterValue (params::destroy::clipAntiAlias);
 
     paramPointers.modMode       = apvts.getRawParameterValue (params::destroy::modMode);
     paramPointers.modAmount     = apvts.getRawParameterValue (params::destroy::modAmount);
@@ -810,6 +812,7 @@ IndustrialEnergySynthAudioProcessor::IndustrialEnergySynthAudioProcessor()
     paramPointers.shaperPlacement = apvts.getRawParameterValue (params::shaper::placement);
     paramPointers.shaperDriveDb   = apvts.getRawParameterValue (params::shaper::driveDb);
     paramPointers.shaperMix       = apvts.getRawParameterValue (params::shaper::mix);
+    paramPointers.shaperAntiAlias = apvts.getRawParameterValue (params::shaper::antiAlias);
     paramPointers.shaperPoints[0] = apvts.getRawParameterValue (params::shaper::point1);
     paramPointers.shaperPoints[1] = apvts.getRawParameterValue (params::shaper::point2);
     paramPointers.shaperPoints[2] = apvts.getRawParameterValue (params::shaper::point3);
@@ -834,6 +837,7 @@ IndustrialEnergySynthAudioProcessor::IndustrialEnergySynthAudioProcessor()
     paramPointers.toneHighCutHz  = apvts.getRawParameterValue (params::tone::highCutHz);
     paramPointers.toneLowCutSlope = apvts.getRawParameterValue (params::tone::lowCutSlope);
     paramPointers.toneHighCutSlope = apvts.getRawParameterValue (params::tone::highCutSlope);
+    paramPointers.tonePhaseMode = apvts.getRawParameterValue (params::tone::phaseMode);
 
     paramPointers.tonePeak1Enable = apvts.getRawParameterValue (params::tone::peak1Enable);
     paramPointers.tonePeak1Type   = apvts.getRawParameterValue (params::tone::peak1Type);
@@ -946,6 +950,8 @@ IndustrialEnergySynthAudioProcessor::IndustrialEnergySynthAudioProcessor()
         paramPointers.modSlotDst[(size_t) i]   = apvts.getRawParameterValue (slotDstIds[i]);
         paramPointers.modSlotDepth[(size_t) i] = apvts.getRawParameterValue (slotDepthIds[i]);
     }
+    paramPointers.modControlRate = apvts.getRawParameterValue (params::mod::controlRate);
+    paramPointers.modAudioRateFast = apvts.getRawParameterValue (params::mod::audioRateFast);
 
     // --- FX chain ---
     paramPointers.fxGlobalMix = apvts.getRawParameterValue (params::fx::global::mix);
@@ -1041,7 +1047,11 @@ IndustrialEnergySynthAudioProcessor::IndustrialEnergySynthAudioProcessor()
 
     engine.setParamPointers (&paramPointers);
 
+    for (int o = 0; o < 3; ++o)
+        engine.setCustomWavetableSource (o, &customWaveBuilder.getTables (o));
+
     loadCustomWavesFromState();
+    customWaveBuilder.start();
 }
 
 IndustrialEnergySynthAudioProcessor::~IndustrialEnergySynthAudioProcessor() = default;
@@ -1278,6 +1288,7 @@ void IndustrialEnergySynthAudioProcessor::changeProgramName (int index, const ju
 void IndustrialEnergySynthAudioProcessor::prepareToPlay (double sampleRate, int samplesPerBlock)
 {
     engine.prepare (sampleRate, samplesPerBlock);
+    setLatencySamples (engine.getLatencySamples());
     arp.prepare (sampleRate);
     uiPreDestroyScratch.resize ((size_t) juce::jmax (1, samplesPerBlock));
     std::fill (uiAudioRingPost.begin(), uiAudioRingPost.end(), 0.0f);
@@ -1290,9 +1301,6 @@ void IndustrialEnergySynthAudioProcessor::prepareToPlay (double sampleRate, int
     uiCpuRisk.store (0.0f, std::memory_order_relaxed);
     uiMidiReadIndex.store (0, std::memory_order_relaxed);
     uiMidiWriteIndex.store (0, std::memory_order_relaxed);
-
-    // Ensure engine uses the latest custom wavetable pointers after SR/buffer changes.
-    loadCustomWavesFromState();
 }
 
 void IndustrialEnergySynthAudioProcessor::releaseResources()
@@ -1342,6 +1350,9 @@ void IndustrialEnergySynthAudioProcessor::processBlock (juce::AudioBuffer<float>
     engine.setHostBpm (bpm);
     engine.setFxCustomOrder (getUiFxCustomOrder());
 
+    // Snapshot block-rate controls once; MIDI/arp segments below only run the audio loops.
+    engine.beginBlock();
+
     // Update Arp params (block-rate; no sample-accurate param switching in this version).
     const bool arpEnable = (arpParams.enable != nullptr && arpParams.enable->load() >= 0.5f);
     const bool arpLatch = (arpParams.latch != nullptr && arpParams.latch->load() >= 0.5f);
@@ -1365,7 +1376,9 @@ void IndustrialEnergySynthAudioProcessor::processBlock (juce::AudioBuffer<float>
     mergedMidi.addEvents (midiMessages, 0, totalSamples, 0);
     drainUiMidiToBuffer (mergedMidi);
 
-    const bool capturePre = (totalSamples > 0 && (int) uiPreDestroyScratch.size() >= totalSamples);
+    const bool uiMetering = uiEditorAttached.load (std::memory_order_relaxed);
+    engine.setFxMetersEnabled (uiMetering);
+    const bool capturePre = (uiMetering && totalSamples > 0 && (int) uiPreDestroyScratch.size() >= totalSamples);
     auto it = mergedMidi.begin();
     const auto end = mergedMidi.end();
 
@@ -1464,7 +1477,10 @@ void IndustrialEnergySynthAudioProcessor::processBlock (juce::AudioBuffer<float>
         }
     }
 
+    engine.endBlock();
+
     // UI metering (mono signal is duplicated to all channels).
+    if (uiMetering)
     {
         float peakOut = 0.0f;
         float peakPre = 0.0f;
@@ -1657,6 +1673,16 @@ IndustrialEnergySynthAudioProcessor::APVTS::ParameterLayout IndustrialEnergySynt
                                                                           "ms"));
     }
 
+    monoGroup->addChild (std::make_unique<juce::AudioParameterChoice> (params::makeID (params::mono::voiceMode),
+                                                                       "Voice Mode",
+                                                                       juce::StringArray { "Mono", "Poly" },
+                                                                       (int) params::mono::voiceMono));
+    monoGroup->addChild (std::make_unique<juce::AudioParameterInt> (params::makeID (params::mono::polyVoices), "Poly Voices", 2, 8, 8));
+    monoGroup->addChild (std::make_unique<juce::AudioParameterChoice> (params::makeID (params::mono::wtInterp),
+                                                                       "Wavetable Interp",
+                                                                       juce::StringArray { "Linear", "Cubic" },
+                                                                       (int) params::mono::wtLinear));
+
     layout.add (std::move (monoGroup));
 
     // --- Macros (modulation sources) ---
@@ -1723,7 +1749,7 @@ IndustrialEnergySynthAudioProcessor::APVTS::ParameterLayout IndustrialEnergySynt
     auto modGroup = std::make_unique<juce::AudioProcessorParameterGroup> ("mod", "Mod Matrix", "|");
     const auto modSrcChoices = juce::StringArray { "Off", "LFO 1", "LFO 2", "Macro 1", "Macro 2",
                                                    "Mod Wheel", "Aftertouch", "Velocity", "Note",
-                                                   "Filter Env", "Amp Env", "Random", "MSEG" };
+                                                   "Filter Env", "Amp Env", "Random", "MSEG", "Drift" };
     const auto modDstChoices = juce::StringArray {
         "Off", "Osc1 Level", "Osc2 Level", "Osc3 Level", "Filter Cutoff", "Filter Reso",
         "Fold Amount", "Clip Amount", "Mod Amount", "Crush Mix",
@@ -1766,6 +1792,12 @@ IndustrialEnergySynthAudioProcessor::APVTS::ParameterLayout IndustrialEnergySynt
     addModSlot (params::mod::slot7Src, params::mod::slot7Dst, params::mod::slot7Depth, 7);
     addModSlot (params::mod::slot8Src, params::mod::slot8Dst, params::mod::slot8Depth, 8);
 
+    // Matrix evaluation rate: routes run every N samples and are linearly interpolated in between.
+    modGroup->addChild (std::make_unique<juce::AudioParameterChoice> (params::makeID (params::mod::controlRate), "Control Rate",
+                                                                      juce::StringArray { "Audio", "8 Samples", "16 Samples", "32 Samples" },
+                                                                      (int) params::mod::rate16));
+    modGroup->addChild (std::make_unique<juce::AudioParameterBool> (params::makeID (params::mod::audioRateFast), "Audio-Rate Cutoff/Level", false));
+
     layout.add (std::move (modGroup));
 
     // --- Oscillators ---
@@ -1788,6 +1820,13 @@ IndustrialEnergySynthAudioProcessor::APVTS::ParameterLayout IndustrialEnergySynt
                                                                       juce::NormalisableRange<float> (0.0f, 1.0f), 0.0f));
     osc1Group->addChild (std::make_unique<juce::AudioParameterFloat> (params::makeID (params::osc1::detune), "Detune (Unstable)",
                                                                       juce::NormalisableRange<float> (0.0f, 1.0f), 0.0f));
+    osc1Group->addChild (std::make_unique<juce::AudioParameterInt> (params::makeID (params::osc1::unison), "Unison", 1, 16, 1));
+    osc1Group->addChild (std::make_unique<juce::AudioParameterFloat> (params::makeID (params::osc1::unisonDetune), "Unison Detune",
+                                                                      juce::NormalisableRange<float> (0.0f, 1.0f), 0.25f));
+    osc1Group->addChild (std::make_unique<juce::AudioParameterFloat> (params::makeID (params::osc1::unisonSpread), "Unison Spread",
+                                                                      juce::NormalisableRange<float> (0.0f, 1.0f), 1.0f));
+    osc1Group->addChild (std::make_unique<juce::AudioParameterFloat> (params::makeID (params::osc1::unisonBlend), "Unison Blend",
+                                                                      juce::NormalisableRange<float> (0.0f, 1.0f), 0.75f));
     layout.add (std::move (osc1Group));
 
     auto osc2Group = std::make_unique<juce::AudioProcessorParameterGroup> ("osc2", "Osc 2", "|");
@@ -1801,6 +1840,13 @@ IndustrialEnergySynthAudioProcessor::APVTS::ParameterLayout IndustrialEnergySynt
                                                                       juce::NormalisableRange<float> (0.0f, 1.0f), 0.0f));
     osc2Group->addChild (std::make_unique<juce::AudioParameterFloat> (params::makeID (params::osc2::detune), "Detune (Unstable)",
                                                                       juce::NormalisableRange<float> (0.0f, 1.0f), 0.0f));
+    osc2Group->addChild (std::make_unique<juce::AudioParameterInt> (params::makeID (params::osc2::unison), "Unison", 1, 16, 1));
+    osc2Group->addChild (std::make_unique<juce::AudioParameterFloat> (params::makeID (params::osc2::unisonDetune), "Unison Detune",
+                                                                      juce::NormalisableRange<float> (0.0f, 1.0f), 0.25f));
+    osc2Group->addChild (std::make_unique<juce::AudioParameterFloat> (params::makeID (params::osc2::unisonSpread), "Unison Spread",
+                                                                      juce::NormalisableRange<float> (0.0f, 1.0f), 1.0f));
+    osc2Group->addChild (std::make_unique<juce::AudioParameterFloat> (params::makeID (params::osc2::unisonBlend), "Unison Blend",
+                                                                      juce::NormalisableRange<float> (0.0f, 1.0f), 0.75f));
     osc2Group->addChild (std::make_unique<juce::AudioParameterBool> (params::makeID (params::osc2::sync), "Sync to Osc1", false));
     layout.add (std::move (osc2Group));
 
@@ -1815,6 +1861,13 @@ IndustrialEnergySynthAudioProcessor::APVTS::ParameterLayout IndustrialEnergySynt
                                                                       juce::NormalisableRange<float> (0.0f, 1.0f), 0.0f));
     osc3Group->addChild (std::make_unique<juce::AudioParameterFloat> (params::makeID (params::osc3::detune), "Detune (Unstable)",
                                                                       juce::NormalisableRange<float> (0.0f, 1.0f), 0.0f));
+    osc3Group->addChild (std::make_unique<juce::AudioParameterInt> (params::makeID (params::osc3::unison), "Unison", 1, 16, 1));
+    osc3Group->addChild (std::make_unique<juce::AudioParameterFloat> (params::makeID (params::osc3::unisonDetune), "Unison Detune",
+                                                                      juce::NormalisableRange<float> (0.0f, 1.0f), 0.25f));
+    osc3Group->addChild (std::make_unique<juce::AudioParameterFloat> (params::makeID (params::osc3::unisonSpread), "Unison Spread",
+                                                                      juce::NormalisableRange<float> (0.0f, 1.0f), 1.0f));
+    osc3Group->addChild (std::make_unique<juce::AudioParameterFloat> (params::makeID (params::osc3::unisonBlend), "Unison Blend",
+                                                                      juce::NormalisableRange<float> (0.0f, 1.0f), 0.75f));
     layout.add (std::move (osc3Group));
 
     // --- Noise (Serum-ish helper oscillator) ---
@@ -1830,7 +1883,7 @@ IndustrialEnergySynthAudioProcessor::APVTS::ParameterLayout IndustrialEnergySynt
     auto destroyGroup = std::make_unique<juce::AudioProcessorParameterGroup> ("destroy", "Destroy", "|");
     destroyGroup->addChild (std::make_unique<juce::AudioParameterChoice> (params::makeID (params::destroy::oversample),
                                                                           "Oversampling",
-                                                                          juce::StringArray { "Off", "2x", "4x" },
+                                                                          juce::StringArray { "Off", "2x", "4x", "Auto" },
                                                                           (int) params::destroy::osOff));
     destroyGroup->addChild (std::make_unique<juce::AudioParameterFloat> (params::makeID (params::destroy::foldDriveDb), "Fold Drive",
                                                                          juce::NormalisableRange<float> (-12.0f, 36.0f), 0.0f, "dB"));
@@ -1838,6 +1891,9 @@ IndustrialEnergySynthAudioProcessor::APVTS::ParameterLayout IndustrialEnergySynt
                                                                          juce::NormalisableRange<float> (0.0f, 1.0f), 0.0f));
     destroyGroup->addChild (std::make_unique<juce::AudioParameterFloat> (params::makeID (params::destroy::foldMix), "Fold Mix",
                                                                          juce::NormalisableRange<float> (0.0f, 1.0f), 1.0f));
+    destroyGroup->addChild (std::make_unique<juce::AudioParameterChoice> (params::makeID (params::destroy::foldAntiAlias), "Fold Anti-Alias",
+                                                                          juce::StringArray { "Off", "ADAA 1", "ADAA 2" },
+                                                                          (int) params::destroy::aaOff));
 
     destroyGroup->addChild (std::make_unique<juce::AudioParameterFloat> (params::makeID (params::destroy::clipDriveDb), "Clip Drive",
                                                                          juce::NormalisableRange<float> (-12.0f, 36.0f), 0.0f, "dB"));
@@ -1845,6 +1901,9 @@ IndustrialEnergySynthAudioProcessor::APVTS::ParameterLayout IndustrialEnergySynt
                                                                          juce::NormalisableRange<float> (0.0f, 1.0f), 0.0f));
     destroyGroup->addChild (std::make_unique<juce::AudioParameterFloat> (params::makeID (params::destroy::clipMix), "Clip Mix",
                                                                          juce::NormalisableRange<float> (0.0f, 1.0f), 1.0f));
+    destroyGroup->addChild (std::make_unique<juce::AudioParameterChoice> (params::makeID (params::destroy::clipAntiAlias), "Clip Anti-Alias",
+                                                                          juce::StringArray { "Off", "ADAA 1", "ADAA 2" },
+                                                                          (int) params::destroy::aaOff));
 
     destroyGroup->addChild (std::make_unique<juce::AudioParameterChoice> (params::makeID (params::destroy::modMode), "Mod Mode",
                                                                           juce::StringArray { "RingMod", "FM" },
@@ -1883,6 +1942,9 @@ IndustrialEnergySynthAudioProcessor::APVTS::ParameterLayout IndustrialEnergySynt
                                                                         juce::NormalisableRange<float> (-24.0f, 24.0f), 0.0f, "dB"));
     shaperGroup->addChild (std::make_unique<juce::AudioParameterFloat> (params::makeID (params::shaper::mix), "Mix",
                                                                         juce::NormalisableRange<float> (0.0f, 1.0f), 1.0f));
+    shaperGroup->addChild (std::make_unique<juce::AudioParameterChoice> (params::makeID (params::shaper::antiAlias), "Anti-Alias",
+                                                                         juce::StringArray { "Off", "ADAA 1", "ADAA 2" },
+                                                                         (int) params::destroy::aaOff));
 
     auto addShaperPoint = [&] (const char* id, const char* name, float def)
     {
@@ -1967,6 +2029,10 @@ IndustrialEnergySynthAudioProcessor::APVTS::ParameterLayout IndustrialEnergySynt
                                                                        "High Cut Slope",
                                                                        juce::StringArray { "12 dB/oct", "24 dB/oct", "36 dB/oct", "48 dB/oct" },
                                                                        (int) params::tone::slope24));
+    toneGroup->addChild (std::make_unique<juce::AudioParameterChoice> (params::makeID (params::tone::phaseMode),
+                                                                       "Phase",
+                                                                       juce::StringArray { "Minimum", "Linear" },
+                                                                       (int) params::tone::phaseMinimum));
 
     const auto peakTypeChoices = juce::StringArray { "Bell", "Notch", "Low Shelf", "High Shelf", "Band Pass" };
     auto addPeak = [&] (const char* idEnable, const char* idType,
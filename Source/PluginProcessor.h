@@ -48,6 +48,8 @@ public:
     void setUiFxCustomOrder (const std::array<int, (size_t) ies::dsp::FxChain::numBlocks>& order) noexcept;
     std::array<int, (size_t) ies::dsp::FxChain::numBlocks> getUiFxCustomOrder() const noexcept;
     void requestPanic() noexcept { uiPanicRequested.store (true, std::memory_order_release); }
+    // The editor registers itself so UI metering only runs while something can display it.
+    void setUiEditorAttached (bool attached) noexcept { uiEditorAttached.store (attached, std::memory_order_relaxed); }
     void enqueueUiNoteOn (int midiNoteNumber, int velocity) noexcept;
     void enqueueUiNoteOff (int midiNoteNumber) noexcept;
     void enqueueUiAllNotesOff() noexcept;
@@ -60,7 +62,9 @@ public:
     // Wavetable drawing support (Serum-ish): 10 templates + per-osc custom "Draw" waveform.
     static constexpr int waveTableNumTemplates = 10;
     static constexpr int waveDrawNumPoints = 128;
+    // Templates only (wave index 3..12); Draw tables live on the builder thread, use getCustomWavePointsForUi.
     const ies::dsp::WavetableSet* getWavetableForUi (int oscIndex, int waveIndex) const noexcept;
+    void getCustomWavePointsForUi (int oscIndex, float* dest, int numPoints) const noexcept;
     void setCustomWaveFromUi (int oscIndex, const float* points, int numPoints);
 
     void prepareToPlay (double sampleRate, int samplesPerBlock) override;
@@ -215,6 +219,7 @@ private:
     std::atomic<float> uiOutClipRisk { 0.0f };
     std::atomic<float> uiCpuRisk { 0.0f };
     std::atomic<bool> uiPanicRequested { false };
+    std::atomic<bool> uiEditorAttached { false };
     std::array<std::atomic<int>, (size_t) ies::dsp::FxChain::numBlocks> uiFxCustomOrder
     { { 0, 1, 2, 3, 4, 5 } };
 
@@ -234,10 +239,9 @@ private:
     struct CustomWaveBank final
     {
         std::array<std::array<float, (size_t) IndustrialEnergySynthAudioProcessor::waveDrawNumPoints>, 3> points {};
-        std::array<std::array<ies::dsp::WavetableSet, 2>, 3> tableDoubleBuffer {};
-        std::array<std::atomic<int>, 3> activeIndex { { 0, 0, 0 } };
     };
     CustomWaveBank customWaves;
+    ies::engine::WavetableBuilder customWaveBuilder;
     void initWavetableTemplates();
     void loadCustomWavesFromState();
     void storeCustomWavePointsToState (int oscIndex, const float* points, int numPoints);
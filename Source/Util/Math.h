@@ -1,6 +1,8 @@
 #pragma once
 
 #include <cmath>
+#include <cstdint>
+#include <cstring>
 
 namespace ies::math
 {
@@ -23,5 +25,90 @@ inline float wrap01 (float x) noexcept
     if (x < 0.0f) x += 1.0f;
     return x;
 }
+
+// 2^x via a 32-entry table of 2^(k/32) plus a cubic for the remainder (relative error < 2e-7, far below a cent).
+// Input is clamped to the normal float exponent range.
+inline float fastExp2 (float x) noexcept
+{
+    static constexpr float table[32] =
+    {
+        1.000000000f, 1.021897149f, 1.044273782f, 1.067140401f,
+        1.090507733f, 1.114386743f, 1.138788635f, 1.163724859f,
+        1.189207115f, 1.215247360f, 1.241857812f, 1.269050957f,
+        1.296839555f, 1.325236643f, 1.354255547f, 1.383909882f,
+        1.414213562f, 1.445180807f, 1.476826146f, 1.509164428f,
+        1.542210825f, 1.575980845f, 1.610490332f, 1.645755478f,
+        1.681792831f, 1.718619298f, 1.756252160f, 1.794709075f,
+        1.834008086f, 1.874167634f, 1.915206561f, 1.957144124f,
+    };
+
+    if (! (x > -126.0f)) x = -126.0f; // also catches NaN
+    if (x > 126.0f) x = 126.0f;
+
+    int xi = (int) x;
+    if ((float) xi > x)
+        --xi;
+
+    const float scaled = (x - (float) xi) * 32.0f; // [0, 32)
+    int k = (int) scaled;
+    if (k > 31) k = 31;
+    const float r = (scaled - (float) k) * (1.0f / 32.0f); // [0, 1/32)
+
+    constexpr float c1 = 0.693147181f;  // ln2
+    constexpr float c2 = 0.240226507f;  // ln2^2 / 2
+    constexpr float c3 = 0.0555041087f; // ln2^3 / 6
+    const float frac = table[k] * (1.0f + r * (c1 + r * (c2 + r * c3)));
+
+    const auto bits = (std::uint32_t) (xi + 127) << 23;
+    float scale;
+    std::memcpy (&scale, &bits, sizeof (scale));
+    return frac * scale;
+}
+
+// log2(x) for x > 0 from the exponent bits plus an atanh series on the mantissa (absolute error < 3e-4).
+// Non-positive and non-finite inputs are not handled; callers clamp.
+inline float fastLog2 (float x) noexcept
+{
+    std::uint32_t bits;
+    std::memcpy (&bits, &x, sizeof (bits));
+    const auto exponent = (float) ((int) ((bits >> 23) & 255u) - 127);
+
+    bits = (bits & 0x007fffffu) | 0x3f800000u;
+    float m;
+    std::memcpy (&m, &bits, sizeof (m)); // [1, 2)
+
+    // log2(m) = 2/ln2 * atanh(t), t = (m - 1) / (m + 1) in [0, 1/3).
+    const float t = (m - 1.0f) / (m + 1.0f);
+    const float t2 = t * t;
+    return exponent + t * (2.885390082f + t2 * (0.961796694f + t2 * 0.577078016f));
+}
+
+// sin (2 pi x) for any x (|x| < 2^31): wrap to [-0.5, 0.5), reflect into [-0.25, 0.25], odd 9th-order Taylor
+// (absolute error < 4e-6).
+inline float fastSin2Pi (float x) noexcept
+{
+    auto r = x - std::floor (x + 0.5f);
+    r = r > 0.25f ? 0.5f - r : (r < -0.25f ? -0.5f - r : r);
+
+    const float z = r * 6.283185307f;
+    const float z2 = z * z;
+    return z * (1.0f + z2 * (-1.666666667e-1f + z2 * (8.333333333e-3f + z2 * (-1.984126984e-4f + z2 * 2.755731922e-6f))));
+}
+
+// tan (pi x) for x in [0, 0.45] (filter prewarping, x = fc / sr) from the [7/6] Pade approximant of tan
+// (relative error < 4e-9 in that range, so float rounding dominates). Not valid near the pole at x = 0.5.
+inline float fastTanPi (float x) noexcept
+{
+    const float z = x * 3.141592654f;
+    const float z2 = z * z;
+    const float num = z * (135135.0f + z2 * (-17325.0f + z2 * (378.0f - z2)));
+    const float den = 135135.0f + z2 * (-62370.0f + z2 * (3150.0f - 28.0f * z2));
+    return num / den;
+}
+
+inline float midiNoteToHzFast (float note) noexcept
+{
+    return 440.0f * fastExp2 ((note - 69.0f) * (1.0f / 12.0f));
+}
 } // namespace ies::math
 
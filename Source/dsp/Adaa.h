@@ -0,0 +1,151 @@
+#pragma once
+
+#include <cmath>
+
+namespace ies::dsp
+{
+// Antiderivative anti-aliasing for a memoryless nonlinearity (Parker et al. / Bilbao et al.).
+// Shape provides f, its first antiderivative F1 and second antiderivative F2, all in double: the divided
+// differences cancel badly in float. First order lags by half a sample, second order by one (see AdaaDryDelay).
+template <typename Shape>
+class Adaa final
+{
+public:
+    void reset() noexcept
+    {
+        x1 = x2 = 0.0;
+        d1Prev = 0.0;
+        lastOrder = 0;
+    }
+
+    // Call when the shape's antiderivatives change (e.g. an edited curve). The input history stays, but the
+    // second-order divided difference is re-derived from it with the new shape on the next sample.
+    void shapeChanged() noexcept { lastOrder = 0; }
+
+    // order 1 or 2.
+    float process (float xIn, int order, const Shape& s) noexcept
+    {
+        const auto x0 = (double) xIn;
+        double y = 0.0;
+
+        if (order >= 2)
+        {
+            // Re-derive the previous divided difference when coming from first order (or a reset).
+            if (lastOrder != 2)
+                d1Prev = divided1 (x1, x2, s);
+
+            const auto d1 = divided1 (x0, x1, s);
+
+            if (std::abs (x0 - x2) < eps)
+            {
+                const auto xBar = 0.5 * (x0 + x2);
+                const auto delta = xBar - x1;
+                y = std::abs (delta) < eps ? s.f (0.5 * (xBar + x1))
+                                           : (2.0 / delta) * (s.F1 (xBar) + (s.F2 (x1) - s.F2 (xBar)) / delta);
+            }
+            else
+            {
+                y = 2.0 * (d1 - d1Prev) / (x0 - x2);
+            }
+
+            d1Prev = d1;
+            lastOrder = 2;
+        }
+        else
+        {
+            const auto dx = x0 - x1;
+            y = std::abs (dx) < eps ? s.f (0.5 * (x0 + x1)) : (s.F1 (x0) - s.F1 (x1)) / dx;
+            lastOrder = 1;
+        }
+
+        x2 = x1;
+        x1 = x0;
+        return (float) y;
+    }
+
+private:
+    static constexpr double eps = 1.0e-5;
+
+    // (F2(a) - F2(b)) / (a - b), i.e. the first-order ADAA of F1.
+    static double divided1 (double a, double b, const Shape& s) noexcept
+    {
+        const auto d = a - b;
+        return std::abs (d) < eps ? s.F1 (0.5 * (a + b)) : (s.F2 (a) - s.F2 (b)) / d;
+    }
+
+    double x1 = 0.0;
+    double x2 = 0.0;
+    double d1Prev = 0.0;
+    int lastOrder = 0;
+};
+
+// Delays the dry signal like Adaa delays the wet one (half a sample by averaging, or one sample), so that
+// partial wet/dry mixes don't comb.
+struct AdaaDryDelay final
+{
+    void reset() noexcept { x1 = 0.0f; }
+
+    float process (float x, int order) noexcept
+    {
+        const auto out = order >= 2 ? x1 : 0.5f * (x + x1);
+        x1 = x;
+        return out;
+    }
+
+    float x1 = 0.0f;
+};
+
+// Hard clip to [-1, 1].
+struct HardClipShape final
+{
+    double f (double x) const noexcept { return x > 1.0 ? 1.0 : (x < -1.0 ? -1.0 : x); }
+
+    double F1 (double x) const noexcept
+    {
+        const auto a = std::abs (x);
+        return a <= 1.0 ? 0.5 * x * x : a - 0.5;
+    }
+
+    double F2 (double x) const noexcept
+    {
+        if (std::abs (x) <= 1.0)
+            return x * x * x / 6.0;
+
+        const auto sign = x > 0.0 ? 1.0 : -1.0;
+        return sign * (0.5 * x * x + 1.0 / 6.0) - 0.5 * x;
+    }
+};
+
+// Triangle wavefold of period 4 that is the identity on [-1, 1]. It has zero mean, and so does its first
+// antiderivative, so both antiderivatives are periodic and stay bounded however hard the fold is driven.
+struct TriangleFoldShape final
+{
+    static double wrap (double x) noexcept
+    {
+        const auto w = x + 1.0;
+        return w - 4.0 * std::floor (w * 0.25); // [0, 4)
+    }
+
+    double f (double x) const noexcept
+    {
+        return 1.0 - std::abs (wrap (x) - 2.0);
+    }
+
+    double F1 (double x) const noexcept
+    {
+        const auto w = wrap (x);
+        return w < 2.0 ? 0.5 * w * w - w
+                       : 3.0 * (w - 2.0) - 0.5 * (w * w - 4.0);
+    }
+
+    double F2 (double x) const noexcept
+    {
+        const auto w = wrap (x);
+        if (w < 2.0)
+            return w * w * w / 6.0 - 0.5 * w * w;
+
+        const auto d = w - 2.0;
+        return 1.5 * d * d - w * w * w / 6.0 + 2.0 * w - 10.0 / 3.0;
+    }
+};
+} // namespace ies::dsp
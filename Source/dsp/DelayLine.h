@@ -0,0 +1,147 @@
+#pragma once
+
+#include <JuceHeader.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace ies::dsp
+{
+// Mono ring buffer with a power-of-two size, so every index wraps with one mask.
+//
+// Delays are measured from the next write: read (1) returns the most recent push. Interpolation is picked per
+// read:
+// - linear: cheapest, but dulls the highs while the delay moves.
+// - lagrange3: 4-point, third-order Lagrange. Much flatter for modulated taps (chorus, flanger).
+// - allpass: first-order allpass. Its magnitude is flat, so it suits feedback loops where every repeat would
+//   otherwise lose more top end. It keeps state, so a line has one allpass tap, and only for a static delay: a
+//   moving one modulates the phase response (and jumps where frac crosses 0.5). Call resetAllpass() whenever the
+//   tap starts reading after the delay moved.
+// The block calls write a run of samples first and then read taps relative to each of those samples. That only
+// works for lines without feedback inside the block.
+class DelayLine final
+{
+public:
+    enum class Interpolation
+    {
+        linear,
+        lagrange3,
+        allpass
+    };
+
+    // Allocates room for maxDelaySamples plus maxBlockSize (for block reads) and the interpolation taps.
+    void prepare (int maxDelaySamples, int maxBlockSize = 0)
+    {
+        const auto needed = juce::jmax (1, maxDelaySamples) + juce::jmax (0, maxBlockSize) + 4;
+        buffer.assign ((size_t) juce::nextPowerOfTwo (needed), 0.0f);
+        mask = (int) buffer.size() - 1;
+        maxDelay = juce::jmax (1, maxDelaySamples);
+        reset();
+    }
+
+    void reset() noexcept
+    {
+        std::fill (buffer.begin(), buffer.end(), 0.0f);
+        writePos = 0;
+        allpassState = 0.0f;
+    }
+
+    // Restarts the allpass tap. previousOutput is the tap's last output if it had been reading all along (e.g. the
+    // previous Lagrange read at the same delay), which avoids a start-up transient.
+    void resetAllpass (float previousOutput = 0.0f) noexcept { allpassState = previousOutput; }
+
+    bool isPrepared() const noexcept { return ! buffer.empty(); }
+    int getMaxDelaySamples() const noexcept { return maxDelay; }
+
+    void push (float x) noexcept
+    {
+        buffer[(size_t) writePos] = x;
+        writePos = (writePos + 1) & mask;
+    }
+
+    // Delay in samples, clamped to [1 (2 for lagrange3), maxDelaySamples].
+    template <Interpolation mode>
+    float read (float delaySamples) noexcept
+    {
+        return readAt<mode> (writePos, juce::jlimit (minDelay<mode>(), (float) maxDelay, delaySamples));
+    }
+
+    void writeBlock (const float* x, int numSamples) noexcept
+    {
+        for (int i = 0; i < numSamples; ++i)
+        {
+            buffer[(size_t) writePos] = x[i];
+            writePos = (writePos + 1) & mask;
+        }
+    }
+
+    // After writeBlock (numSamples): out[i] is the block's sample i delayed by delaySamples (0 passes it through),
+    // clamped to [0 (1 for lagrange3), maxDelaySamples].
+    template <Interpolation mode>
+    void readBlock (float* out, int numSamples, float delaySamples) noexcept
+    {
+        // Position of the "next write" just after block sample 0 went in; one extra sample of delay from there.
+        const auto start = writePos - numSamples + 1;
+        const auto d = juce::jlimit (minDelay<mode>() - 1.0f, (float) maxDelay, delaySamples) + 1.0f;
+        for (int i = 0; i < numSamples; ++i)
+            out[i] = readAt<mode> (start + i, d);
+    }
+
+private:
+    template <Interpolation mode>
+    static constexpr float minDelay() noexcept { return mode == Interpolation::lagrange3 ? 2.0f : 1.0f; }
+
+    // d is already clamped; at most maxDelaySamples + 1 (block reads), which the buffer has room for.
+    template <Interpolation mode>
+    float readAt (int position, float d) noexcept
+    {
+        const auto whole = (int) d;
+        const auto frac = d - (float) whole;
+        const auto at = [this, position] (int delay) noexcept { return buffer[(size_t) ((position - delay) & mask)]; };
+
+        if constexpr (mode == Interpolation::linear)
+        {
+            const auto a = at (whole);
+            return a + frac * (at (whole + 1) - a);
+        }
+        else if constexpr (mode == Interpolation::lagrange3)
+        {
+            // Taps at whole - 1 .. whole + 2, i.e. fractional positions -1 .. 2 around frac.
+            const auto ym1 = at (whole - 1);
+            const auto y0 = at (whole);
+            const auto y1 = at (whole + 1);
+            const auto y2 = at (whole + 2);
+            const auto fm1 = frac + 1.0f;
+            const auto f1 = frac - 1.0f;
+            const auto f2 = frac - 2.0f;
+            return -frac * f1 * f2 * (1.0f / 6.0f) * ym1
+                 + fm1 * f1 * f2 * 0.5f * y0
+                 - fm1 * frac * f2 * 0.5f * y1
+                 + fm1 * frac * f1 * (1.0f / 6.0f) * y2;
+        }
+        else
+        {
+            // (eta + z^-1) / (1 + eta z^-1) delays low frequencies by frac samples. Keeping frac in [0.5, 1.5)
+            // keeps eta away from -1, where the pole would sit on the unit circle.
+            auto w = whole;
+            auto f = frac;
+            if (f < 0.5f && w > 1)
+            {
+                --w;
+                f += 1.0f;
+            }
+            const auto eta = (1.0f - f) / (1.0f + f);
+            const auto y = eta * at (w) + at (w + 1) - eta * allpassState;
+            allpassState = y;
+            return y;
+        }
+    }
+
+    std::vector<float> buffer;
+    int mask = 0;
+    int writePos = 0;
+    int maxDelay = 1;
+    float allpassState = 0.0f;
+};
+} // namespace ies::dsp
@@ -2,16 +2,44 @@
 
 #include <JuceHeader.h>
 
+#include <vector>
+
 #include "../Params.h"
+#include "../Util/Math.h"
+#include "Adaa.h"
+#include "SimdVec.h"
 
 namespace ies::dsp
 {
+// Fold -> clip -> ring/FM at the chain's (possibly oversampled) rate, plus the bitcrusher at base rate.
+// Block API: per-sample inputs come in at base rate and each one covers `factor` samples of the block.
 class DestroyChain final
 {
 public:
-    void prepare (double sampleRate)
+    // Per-sample inputs at base rate. Drives are linear gains (convert from dB only while they ramp).
+    struct BlockInputs
+    {
+        const float* noteHz = nullptr;
+        const float* foldDrive = nullptr;
+        const float* foldAmount = nullptr;
+        const float* foldMix = nullptr;
+        const float* clipDrive = nullptr;
+        const float* clipAmount = nullptr;
+        const float* clipMix = nullptr;
+        const float* modAmount = nullptr;
+        const float* modMix = nullptr;
+        const float* modFreqHz = nullptr;
+        int modMode = (int) params::destroy::ringMod;
+        bool modNoteSync = false;
+        int foldAntiAlias = (int) params::destroy::aaOff;
+        int clipAntiAlias = (int) params::destroy::aaOff;
+    };
+
+    // maxBlockSize is at this chain's rate (base block size times the oversampling factor).
+    void prepare (double sampleRate, int maxBlockSize)
     {
         sr = (sampleRate > 0.0) ? sampleRate : 44100.0;
+        modPhases.assign ((size_t) juce::jmax (1, maxBlockSize), 0.0f);
         reset();
     }
 
@@ -20,152 +48,307 @@ public:
         modPhase01 = 0.0f;
         crushCounter = 0;
         crushHeld = 0.0f;
+        foldAdaa.reset();
+        clipAdaa.reset();
+        foldDry.reset();
+        clipDry.reset();
     }
 
-    float processSamplePreCrush (float x,
-                                 float noteHz,
-                                 float foldDriveDb, float foldAmount, float foldMix,
-                                 float clipDriveDb, float clipAmount, float clipMix,
-                                 int modMode, float modAmount, float modMix, bool modNoteSync, float modFreqHz) noexcept
+    // x holds numBaseSamples * factor samples (factor 1, 2, 4 or 8); input i applies to x[i * factor .. (i + 1) * factor).
+    void processBlockPreCrush (float* x, int numBaseSamples, int factor, const BlockInputs& in) noexcept
     {
-        x = waveFoldStage (x, foldDriveDb, foldAmount, foldMix);
-        x = hardClipStage (x, clipDriveDb, clipAmount, clipMix);
-        x = modStage (x, noteHz, modMode, modAmount, modMix, modNoteSync, modFreqHz);
-        return x;
+        if (x == nullptr || numBaseSamples <= 0)
+            return;
+
+        switch (factor)
+        {
+            case 2:  processPreCrush<2> (x, numBaseSamples, in); break;
+            case 4:  processPreCrush<4> (x, numBaseSamples, in); break;
+            case 8:  processPreCrush<8> (x, numBaseSamples, in); break;
+            default: processPreCrush<1> (x, numBaseSamples, in); break;
+        }
     }
 
-    float processSampleCrush (float x,
-                              int crushBits, int crushDownsample, float crushMix) noexcept
+    // Lets a chain that takes over from another (oversampling switch) continue its ring/FM phasor in phase.
+    void copyModPhaseFrom (const DestroyChain& other) noexcept { modPhase01 = other.modPhase01; }
+
+    // Rough upper edge of the spectrum the pre-crush stages produce for input i: the significant partials of the
+    // highest sounding oscillator (sourceHz) times the harmonic reach of fold and clip, widened by ring/FM. Used to
+    // pick an oversampling factor; a stage running ADAA already suppresses most of its own aliasing, so its reach
+    // counts for less.
+    static float estimateBandwidthHz (const BlockInputs& in, int i, float sourceHz) noexcept
     {
-        return crushStage (x, crushBits, crushDownsample, crushMix);
+        constexpr float sourcePartials = 8.0f;
+        constexpr float maxReach = 64.0f;
+
+        const auto c = shapeCoeffsAt (in, i);
+        const auto clipOverdrive = c.clipGain * c.clipInvThreshold;
+
+        auto adaaWeight = [] (int order) noexcept { return order >= 2 ? 0.25f : (order == 1 ? 0.5f : 1.0f); };
+
+        auto reach = 1.0f;
+        reach += 2.0f * juce::jmax (0.0f, c.foldGain - 1.0f) * c.foldMix * adaaWeight (in.foldAntiAlias);
+        reach += 2.0f * juce::jmax (0.0f, clipOverdrive - 1.0f) * c.clipMix * adaaWeight (in.clipAntiAlias);
+
+        auto bw = juce::jmax (0.0f, sourceHz) * sourcePartials * juce::jmin (reach, maxReach);
+
+        const auto a = juce::jlimit (0.0f, 1.0f, in.modAmount[i]);
+        const auto mix = juce::jlimit (0.0f, 1.0f, in.modMix[i]);
+        const auto modHz = juce::jlimit (0.0f, 20000.0f, in.modNoteSync ? in.noteHz[i] : in.modFreqHz[i]);
+        if (in.modMode == (int) params::destroy::fm)
+            bw += mix * (10.0f * a * bw + modHz); // Carson: (index + 1) * bandwidth + carrier
+        else
+            bw += mix * a * modHz;
+
+        return bw;
     }
 
-    float processSample (float x,
-                         float noteHz,
-                         float foldDriveDb, float foldAmount, float foldMix,
-                         float clipDriveDb, float clipAmount, float clipMix,
-                         int modMode, float modAmount, float modMix, bool modNoteSync, float modFreqHz,
-                         int crushBits, int crushDownsample, float crushMix) noexcept
+    void processBlockCrush (float* x, int numSamples, int crushBits, int crushDownsample, const float* crushMix) noexcept
     {
-        x = processSamplePreCrush (x,
-                                   noteHz,
-                                   foldDriveDb, foldAmount, foldMix,
-                                   clipDriveDb, clipAmount, clipMix,
-                                   modMode, modAmount, modMix, modNoteSync, modFreqHz);
-        x = processSampleCrush (x, crushBits, crushDownsample, crushMix);
-        return x;
+        const auto ds = juce::jlimit (1, 32, crushDownsample);
+        const auto b = juce::jlimit (2, 16, crushBits);
+        const auto maxInt = (float) ((1 << (b - 1)) - 1);
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            if (crushCounter <= 0)
+            {
+                crushHeld = std::round (juce::jlimit (-1.0f, 1.0f, x[i]) * maxInt) / maxInt;
+                crushCounter = ds - 1;
+            }
+            else
+            {
+                --crushCounter;
+            }
+
+            x[i] = lerp (x[i], crushHeld, juce::jlimit (0.0f, 1.0f, crushMix[i]));
+        }
     }
 
 private:
+    using Vec = simd::Vec4;
+
     static float lerp (float a, float b, float t) noexcept
     {
         return a + (b - a) * t;
     }
 
+    // Symmetric wavefold into [-1, 1] without branches: a triangle of period 4 that is the identity on [-1, 1].
     static float fold (float x) noexcept
     {
-        // Symmetric wavefold into [-1, 1]. For |x|<=1 it returns x.
-        if (x >= -1.0f && x <= 1.0f)
-            return x;
-
-        auto t = std::fmod (x + 1.0f, 4.0f);
-        if (t < 0.0f) t += 4.0f;
-        t = (t < 2.0f) ? t : (4.0f - t);
-        return t - 1.0f;
+        const auto t = x + 1.0f;
+        const auto w = t - 4.0f * std::floor (t * 0.25f);
+        return 1.0f - std::abs (w - 2.0f);
     }
 
-    float waveFoldStage (float x, float driveDb, float amount, float mix) const noexcept
+    static Vec::T fold (Vec::T x) noexcept
     {
-        const auto dry = x;
-
-        // Amount controls additional pre-gain into the folding function.
-        const auto drive = juce::Decibels::decibelsToGain (driveDb, -100.0f);
-        const auto pregain = drive * (1.0f + juce::jlimit (0.0f, 1.0f, amount) * 10.0f);
-
-        const auto wet = fold (x * pregain);
-        return lerp (dry, wet, juce::jlimit (0.0f, 1.0f, mix));
+        const auto t = Vec::add (x, Vec::set (1.0f));
+        const auto w = Vec::sub (t, Vec::mul (Vec::set (4.0f), Vec::floor (Vec::mul (t, Vec::set (0.25f)))));
+        return Vec::sub (Vec::set (1.0f), Vec::abs (Vec::sub (w, Vec::set (2.0f))));
     }
 
-    float hardClipStage (float x, float driveDb, float amount, float mix) const noexcept
+    // Fold/clip coefficients derived from one base-rate input sample.
+    struct ShapeCoeffs
     {
-        const auto dry = x;
-
-        const auto drive = juce::Decibels::decibelsToGain (driveDb, -100.0f);
-
-        // Amount reduces the clip threshold, increasing distortion at constant input.
-        const auto a = juce::jlimit (0.0f, 1.0f, amount);
-        const auto threshold = lerp (1.0f, 0.15f, a);
+        float foldGain, foldMix, clipGain, clipThreshold, clipInvThreshold, clipMix;
+    };
 
-        const auto pre = x * drive;
-        const auto clipped = juce::jlimit (-threshold, threshold, pre) / threshold;
-
-        return lerp (dry, clipped, juce::jlimit (0.0f, 1.0f, mix));
+    static ShapeCoeffs shapeCoeffsAt (const BlockInputs& in, int i) noexcept
+    {
+        ShapeCoeffs c;
+
+        // Fold amount adds pre-gain into the folding function.
+        c.foldGain = in.foldDrive[i] * (1.0f + juce::jlimit (0.0f, 1.0f, in.foldAmount[i]) * 10.0f);
+        c.foldMix = juce::jlimit (0.0f, 1.0f, in.foldMix[i]);
+
+        // Clip amount lowers the threshold, increasing distortion at constant input.
+        c.clipGain = in.clipDrive[i];
+        c.clipThreshold = lerp (1.0f, 0.15f, juce::jlimit (0.0f, 1.0f, in.clipAmount[i]));
+        c.clipInvThreshold = 1.0f / c.clipThreshold;
+        c.clipMix = juce::jlimit (0.0f, 1.0f, in.clipMix[i]);
+        return c;
     }
 
-    float modStage (float x, float noteHz, int mode, float amount, float mix, bool noteSync, float manualHz) noexcept
+    template <int Factor>
+    void processPreCrush (float* x, int numBaseSamples, const BlockInputs& in) noexcept
     {
-        const auto dry = x;
-
-        const auto freqHz = juce::jlimit (0.0f, 20000.0f, noteSync ? noteHz : manualHz);
-        const auto phaseInc = (sr > 0.0) ? (float) (freqHz / (float) sr) : 0.0f;
+        const int total = numBaseSamples * Factor;
 
-        modPhase01 += phaseInc;
-        if (modPhase01 >= 1.0f) modPhase01 -= 1.0f;
-
-        const auto phaseRad = juce::MathConstants<float>::twoPi * modPhase01;
-        const auto s = std::sin (phaseRad);
-
-        const auto a = juce::jlimit (0.0f, 1.0f, amount);
-        float wet = x;
+        if (in.foldAntiAlias != (int) params::destroy::aaOff || in.clipAntiAlias != (int) params::destroy::aaOff)
+            processShapesAntiAliased<Factor> (x, numBaseSamples, in);
+        else
+            processShapes<Factor> (x, total, in);
 
-        if (mode == (int) params::destroy::fm)
+        // Ring/FM: the phasor runs serially into a scratch block, the sines and mixing are vectorised.
+        const int chunk = juce::jmax (1, (int) modPhases.size() / Factor);
+        for (int start = 0; start < numBaseSamples; start += chunk)
         {
-            constexpr float index = 10.0f;
-            const auto carrier = std::sin (phaseRad + x * (a * index));
-            wet = lerp (x, carrier, a);
+            const int n = juce::jmin (chunk, numBaseSamples - start);
+            modStage<Factor> (x + start * Factor, start, n, in);
         }
-        else
+    }
+
+    // Fold and clip without ADAA are stateless: four output samples per vector, inputs repeated across the
+    // oversampled lanes.
+    template <int Factor>
+    static void processShapes (float* x, int total, const BlockInputs& in) noexcept
+    {
+        int j = 0;
+        for (; j + 4 <= total; j += 4)
         {
-            // Ring mod: amount crossfades between unity and pure ring modulation.
-            wet = x * ((1.0f - a) + a * s);
+            alignas (16) float fg[4], fm[4], cg[4], ct[4], ci[4], cm[4];
+            ShapeCoeffs c {};
+            for (int k = 0; k < 4; ++k)
+            {
+                if (k == 0 || (j + k) % Factor == 0)
+                    c = shapeCoeffsAt (in, (j + k) / Factor);
+
+                fg[k] = c.foldGain; fm[k] = c.foldMix;
+                cg[k] = c.clipGain; ct[k] = c.clipThreshold; ci[k] = c.clipInvThreshold; cm[k] = c.clipMix;
+            }
+
+            auto v = Vec::loadUnaligned (x + j);
+            v = Vec::add (v, Vec::mul (Vec::sub (fold (Vec::mul (v, Vec::load (fg))), v), Vec::load (fm)));
+
+            const auto threshold = Vec::load (ct);
+            const auto pre = Vec::mul (v, Vec::load (cg));
+            const auto clipped = Vec::mul (Vec::min (Vec::max (pre, Vec::sub (Vec::set (0.0f), threshold)), threshold), Vec::load (ci));
+            v = Vec::add (v, Vec::mul (Vec::sub (clipped, v), Vec::load (cm)));
+
+            Vec::storeUnaligned (x + j, v);
         }
 
-        return lerp (dry, wet, juce::jlimit (0.0f, 1.0f, mix));
+        for (; j < total; ++j)
+        {
+            const auto c = shapeCoeffsAt (in, j / Factor);
+            auto v = x[j];
+            v = lerp (v, fold (v * c.foldGain), c.foldMix);
+            v = lerp (v, juce::jlimit (-c.clipThreshold, c.clipThreshold, v * c.clipGain) * c.clipInvThreshold, c.clipMix);
+            x[j] = v;
+        }
     }
 
-    float quantise (float x, int bits) const noexcept
+    // Per-stage ADAA is serial (each output needs the previous inputs), so this runs sample by sample. The clip
+    // works on the normalised signal drive / threshold, which clips at +-1. Dry paths are delayed to match.
+    template <int Factor>
+    void processShapesAntiAliased (float* x, int numBaseSamples, const BlockInputs& in) noexcept
     {
-        const auto b = juce::jlimit (2, 16, bits);
-        const int maxInt = (1 << (b - 1)) - 1;
+        const TriangleFoldShape foldShape;
+        const HardClipShape clipShape;
+        const auto foldOrder = in.foldAntiAlias;
+        const auto clipOrder = in.clipAntiAlias;
 
-        const auto clamped = juce::jlimit (-1.0f, 1.0f, x);
-        const auto q = std::round (clamped * (float) maxInt) / (float) maxInt;
-        return (float) q;
+        for (int i = 0; i < numBaseSamples; ++i)
+        {
+            const auto c = shapeCoeffsAt (in, i);
+
+            for (int k = 0; k < Factor; ++k)
+            {
+                auto v = x[i * Factor + k];
+
+                if (foldOrder != (int) params::destroy::aaOff)
+                {
+                    const auto wet = foldAdaa.process (v * c.foldGain, foldOrder, foldShape);
+                    v = lerp (foldDry.process (v, foldOrder), wet, c.foldMix);
+                }
+                else
+                {
+                    v = lerp (v, fold (v * c.foldGain), c.foldMix);
+                }
+
+                if (clipOrder != (int) params::destroy::aaOff)
+                {
+                    const auto wet = clipAdaa.process (v * c.clipGain * c.clipInvThreshold, clipOrder, clipShape);
+                    v = lerp (clipDry.process (v, clipOrder), wet, c.clipMix);
+                }
+                else
+                {
+                    v = lerp (v, juce::jlimit (-c.clipThreshold, c.clipThreshold, v * c.clipGain) * c.clipInvThreshold, c.clipMix);
+                }
+
+                x[i * Factor + k] = v;
+            }
+        }
     }
 
-    float crushStage (float x, int bits, int downsample, float mix) noexcept
+    template <int Factor>
+    void modStage (float* x, int offset, int numBaseSamples, const BlockInputs& in) noexcept
     {
-        const auto dry = x;
+        const int total = numBaseSamples * Factor;
+        const auto invSr = (float) (1.0 / sr);
 
-        const auto ds = juce::jlimit (1, 32, downsample);
-
-        if (crushCounter <= 0)
+        auto* phases = modPhases.data();
+        auto ph = modPhase01;
+        for (int i = 0; i < numBaseSamples; ++i)
         {
-            crushHeld = quantise (x, bits);
-            crushCounter = ds - 1;
+            const auto hz = in.modNoteSync ? in.noteHz[offset + i] : in.modFreqHz[offset + i];
+            const auto inc = juce::jlimit (0.0f, 20000.0f, hz) * invSr;
+            for (int k = 0; k < Factor; ++k)
+            {
+                ph += inc;
+                if (ph >= 1.0f)
+                    ph -= 1.0f;
+                phases[i * Factor + k] = ph;
+            }
         }
-        else
+        modPhase01 = ph;
+
+        const bool fm = in.modMode == (int) params::destroy::fm;
+        constexpr float fmIndexCycles = 10.0f / juce::MathConstants<float>::twoPi; // 10 rad
+
+        int j = 0;
+        for (; j + 4 <= total; j += 4)
         {
-            --crushCounter;
+            alignas (16) float am[4], mx[4];
+            for (int k = 0; k < 4; ++k)
+            {
+                const int i = offset + (j + k) / Factor;
+                am[k] = juce::jlimit (0.0f, 1.0f, in.modAmount[i]);
+                mx[k] = juce::jlimit (0.0f, 1.0f, in.modMix[i]);
+            }
+
+            const auto v = Vec::loadUnaligned (x + j);
+            const auto p = Vec::loadUnaligned (phases + j);
+            const auto a = Vec::load (am);
+
+            Vec::T wet;
+            if (fm)
+            {
+                const auto carrier = simd::sin2Pi (Vec::add (p, Vec::mul (v, Vec::mul (a, Vec::set (fmIndexCycles)))));
+                wet = Vec::add (v, Vec::mul (Vec::sub (carrier, v), a));
+            }
+            else
+            {
+                // Ring mod: amount crossfades between unity and pure ring modulation.
+                const auto s = simd::sin2Pi (p);
+                wet = Vec::mul (v, Vec::add (Vec::sub (Vec::set (1.0f), a), Vec::mul (a, s)));
+            }
+
+            Vec::storeUnaligned (x + j, Vec::add (v, Vec::mul (Vec::sub (wet, v), Vec::load (mx))));
         }
 
-        return lerp (dry, crushHeld, juce::jlimit (0.0f, 1.0f, mix));
+        for (; j < total; ++j)
+        {
+            const int i = offset + j / Factor;
+            const auto a = juce::jlimit (0.0f, 1.0f, in.modAmount[i]);
+            const auto v = x[j];
+            const auto wet = fm ? lerp (v, ies::math::fastSin2Pi (phases[j] + v * a * fmIndexCycles), a)
+                                : v * ((1.0f - a) + a * ies::math::fastSin2Pi (phases[j]));
+            x[j] = lerp (v, wet, juce::jlimit (0.0f, 1.0f, in.modMix[i]));
+        }
     }
 
     double sr = 44100.0;
     float modPhase01 = 0.0f;
+    std::vector<float> modPhases;
 
     int crushCounter = 0;
     float crushHeld = 0.0f;
+
+    Adaa<TriangleFoldShape> foldAdaa;
+    Adaa<HardClipShape> clipAdaa;
+    AdaaDryDelay foldDry;
+    AdaaDryDelay clipDry;
 };
 } // namespace ies::dsp
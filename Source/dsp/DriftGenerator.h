@@ -0,0 +1,94 @@
+#pragma once
+
+#include <JuceHeader.h>
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+
+namespace ies::dsp
+{
+// Slow "analog" drift: per-lane xorshift32 noise through a ~1 Hz one-pole, updated every `interval` samples
+// and linearly interpolated in between. Lanes are seeded from fixed constants, so reset() makes renders reproducible.
+class DriftGenerator final
+{
+public:
+    static constexpr int numLanes = 4;
+    static constexpr int interval = 32;
+
+    void prepare (double sampleRateHz, float cutoffHz = 1.0f) noexcept
+    {
+        const auto sr = sampleRateHz > 0.0 ? sampleRateHz : 44100.0;
+        const auto alpha = juce::jlimit (0.0, 1.0, 2.0 * juce::MathConstants<double>::pi * (double) cutoffHz / sr);
+
+        // One tick stands in for `interval` per-sample updates: same decay, and noise scaled so the
+        // filtered variance matches the per-sample filter (white in [-1, 1] has variance 1/3).
+        tickAlpha = (float) (1.0 - std::pow (1.0 - alpha, (double) interval));
+        tickNoiseGain = (float) std::sqrt ((alpha / (2.0 - alpha)) * (2.0 - (double) tickAlpha) / juce::jmax (1.0e-12, (double) tickAlpha));
+
+        // Normalised output maps +-3 sigma to +-1.
+        const auto sigma = std::sqrt ((alpha / (2.0 - alpha)) / 3.0);
+        normGain = (float) (1.0 / juce::jmax (1.0e-12, 3.0 * sigma));
+
+        reset();
+    }
+
+    void reset() noexcept
+    {
+        rng = seeds;
+        state.fill (0.0f);
+        value.fill (0.0f);
+        step.fill (0.0f);
+        countdown = 0;
+    }
+
+    // Advance one sample.
+    void tick() noexcept
+    {
+        if (--countdown <= 0)
+        {
+            countdown = interval;
+            for (int l = 0; l < numLanes; ++l)
+            {
+                const auto white = nextBipolar (rng[(size_t) l]) * tickNoiseGain;
+                auto& s = state[(size_t) l];
+                s += tickAlpha * (white - s);
+                step[(size_t) l] = (s - value[(size_t) l]) * (1.0f / (float) interval);
+            }
+        }
+
+        for (int l = 0; l < numLanes; ++l)
+            value[(size_t) l] += step[(size_t) l];
+    }
+
+    // Raw filtered noise (same scale as a per-sample one-pole driven by white noise in [-1, 1]).
+    float getValue (int lane) const noexcept { return value[(size_t) lane]; }
+
+    // Bipolar, roughly -1..1.
+    float getNormalised (int lane) const noexcept
+    {
+        return juce::jlimit (-1.0f, 1.0f, value[(size_t) lane] * normGain);
+    }
+
+private:
+    static float nextBipolar (std::uint32_t& x) noexcept
+    {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        return (float) (x >> 8) * (2.0f / 16777216.0f) - 1.0f;
+    }
+
+    static constexpr std::array<std::uint32_t, numLanes> seeds { 0x13579bdfu, 0x2468ace0u, 0x369cf012u, 0x44524654u };
+
+    std::array<std::uint32_t, numLanes> rng = seeds;
+    std::array<float, numLanes> state {};
+    std::array<float, numLanes> value {};
+    std::array<float, numLanes> step {};
+    int countdown = 0;
+
+    float tickAlpha = 0.0f;
+    float tickNoiseGain = 1.0f;
+    float normGain = 1.0f;
+};
+} // namespace ies::dsp
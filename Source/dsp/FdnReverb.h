@@ -0,0 +1,381 @@
+#pragma once
+
+#include <JuceHeader.h>
+
+#include <array>
+#include <cmath>
+#include <vector>
+
+#include "../Params.h"
+#include "../Util/Math.h"
+#include "DelayLine.h"
+#include "SimdVec.h"
+
+namespace ies::dsp
+{
+// Feedback delay network reverb: 8 (Eco) or 16 (Hi) delay lines fed back through a normalised Hadamard matrix,
+// four lines per vector. Hi also modulates the line lengths (fractional reads) to smear the metallic modes; Eco
+// reads whole samples and does half the work. Pre-delay and the low/high cut sit on the tank input, so they shape
+// the whole tail. Runs a block at a time, 100% wet; settings apply per call and line lengths glide in 32-sample
+// steps, so size automation does not click.
+class FdnReverb final
+{
+public:
+    struct Settings final
+    {
+        float size01 = 0.5f;
+        float decay01 = 0.4f;
+        float damp01 = 0.4f;
+        float preDelayMs = 0.0f;
+        float width01 = 1.0f;
+        float lowCutHz = 40.0f;
+        float highCutHz = 16000.0f;
+        int quality = (int) params::fx::reverb::hi;
+    };
+
+    static constexpr int maxLines = 16;
+
+    void prepare (double sampleRate)
+    {
+        sr = (sampleRate > 0.0) ? sampleRate : 44100.0;
+
+        // Longest line at size 1, plus modulation and interpolation headroom.
+        const auto maxDelay = (int) std::ceil (sr * (double) maxLineMs * 0.001 * (double) sizeScale (1.0f)) + modHeadroom;
+        lineSize = juce::nextPowerOfTwo (maxDelay + 2);
+        lines.assign ((size_t) (maxLines * lineSize), 0.0f);
+
+        maxPreDelay = (int) std::ceil (sr * 0.2);
+        preL.prepare (maxPreDelay, stepSize);
+        preR.prepare (maxPreDelay, stepSize);
+
+        modDepth = (float) (sr * 0.00035); // +-0.35 ms
+        for (int i = 0; i < maxLines; ++i)
+            modInc[(size_t) i] = (float) ((0.11 + 0.057 * (double) i) / sr);
+
+        configured = false;
+        reset();
+    }
+
+    void reset() noexcept
+    {
+        std::fill (lines.begin(), lines.end(), 0.0f);
+        preL.reset();
+        preR.reset();
+        writePos = 0;
+        damp.fill (0.0f);
+        lowCutStateL = lowCutStateR = 0.0f;
+        highCutStateL = highCutStateR = 0.0f;
+        for (int i = 0; i < maxLines; ++i)
+            modPhase[(size_t) i] = (float) i * 0.37f;
+        for (int i = 0; i < maxLines; ++i)
+            delay[(size_t) i] = baseDelay[(size_t) i];
+    }
+
+    // Cheap when nothing changed since the last call.
+    void setSettings (const Settings& s) noexcept
+    {
+        if (configured && sameSettings (s, current))
+            return;
+
+        const auto hiQuality = s.quality != (int) params::fx::reverb::eco;
+        const auto newNumLines = hiQuality ? 16 : 8;
+        const auto qualityChanged = ! configured || newNumLines != numLines;
+        numLines = newNumLines;
+        modulate = hiQuality;
+
+        const auto* baseMs = hiQuality ? hiLineMs : ecoLineMs;
+        const auto scale = sizeScale (juce::jlimit (0.0f, 1.0f, s.size01));
+        const auto decay = juce::jlimit (0.0f, 1.0f, s.decay01);
+        const auto rt60 = (0.3f + 7.7f * decay * decay) * (0.6f + 0.8f * juce::jlimit (0.0f, 1.0f, s.size01));
+        const auto norm = 1.0f / std::sqrt ((float) numLines);
+
+        for (int i = 0; i < numLines; ++i)
+        {
+            const auto d = (float) (sr * 0.001 * (double) (baseMs[i] * scale));
+            baseDelay[(size_t) i] = d;
+            // -60 dB after rt60 seconds, whatever the line length; the Hadamard normalisation rides along.
+            gain[(size_t) i] = norm * std::pow (10.0f, -3.0f * d / (rt60 * (float) sr));
+        }
+
+        if (qualityChanged)
+        {
+            // The other line set has nothing useful in it: start the tank clean at the new lengths.
+            reset();
+        }
+
+        const auto dampHz = 20000.0f * std::pow (0.05f, juce::jlimit (0.0f, 1.0f, s.damp01));
+        dampCoeff = onePoleCoeff (dampHz);
+        lowCutCoeff = onePoleCoeff (juce::jlimit (20.0f, 2000.0f, s.lowCutHz));
+        highCutCoeff = onePoleCoeff (juce::jlimit (2000.0f, 20000.0f, s.highCutHz));
+        preDelaySamples = juce::jlimit (0, maxPreDelay, (int) std::lround (juce::jmax (0.0f, s.preDelayMs) * 0.001 * sr));
+        width = juce::jlimit (0.0f, 1.0f, s.width01);
+
+        current = s;
+        configured = true;
+    }
+
+    // In place. r may be null (mono: the input feeds both sides, the output is their average).
+    void process (float* l, float* r, int numSamples) noexcept
+    {
+        if (lines.empty())
+            return;
+
+        alignas (16) float inL[stepSize];
+        alignas (16) float inR[stepSize];
+        alignas (16) float outL[stepSize];
+        alignas (16) float outR[stepSize];
+
+        for (int start = 0; start < numSamples; start += stepSize)
+        {
+            const auto len = juce::jmin (stepSize, numSamples - start);
+            auto* xl = l + start;
+            auto* xr = r != nullptr ? r + start : nullptr;
+
+            conditionInput (xl, xr != nullptr ? xr : xl, inL, inR, len);
+
+            // Line lengths at the end of this step; glide there linearly.
+            bool gliding = false;
+            const auto invLen = 1.0f / (float) len;
+            for (int i = 0; i < numLines; ++i)
+            {
+                auto target = baseDelay[(size_t) i];
+                if (modulate)
+                {
+                    auto& ph = modPhase[(size_t) i];
+                    ph += modInc[(size_t) i] * (float) len;
+                    ph -= std::floor (ph);
+                    target += modDepth * ies::math::fastSin2Pi (ph);
+                }
+
+                stepTarget[(size_t) i] = target;
+                delayStep[(size_t) i] = (target - delay[(size_t) i]) * invLen;
+                gliding = gliding || target != delay[(size_t) i];
+            }
+
+            if (numLines == 16)
+            {
+                if (gliding) runStep<16, true> (inL, inR, outL, outR, len);
+                else         runStep<16, false> (inL, inR, outL, outR, len);
+            }
+            else
+            {
+                if (gliding) runStep<8, true> (inL, inR, outL, outR, len);
+                else         runStep<8, false> (inL, inR, outL, outR, len);
+            }
+
+            for (int i = 0; i < numLines; ++i)
+                delay[(size_t) i] = stepTarget[(size_t) i];
+
+            // Width on the wet signal only.
+            const auto sideGain = width;
+            for (int i = 0; i < len; ++i)
+            {
+                const auto mid = 0.5f * (outL[i] + outR[i]);
+                const auto side = 0.5f * (outL[i] - outR[i]) * sideGain;
+                if (xr != nullptr)
+                {
+                    xl[i] = mid + side;
+                    xr[i] = mid - side;
+                }
+                else
+                {
+                    xl[i] = mid;
+                }
+            }
+        }
+    }
+
+private:
+    using Vec = simd::Vec4;
+
+    static constexpr int stepSize = 32;
+    static constexpr int modHeadroom = 64;
+    static constexpr float maxLineMs = 97.1f;
+
+    // Mutually prime-ish lengths spread over 30-100 ms (before the size scale).
+    static constexpr float hiLineMs[16] = { 31.7f, 37.1f, 41.3f, 43.9f, 47.3f, 53.1f, 56.9f, 61.7f,
+                                            66.1f, 70.3f, 74.9f, 79.3f, 83.1f, 87.7f, 91.3f, 97.1f };
+    static constexpr float ecoLineMs[8] = { 33.7f, 41.9f, 48.7f, 55.3f, 62.9f, 71.3f, 79.9f, 89.3f };
+
+    // Input injection and output taps per line: four sign patterns, orthogonal over every group of four.
+    static constexpr float injectL[16] = { 1, 1, 1, 1, -1, 1, -1, 1, 1, -1, -1, 1, -1, -1, 1, 1 };
+    static constexpr float injectR[16] = { 1, -1, 1, -1, 1, 1, -1, -1, -1, -1, 1, 1, 1, -1, -1, 1 };
+    static constexpr float tapL[16] = { 1, 1, -1, -1, 1, -1, -1, 1, -1, 1, 1, -1, 1, 1, 1, 1 };
+    static constexpr float tapR[16] = { 1, -1, -1, 1, -1, -1, 1, 1, 1, 1, -1, -1, 1, -1, 1, -1 };
+
+    static float sizeScale (float size01) noexcept { return 0.35f + 1.3f * size01; }
+
+    float onePoleCoeff (float hz) const noexcept
+    {
+        return 1.0f - std::exp (-2.0f * juce::MathConstants<float>::pi * hz / (float) sr);
+    }
+
+    static bool sameSettings (const Settings& a, const Settings& b) noexcept
+    {
+        return a.size01 == b.size01 && a.decay01 == b.decay01 && a.damp01 == b.damp01 && a.preDelayMs == b.preDelayMs
+            && a.width01 == b.width01 && a.lowCutHz == b.lowCutHz && a.highCutHz == b.highCutHz && a.quality == b.quality;
+    }
+
+    // Pre-delay, then the one-pole low cut (input minus its low-pass) and high cut.
+    void conditionInput (const float* xl, const float* xr, float* inL, float* inR, int len) noexcept
+    {
+        // Whole-sample delay, so the linear read is exact.
+        preL.writeBlock (xl, len);
+        preR.writeBlock (xr, len);
+        preL.readBlock<DelayLine::Interpolation::linear> (inL, len, (float) preDelaySamples);
+        preR.readBlock<DelayLine::Interpolation::linear> (inR, len, (float) preDelaySamples);
+
+        for (int i = 0; i < len; ++i)
+        {
+            auto a = inL[i];
+            auto b = inR[i];
+
+            lowCutStateL += lowCutCoeff * (a - lowCutStateL);
+            lowCutStateR += lowCutCoeff * (b - lowCutStateR);
+            a -= lowCutStateL;
+            b -= lowCutStateR;
+
+            highCutStateL += highCutCoeff * (a - highCutStateL);
+            highCutStateR += highCutCoeff * (b - highCutStateR);
+            inL[i] = highCutStateL;
+            inR[i] = highCutStateR;
+        }
+    }
+
+    // One step of the network for N lines. Fractional reads (linear interpolation) while lengths move, whole
+    // samples otherwise.
+    template <int N, bool fractional>
+    void runStep (const float* inL, const float* inR, float* outL, float* outR, int len) noexcept
+    {
+        constexpr int K = N / 4;
+        const auto mask = lineSize - 1;
+
+        Vec::T g[K], lp[K], injL[K], injR[K], tL[K], tR[K];
+        for (int k = 0; k < K; ++k)
+        {
+            g[k] = Vec::loadUnaligned (gain.data() + 4 * k);
+            lp[k] = Vec::loadUnaligned (damp.data() + 4 * k);
+            injL[k] = Vec::loadUnaligned (injectL + 4 * k);
+            injR[k] = Vec::loadUnaligned (injectR + 4 * k);
+            tL[k] = Vec::loadUnaligned (tapL + 4 * k);
+            tR[k] = Vec::loadUnaligned (tapR + 4 * k);
+        }
+        const auto c = Vec::set (dampCoeff);
+        // Fixed injection gain: roughly the wet level of the Freeverb-style reverb this replaced, and close for
+        // both line counts.
+        constexpr float inNorm = 0.25f;
+        const auto outNorm = 1.0f / std::sqrt ((float) N);
+
+        std::array<int, (size_t) N> whole {};
+        if constexpr (! fractional)
+            for (int i = 0; i < N; ++i)
+                whole[(size_t) i] = (int) std::lround (delay[(size_t) i]);
+
+        std::array<float, (size_t) N> d {};
+        for (int i = 0; i < N; ++i)
+            d[(size_t) i] = delay[(size_t) i];
+
+        float* const base = lines.data();
+        alignas (16) float rd[N];
+        alignas (16) float wr[N];
+
+        for (int s = 0; s < len; ++s)
+        {
+            for (int i = 0; i < N; ++i)
+            {
+                const float* line = base + i * lineSize;
+                if constexpr (fractional)
+                {
+                    const auto di = (int) d[(size_t) i];
+                    const auto frac = d[(size_t) i] - (float) di;
+                    const auto a = line[(writePos - di) & mask];
+                    const auto b = line[(writePos - di - 1) & mask];
+                    rd[i] = a + frac * (b - a);
+                    d[(size_t) i] += delayStep[(size_t) i];
+                }
+                else
+                {
+                    rd[i] = line[(writePos - whole[(size_t) i]) & mask];
+                }
+            }
+
+            Vec::T m[K];
+            auto accL = Vec::set (0.0f);
+            auto accR = Vec::set (0.0f);
+            for (int k = 0; k < K; ++k)
+            {
+                const auto o = Vec::load (rd + 4 * k);
+                accL = Vec::add (accL, Vec::mul (o, tL[k]));
+                accR = Vec::add (accR, Vec::mul (o, tR[k]));
+
+                lp[k] = Vec::add (lp[k], Vec::mul (c, Vec::sub (o, lp[k])));
+                m[k] = Vec::hadamard4 (Vec::mul (lp[k], g[k]));
+            }
+            outL[s] = Vec::sum (accL) * outNorm;
+            outR[s] = Vec::sum (accR) * outNorm;
+
+            // Across vectors: H2 (8 lines) or H4 (16 lines); with the in-lane H4 that is H8 / H16.
+            if constexpr (K == 2)
+            {
+                const auto a = m[0];
+                m[0] = Vec::add (a, m[1]);
+                m[1] = Vec::sub (a, m[1]);
+            }
+            else if constexpr (K == 4)
+            {
+                const auto y0 = Vec::add (m[0], m[1]), y1 = Vec::sub (m[0], m[1]);
+                const auto y2 = Vec::add (m[2], m[3]), y3 = Vec::sub (m[2], m[3]);
+                m[0] = Vec::add (y0, y2);
+                m[1] = Vec::add (y1, y3);
+                m[2] = Vec::sub (y0, y2);
+                m[3] = Vec::sub (y1, y3);
+            }
+
+            const auto xl = Vec::set (inL[s] * inNorm);
+            const auto xr = Vec::set (inR[s] * inNorm);
+            for (int k = 0; k < K; ++k)
+                Vec::store (wr + 4 * k, Vec::add (m[k], Vec::add (Vec::mul (xl, injL[k]), Vec::mul (xr, injR[k]))));
+
+            for (int i = 0; i < N; ++i)
+                base[i * lineSize + writePos] = wr[i];
+
+            writePos = (writePos + 1) & mask;
+        }
+
+        for (int k = 0; k < K; ++k)
+            Vec::storeUnaligned (damp.data() + 4 * k, lp[k]);
+    }
+
+    double sr = 44100.0;
+
+    std::vector<float> lines; // maxLines rings of lineSize, sharing writePos
+    int lineSize = 1;
+    int writePos = 0;
+
+    DelayLine preL, preR;
+    int maxPreDelay = 0;
+    int preDelaySamples = 0;
+
+    int numLines = 16;
+    bool modulate = true;
+    std::array<float, maxLines> baseDelay {};
+    std::array<float, maxLines> delay {};
+    std::array<float, maxLines> stepTarget {};
+    std::array<float, maxLines> delayStep {};
+    std::array<float, maxLines> gain {};
+    std::array<float, maxLines> damp {};
+    std::array<float, maxLines> modPhase {};
+    std::array<float, maxLines> modInc {};
+    float modDepth = 0.0f;
+
+    float dampCoeff = 1.0f;
+    float lowCutCoeff = 0.0f;
+    float highCutCoeff = 1.0f;
+    float lowCutStateL = 0.0f, lowCutStateR = 0.0f;
+    float highCutStateL = 0.0f, highCutStateR = 0.0f;
+    float width = 1.0f;
+
+    Settings current;
+    bool configured = false;
+};
+} // namespace ies::dsp
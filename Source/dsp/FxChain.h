@@ -4,13 +4,21 @@
 #include <cstring>
 
 #include "../Params.h"
+#include "../Util/Math.h"
+#include "DelayLine.h"
+#include "FdnReverb.h"
+#include "SimdVec.h"
 
 namespace ies::dsp
 {
 // Compact, realtime-safe FX rack: Chorus / Delay / Reverb / Dist / Phaser / Octaver.
 // - No allocations in process.
 // - Per-block: wet/dry per FX + global mix.
-// - Oversampling policy (Off/2x/4x) applies to the full FX rack processing.
+// - Disabled blocks are bypassed outright (after a short fade-out) and cost nothing; an idle rack skips the
+//   dry copies and the global mix as well.
+// - Oversampling policy (Off/2x/4x) runs the Dist block up -> distort -> down through linear-phase half-band FIRs.
+//   The rest of the rack (dry paths included) is delayed to match, and lower settings pad the Dist output up to
+//   the longest setting's delay, so the rack latency (getLatencySamples) never changes after prepare().
 //   Switching oversampling resets FX state to avoid bursts.
 class FxChain final
 {
@@ -49,6 +57,9 @@ public:
     // Audio processing. Uses and updates meters.
     Meters& getMeters() noexcept { return meters; }
     const Meters& getMeters() const noexcept { return meters; }
+
+    // Peak scans only run while something displays them (e.g. an editor is open).
+    void setMetersEnabled (bool shouldMeter) noexcept { metersEnabled = shouldMeter; }
     void setCustomOrder (const std::array<int, (size_t) numBlocks>& order) noexcept
     {
         std::array<bool, (size_t) numBlocks> used {};
@@ -144,18 +155,28 @@ public:
                   int oversampleChoice, int orderChoice,
                   const RuntimeParams& p) noexcept;
 
+    // Rack delay in whole samples, whatever the Oversample choice and whichever blocks are on. Valid after
+    // prepare().
+    int getLatencySamples() const noexcept { return juce::jmax (os2xLatency, os4xLatency); }
+
 private:
     struct OnePoleHp final
     {
         void prepare (double sr, float hz) noexcept
         {
             sampleRate = sr > 0.0 ? sr : 44100.0;
+            lastHz = -1.0f;
             setCutoff (hz);
             z = 0.0f;
         }
 
+        // Called per sample with a smoothed value: only recomputes when it moved.
         void setCutoff (float hz) noexcept
         {
+            if (hz == lastHz)
+                return;
+
+            lastHz = hz;
             hz = juce::jlimit (10.0f, 20000.0f, hz);
             const auto x = std::exp (-2.0 * juce::MathConstants<double>::pi * (double) hz / sampleRate);
             a = (float) x;
@@ -169,6 +190,7 @@ private:
         }
 
         double sampleRate = 44100.0;
+        float lastHz = -1.0f;
         float a = 0.0f;
         float z = 0.0f;
     };
@@ -180,10 +202,10 @@ private:
             juce::ignoreUnused (maxBlockSize);
             sampleRate = sr > 0.0 ? sr : 44100.0;
 
-            const int maxDelaySamps = (int) std::ceil (sampleRate * 0.060); // 60ms
-            delayL.assign ((size_t) maxDelaySamps + 4u, 0.0f);
-            delayR.assign ((size_t) maxDelaySamps + 4u, 0.0f);
-            writePos = 0;
+            // 45 ms base + 25 ms depth.
+            const int maxDelaySamps = (int) std::ceil (sampleRate * 0.071);
+            delayL.prepare (maxDelaySamps);
+            delayR.prepare (maxDelaySamps);
 
             hpL.prepare (sampleRate, 30.0f);
             hpR.prepare (sampleRate, 30.0f);
@@ -192,9 +214,8 @@ private:
 
         void reset() noexcept
         {
-            std::fill (delayL.begin(), delayL.end(), 0.0f);
-            std::fill (delayR.begin(), delayR.end(), 0.0f);
-            writePos = 0;
+            delayL.reset();
+            delayR.reset();
             hpL.z = hpR.z = 0.0f;
             lfoPhase = 0.0f;
         }
@@ -211,48 +232,29 @@ private:
             lfoPhase = lfoPhase + phaseInc;
             if (lfoPhase >= 1.0f) lfoPhase -= 1.0f;
 
-            const float phL = lfoPhase;
-            const float phR = lfoPhase + 0.25f * stereo01;
-            const float sL = std::sin (juce::MathConstants<float>::twoPi * phL);
-            const float sR = std::sin (juce::MathConstants<float>::twoPi * (phR - std::floor (phR)));
+            const float sL = ies::math::fastSin2Pi (lfoPhase);
+            const float sR = ies::math::fastSin2Pi (lfoPhase + 0.25f * stereo01);
 
             const float baseDelay = juce::jlimit (0.5f, 45.0f, delayMs);
             const float depth = juce::jlimit (0.0f, 25.0f, depthMs);
-            const float dLms = baseDelay + depth * sL;
-            const float dRms = baseDelay + depth * sR;
-
-            auto readDelay = [&] (const std::vector<float>& buf, float dMs) noexcept
-            {
-                const float dSamp = (dMs * 0.001f) * (float) sampleRate;
-                const int size = (int) buf.size();
-                const float rp = (float) writePos - dSamp;
-                int i0 = (int) std::floor (rp);
-                float frac = rp - (float) i0;
-                while (i0 < 0) i0 += size;
-                const int i1 = (i0 + 1) % size;
-                const float a = buf[(size_t) i0];
-                const float b = buf[(size_t) i1];
-                return a + frac * (b - a);
-            };
+            const float msToSamples = 0.001f * (float) sampleRate;
 
             const float inL = hpL.process (l);
             const float inR = hpR.process (r);
 
-            const float dl = readDelay (delayL, dLms);
-            const float dr = readDelay (delayR, dRms);
+            const float dl = delayL.read<DelayLine::Interpolation::lagrange3> ((baseDelay + depth * sL) * msToSamples);
+            const float dr = delayR.read<DelayLine::Interpolation::lagrange3> ((baseDelay + depth * sR) * msToSamples);
 
             const float fb = juce::jlimit (-0.98f, 0.98f, feedback);
-            delayL[(size_t) writePos] = inL + dl * fb;
-            delayR[(size_t) writePos] = inR + dr * fb;
-            writePos = (writePos + 1) % (int) delayL.size();
+            delayL.push (inL + dl * fb);
+            delayR.push (inR + dr * fb);
 
             l = dl;
             r = dr;
         }
 
         double sampleRate = 44100.0;
-        std::vector<float> delayL, delayR;
-        int writePos = 0;
+        DelayLine delayL, delayR;
         OnePoleHp hpL, hpR;
         float lfoPhase = 0.0f;
     };
@@ -263,22 +265,27 @@ private:
         {
             sampleRate = sr > 0.0 ? sr : 44100.0;
             const int maxDelaySamps = (int) std::ceil (sampleRate * 4.2); // 4.2s
-            bufL.assign ((size_t) maxDelaySamps + 4u, 0.0f);
-            bufR.assign ((size_t) maxDelaySamps + 4u, 0.0f);
-            writePos = 0;
+            bufL.prepare (maxDelaySamps);
+            bufR.prepare (maxDelaySamps);
+            lastFilterHz = -1.0f;
             fbLpL = fbLpR = 0.0f;
             modPhase = 0.0f;
             duckEnv = 0.0f;
+            lastDelayL = lastDelayR = -1.0f;
+            lastTapL = lastTapR = 0.0f;
+            allpassActive = false;
         }
 
         void reset() noexcept
         {
-            std::fill (bufL.begin(), bufL.end(), 0.0f);
-            std::fill (bufR.begin(), bufR.end(), 0.0f);
-            writePos = 0;
+            bufL.reset();
+            bufR.reset();
             fbLpL = fbLpR = 0.0f;
             modPhase = 0.0f;
             duckEnv = 0.0f;
+            lastDelayL = lastDelayR = -1.0f;
+            lastTapL = lastTapR = 0.0f;
+            allpassActive = false;
         }
 
         float divToMs (int divIdx, float bpm) const noexcept
@@ -325,27 +332,41 @@ private:
             modDepthMs = juce::jlimit (0.0f, 25.0f, modDepthMs);
             modPhase += modRateHz / (float) sampleRate;
             if (modPhase >= 1.0f) modPhase -= 1.0f;
-            const float mod = std::sin (juce::MathConstants<float>::twoPi * modPhase);
+            const float mod = ies::math::fastSin2Pi (modPhase);
 
             const float dLms = juce::jlimit (1.0f, 4000.0f, baseL + modDepthMs * mod);
             const float dRms = juce::jlimit (1.0f, 4000.0f, baseR + modDepthMs * (pingpong ? -mod : mod));
 
-            auto readDelay = [&] (const std::vector<float>& buf, float dMs) noexcept
+            // Static taps read through the allpass (flat magnitude: repeats do not lose extra top end). Anything
+            // that moves the delay (modulation, the time smoother, a sync tap following the host tempo) reads
+            // through Lagrange instead, and the allpass restarts from the last Lagrange output once it settles.
+            const float msToSamples = 0.001f * (float) sampleRate;
+            const float delayL = dLms * msToSamples;
+            const float delayR = dRms * msToSamples;
+            const bool staticTaps = delayL == lastDelayL && delayR == lastDelayR;
+            lastDelayL = delayL;
+            lastDelayR = delayR;
+
+            float dl, dr;
+            if (staticTaps)
             {
-                const float dSamp = (dMs * 0.001f) * (float) sampleRate;
-                const int size = (int) buf.size();
-                float rp = (float) writePos - dSamp;
-                int i0 = (int) std::floor (rp);
-                float frac = rp - (float) i0;
-                while (i0 < 0) i0 += size;
-                const int i1 = (i0 + 1) % size;
-                const float a = buf[(size_t) i0];
-                const float b = buf[(size_t) i1];
-                return a + frac * (b - a);
-            };
-
-            const float dl = readDelay (bufL, dLms);
-            const float dr = readDelay (bufR, dRms);
+                if (! allpassActive)
+                {
+                    bufL.resetAllpass (lastTapL);
+                    bufR.resetAllpass (lastTapR);
+                    allpassActive = true;
+                }
+                dl = bufL.read<DelayLine::Interpolation::allpass> (delayL);
+                dr = bufR.read<DelayLine::Interpolation::allpass> (delayR);
+            }
+            else
+            {
+                allpassActive = false;
+                dl = bufL.read<DelayLine::Interpolation::lagrange3> (delayL);
+                dr = bufR.read<DelayLine::Interpolation::lagrange3> (delayR);
+            }
+            lastTapL = dl;
+            lastTapR = dr;
 
             // Duck: envelope follower on dry; apply to feedback and wet.
             const float duck = juce::jlimit (0.0f, 1.0f, duck01);
@@ -354,27 +375,35 @@ private:
             const float duckGain = 1.0f - duck * juce::jlimit (0.0f, 1.0f, duckEnv * 2.0f);
 
             // Feedback filter: one-pole LP.
-            filterHz = juce::jlimit (200.0f, 20000.0f, filterHz);
-            const float a = (float) std::exp (-2.0 * juce::MathConstants<double>::pi * (double) filterHz / sampleRate);
+            if (filterHz != lastFilterHz)
+            {
+                lastFilterHz = filterHz;
+                const auto hz = juce::jlimit (200.0f, 20000.0f, filterHz);
+                fbLpCoeff = (float) std::exp (-2.0 * juce::MathConstants<double>::pi * (double) hz / sampleRate);
+            }
+            const float a = fbLpCoeff;
             fbLpL = a * fbLpL + (1.0f - a) * (pingpong ? dr : dl);
             fbLpR = a * fbLpR + (1.0f - a) * (pingpong ? dl : dr);
 
             const float fb = juce::jlimit (0.0f, 0.98f, feedback01) * duckGain;
 
-            bufL[(size_t) writePos] = l + fbLpL * fb;
-            bufR[(size_t) writePos] = r + fbLpR * fb;
-            writePos = (writePos + 1) % (int) bufL.size();
+            bufL.push (l + fbLpL * fb);
+            bufR.push (r + fbLpR * fb);
 
             l = dl * duckGain;
             r = dr * duckGain;
         }
 
         double sampleRate = 44100.0;
-        std::vector<float> bufL, bufR;
-        int writePos = 0;
+        DelayLine bufL, bufR;
+        float lastFilterHz = -1.0f; // fbLpCoeff is cached for this cutoff
+        float fbLpCoeff = 0.0f;
         float fbLpL = 0.0f, fbLpR = 0.0f;
         float modPhase = 0.0f;
         float duckEnv = 0.0f;
+        float lastDelayL = -1.0f, lastDelayR = -1.0f; // taps (samples) read on the previous sample
+        float lastTapL = 0.0f, lastTapR = 0.0f;
+        bool allpassActive = false;
     };
 
     struct Distortion final
@@ -382,6 +411,7 @@ private:
         void prepare (double sr)
         {
             sampleRate = sr > 0.0 ? sr : 44100.0;
+            lastPostLpHz = -1.0f;
             postLpL = 0.0f;
             postLpR = 0.0f;
         }
@@ -437,8 +467,13 @@ private:
             xR = sat (type, xR) * trim;
 
             // Post LP for fizz control.
-            postLPHz = juce::jlimit (800.0f, 20000.0f, postLPHz);
-            const float a = (float) std::exp (-2.0 * juce::MathConstants<double>::pi * (double) postLPHz / sampleRate);
+            if (postLPHz != lastPostLpHz)
+            {
+                lastPostLpHz = postLPHz;
+                const auto hz = juce::jlimit (800.0f, 20000.0f, postLPHz);
+                postLpCoeff = (float) std::exp (-2.0 * juce::MathConstants<double>::pi * (double) hz / sampleRate);
+            }
+            const float a = postLpCoeff;
             postLpL = a * postLpL + (1.0f - a) * xL;
             postLpR = a * postLpR + (1.0f - a) * xR;
 
@@ -447,6 +482,8 @@ private:
         }
 
         double sampleRate = 44100.0;
+        float lastPostLpHz = -1.0f; // postLpCoeff is cached for this cutoff
+        float postLpCoeff = 0.0f;
         float postLpL = 0.0f, postLpR = 0.0f;
     };
 
@@ -550,22 +587,107 @@ private:
         return p;
     }
 
-    static void mixWetDry (float* l, float* r, const float* dryL, const float* dryR, int n, float mix01) noexcept
+    using Smoother = juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear>;
+
+    // Mix ramps per sample, so the result does not depend on how the host block was segmented.
+    static void mixWetDry (float* l, float* r, const float* dryL, const float* dryR, int n, Smoother& mixSm) noexcept
+    {
+        for (int i = 0; i < n; ++i)
+        {
+            const float mix01 = juce::jlimit (0.0f, 1.0f, mixSm.getNextValue());
+            l[i] = dryL[i] + (l[i] - dryL[i]) * mix01;
+            if (r != nullptr && dryR != nullptr)
+                r[i] = dryR[i] + (r[i] - dryR[i]) * mix01;
+        }
+    }
+
+    // Same, with the block's enable fade applied on top of its mix.
+    static void mixWetDryFaded (float* l, float* r, const float* dryL, const float* dryR, int n,
+                                Smoother& mixSm, Smoother& enableSm) noexcept
     {
-        mix01 = juce::jlimit (0.0f, 1.0f, mix01);
         for (int i = 0; i < n; ++i)
         {
+            const float mix01 = juce::jlimit (0.0f, 1.0f, mixSm.getNextValue()) * enableSm.getNextValue();
             l[i] = dryL[i] + (l[i] - dryL[i]) * mix01;
             if (r != nullptr && dryR != nullptr)
                 r[i] = dryR[i] + (r[i] - dryR[i]) * mix01;
         }
     }
 
+    static void updatePeak (std::atomic<float>& meter, float peak) noexcept
+    {
+        meter.store (juce::jmax (meter.load (std::memory_order_relaxed) * 0.92f, peak), std::memory_order_relaxed);
+    }
+
+    static bool isBlockEnabled (Block b, const RuntimeParams& p) noexcept
+    {
+        switch (b)
+        {
+            case chorus:  return p.chorusEnable;
+            case delay:   return p.delayEnable;
+            case reverb:  return p.reverbEnable;
+            case dist:    return p.distEnable;
+            case phaser:  return p.phaserEnable;
+            case octaver: return p.octaverEnable;
+            case numBlocks:
+            default:      return false;
+        }
+    }
+
+    Smoother& getMixSmoother (Block b) noexcept
+    {
+        switch (b)
+        {
+            case delay:   return delayMixSm;
+            case reverb:  return reverbMixSm;
+            case dist:    return distMixSm;
+            case phaser:  return phaserMixSm;
+            case octaver: return octMixSm;
+            case chorus:
+            case numBlocks:
+            default:      return chorusMixSm;
+        }
+    }
+
+    static int osFactorFor (int oversampleChoice) noexcept
+    {
+        const int osChoice = juce::jlimit ((int) params::fx::global::osOff, (int) params::fx::global::os4x, oversampleChoice);
+        return (osChoice == (int) params::fx::global::os2x) ? 2
+             : (osChoice == (int) params::fx::global::os4x) ? 4
+             : 1;
+    }
+
+    // Delay the Dist up/down filters add at an oversampling factor.
+    int osLatencyFor (int osFactor) const noexcept
+    {
+        return osFactor == 4 ? os4xLatency : (osFactor == 2 ? os2xLatency : 0);
+    }
+
+    // Pushes a block through a compensation line and replaces it with the output `latency` samples later.
+    static void alignBlock (DelayLine& line, float* x, int n, int latency) noexcept
+    {
+        line.writeBlock (x, n);
+        line.readBlock<DelayLine::Interpolation::linear> (x, n, (float) latency);
+    }
+
+    // Block-rate read of a smoother: take the first value and advance it by the whole region.
+    static float blockValue (Smoother& sm, int n) noexcept
+    {
+        const float v = sm.getNextValue();
+        if (n > 1)
+            sm.skip (n - 1);
+        return v;
+    }
+
     void processEffectChorus (float* l, float* r, int n, const RuntimeParams& p) noexcept;
     void processEffectDelay  (float* l, float* r, int n, const RuntimeParams& p) noexcept;
     void processEffectReverb (float* l, float* r, int n, const RuntimeParams& p) noexcept;
     void processEffectDist   (float* l, float* r, int n, int osFactor, const RuntimeParams& p) noexcept;
+    void processDistAt (Distortion& d, float* l, float* r, int n, int factor, const RuntimeParams& p) noexcept;
     void processEffectPhaser (float* l, float* r, int n, const RuntimeParams& p) noexcept;
+    template <int Stages>
+    void runPhaserCascade (float* l, float* r, int n, float rate, float depth, float centre, float fb, float st) noexcept;
+    void resetPhaser() noexcept;
     void processEffectOctaver(float* l, float* r, int n, const RuntimeParams& p) noexcept;
 
     // State
@@ -574,18 +696,33 @@ private:
     int channels = 2;
 
     // Oversampling (pre-allocated).
-    juce::dsp::Oversampling<float> os2x { 2, 1, juce::dsp::Oversampling<float>::filterHalfBandPolyphaseIIR };
-    juce::dsp::Oversampling<float> os4x { 2, 2, juce::dsp::Oversampling<float>::filterHalfBandPolyphaseIIR };
+    // Linear phase with a whole-sample latency, so the delayed dry paths line up with the Dist output exactly.
+    juce::dsp::Oversampling<float> os2x { 2, 1, juce::dsp::Oversampling<float>::filterHalfBandFIREquiripple, true, true };
+    juce::dsp::Oversampling<float> os4x { 2, 2, juce::dsp::Oversampling<float>::filterHalfBandFIREquiripple, true, true };
     int osFactorPrev = 1;
+    int os2xLatency = 0;
+    int os4xLatency = 0;
+
+    // Latency compensation while oversampling: the signal entering the Dist slot (its dry, or all of it while Dist
+    // is bypassed) and the rack input for the global mix.
+    DelayLine distAlignL, distAlignR;
+    DelayLine globalAlignL, globalAlignR;
+    // The Dist output at a lower Oversample setting, padded up to the rack latency.
+    DelayLine distPadL, distPadR;
 
     Chorus chorusFx;
     Delay delayFx;
-    juce::Reverb reverbFx;
+    FdnReverb reverbFx;
     Distortion distFx;
     Distortion distFx2;
     Distortion distFx4;
-    std::array<float, 12> phaserStateL {};
-    std::array<float, 12> phaserStateR {};
+    // Phaser: L and R run as lanes 0/1 of one all-pass cascade (lanes 2/3 idle), one vector per stage.
+    static constexpr int phaserMaxStages = 12;
+    static constexpr int phaserControlInterval = 32; // samples between LFO / coefficient updates
+    alignas (16) std::array<float, 4 * phaserMaxStages> phaserState {};
+    alignas (16) std::array<float, 4> phaserFbMem {};
+    alignas (16) std::array<float, 4> phaserCoef {}; // all-pass coefficient per lane, as of the last sample
+    bool phaserCoefValid = false;
     float phaserLfoPhase = 0.0f;
     Octaver octaverFx;
 
@@ -636,10 +773,16 @@ private:
     juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> octSensSm;
     juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> octToneSm;
 
-    // Scratch buffers for wet/dry mixing (no allocations in process).
+    // Enable fades (0 = bypassed), per Block. Snapped to the enable flags on the first block after a reset.
+    std::array<Smoother, (size_t) numBlocks> enableSm;
+    bool enableSnapPending = true;
+
+    // Scratch buffers for wet/dry mixing (no allocations in process): channels [0, channels) hold the dry input
+    // of the block being run, [channels, 2 * channels) the rack input for the global mix.
     juce::AudioBuffer<float> scratch;
 
     Meters meters;
+    bool metersEnabled = true;
     std::atomic<float> hostBpm { 120.0f };
     std::array<int, (size_t) numBlocks> customOrder { { 0, 1, 2, 3, 4, 5 } };
 };
@@ -709,12 +852,29 @@ inline void FxChain::prepare (double sr, int maxBlockSize, int numChannels)
     resetSm (octSensSm, 0.5f);
     resetSm (octToneSm, 0.5f);
 
+    for (auto& sm : enableSm)
+    {
+        sm.reset (sampleRate, 0.01);
+        sm.setCurrentAndTargetValue (0.0f);
+    }
+    enableSnapPending = true;
+
     // Oversampling init (no allocations in process).
     os2x.initProcessing ((size_t) maxBlock);
     os4x.initProcessing ((size_t) maxBlock);
     os2x.reset();
     os4x.reset();
     osFactorPrev = 1;
+    os2xLatency = (int) std::lround (os2x.getLatencyInSamples());
+    os4xLatency = (int) std::lround (os4x.getLatencyInSamples());
+
+    const auto latency = getLatencySamples();
+    distAlignL.prepare (latency, maxBlock);
+    distAlignR.prepare (latency, maxBlock);
+    globalAlignL.prepare (latency, maxBlock);
+    globalAlignR.prepare (latency, maxBlock);
+    distPadL.prepare (latency, maxBlock);
+    distPadR.prepare (latency, maxBlock);
 
     chorusFx.prepare (sampleRate, maxBlock);
     delayFx.prepare (sampleRate);
@@ -723,15 +883,12 @@ inline void FxChain::prepare (double sr, int maxBlockSize, int numChannels)
     distFx4.prepare (sampleRate * 4.0);
     octaverFx.prepare (sampleRate);
 
-    reverbFx.reset();
-    reverbFx.setSampleRate (sampleRate);
-    phaserStateL.fill (0.0f);
-    phaserStateR.fill (0.0f);
-    phaserLfoPhase = 0.0f;
+    reverbFx.prepare (sampleRate);
+    resetPhaser();
 
     meters.reset();
 
-    scratch.setSize (channels, maxBlock, false, false, true);
+    scratch.setSize (2 * channels, maxBlock, false, false, true);
 }
 
 inline void FxChain::reset()
@@ -739,6 +896,12 @@ inline void FxChain::reset()
     os2x.reset();
     os4x.reset();
     osFactorPrev = 1;
+    distAlignL.reset();
+    distAlignR.reset();
+    globalAlignL.reset();
+    globalAlignR.reset();
+    distPadL.reset();
+    distPadR.reset();
 
     chorusFx.reset();
     delayFx.reset();
@@ -746,10 +909,9 @@ inline void FxChain::reset()
     distFx.reset();
     distFx2.reset();
     distFx4.reset();
-    phaserStateL.fill (0.0f);
-    phaserStateR.fill (0.0f);
-    phaserLfoPhase = 0.0f;
+    resetPhaser();
     octaverFx.reset();
+    enableSnapPending = true;
 
     meters.reset();
 }
@@ -785,108 +947,165 @@ inline void FxChain::processEffectDelay (float* l, float* r, int n, const Runtim
 
 inline void FxChain::processEffectReverb (float* l, float* r, int n, const RuntimeParams& p) noexcept
 {
-    juce::ignoreUnused (p);
-    // Set parameters once per block.
-    juce::dsp::Reverb::Parameters rp;
-    rp.roomSize   = juce::jlimit (0.0f, 1.0f, reverbSizeSm.getNextValue());
-    rp.damping    = juce::jlimit (0.0f, 1.0f, reverbDampSm.getNextValue());
-    rp.wetLevel   = 1.0f;
-    rp.dryLevel   = 0.0f;
-    rp.width      = juce::jlimit (0.0f, 1.0f, reverbWidthSm.getNextValue());
-    rp.freezeMode = 0.0f;
-    const float decay = juce::jlimit (0.0f, 1.0f, reverbDecaySm.getNextValue());
-    rp.roomSize = juce::jlimit (0.0f, 1.0f, rp.roomSize * (0.6f + 0.6f * decay));
-    reverbFx.setParameters (rp);
+    // Settings once per block; the tank glides line lengths internally.
+    FdnReverb::Settings s;
+    s.size01 = blockValue (reverbSizeSm, n);
+    s.decay01 = blockValue (reverbDecaySm, n);
+    s.damp01 = blockValue (reverbDampSm, n);
+    s.preDelayMs = blockValue (reverbPreDelaySm, n);
+    s.width01 = blockValue (reverbWidthSm, n);
+    s.lowCutHz = blockValue (reverbLowCutSm, n);
+    s.highCutHz = blockValue (reverbHighCutSm, n);
+    s.quality = p.reverbQuality;
+    reverbFx.setSettings (s);
+
+    reverbFx.process (l, r, n);
+}
 
-    for (int i = 0; i < n; ++i)
+inline void FxChain::processEffectDist (float* l, float* r, int n, int osFactor, const RuntimeParams& p) noexcept
+{
+    if (osFactor <= 1)
     {
-        float rr = (r != nullptr) ? r[i] : l[i];
-        reverbFx.processStereo (&l[i], &rr, 1);
-        if (r != nullptr) r[i] = rr;
-        else l[i] = 0.5f * (l[i] + rr);
+        processDistAt (distFx, l, r, n, 1, p);
+        return;
     }
+
+    auto& os = (osFactor == 4) ? os4x : os2x;
+    float* chans[] = { l, r };
+    juce::dsp::AudioBlock<float> block (chans, r != nullptr ? 2u : 1u, (size_t) n);
+
+    auto up = os.processSamplesUp (block);
+    processDistAt (osFactor == 4 ? distFx4 : distFx2,
+                   up.getChannelPointer (0),
+                   up.getNumChannels() > 1 ? up.getChannelPointer (1) : nullptr,
+                   n, osFactor, p);
+    os.processSamplesDown (block);
 }
 
-inline void FxChain::processEffectDist (float* l, float* r, int n, int osFactor, const RuntimeParams& p) noexcept
+// n base-rate samples, i.e. n * factor samples in l/r. Controls advance once per base sample.
+inline void FxChain::processDistAt (Distortion& d, float* l, float* r, int n, int factor, const RuntimeParams& p) noexcept
 {
-    auto process1x = [&] (Distortion& d) noexcept
+    for (int i = 0; i < n; ++i)
     {
-        for (int i = 0; i < n; ++i)
+        const float drive = distDriveSm.getNextValue();
+        const float tone = distToneSm.getNextValue();
+        const float postLp = distPostLpSm.getNextValue();
+        const float trim = distTrimSm.getNextValue();
+
+        for (int k = i * factor; k < (i + 1) * factor; ++k)
         {
-            float rr = (r != nullptr) ? r[i] : l[i];
-            d.processSample (l[i], rr, p.distType,
-                             distDriveSm.getNextValue(),
-                             distToneSm.getNextValue(),
-                             distPostLpSm.getNextValue(),
-                             distTrimSm.getNextValue());
-            if (r != nullptr) r[i] = rr;
-            else l[i] = 0.5f * (l[i] + rr);
+            float rr = (r != nullptr) ? r[k] : l[k];
+            d.processSample (l[k], rr, p.distType, drive, tone, postLp, trim);
+            if (r != nullptr) r[k] = rr;
+            else l[k] = 0.5f * (l[k] + rr);
         }
-    };
+    }
+}
 
-    if (osFactor == 2)
-        process1x (distFx2);
-    else if (osFactor == 4)
-        process1x (distFx4);
-    else
-        process1x (distFx);
+inline void FxChain::resetPhaser() noexcept
+{
+    phaserState.fill (0.0f);
+    phaserFbMem.fill (0.0f);
+    phaserCoef.fill (0.0f);
+    phaserCoefValid = false;
+    phaserLfoPhase = 0.0f;
 }
 
 inline void FxChain::processEffectPhaser (float* l, float* r, int n, const RuntimeParams& p) noexcept
 {
-    const float rate = juce::jlimit (0.01f, 20.0f, phaserRateSm.getNextValue());
-    const float depth = juce::jlimit (0.0f, 1.0f, phaserDepthSm.getNextValue());
-    const float centre = juce::jlimit (20.0f, 18000.0f, phaserCentreSm.getNextValue());
-    const float fb = juce::jlimit (-0.95f, 0.95f, phaserFbSm.getNextValue());
-    const float st = juce::jlimit (0.0f, 1.0f, phaserStereoSm.getNextValue());
-    const int stageChoice = juce::jlimit (0, 3, p.phaserStages);
-    const int stageCount = (stageChoice == 0 ? 4 : stageChoice == 1 ? 6 : stageChoice == 2 ? 8 : 12);
+    const float rate = juce::jlimit (0.01f, 20.0f, blockValue (phaserRateSm, n));
+    const float depth = juce::jlimit (0.0f, 1.0f, blockValue (phaserDepthSm, n));
+    const float centre = juce::jlimit (20.0f, 18000.0f, blockValue (phaserCentreSm, n));
+    const float fb = juce::jlimit (-0.95f, 0.95f, blockValue (phaserFbSm, n));
+    const float st = juce::jlimit (0.0f, 1.0f, blockValue (phaserStereoSm, n));
 
-    float fbMemL = 0.0f;
-    float fbMemR = 0.0f;
+    switch (juce::jlimit (0, 3, p.phaserStages))
+    {
+        case 0:  runPhaserCascade<4>  (l, r, n, rate, depth, centre, fb, st); break;
+        case 1:  runPhaserCascade<6>  (l, r, n, rate, depth, centre, fb, st); break;
+        case 2:  runPhaserCascade<8>  (l, r, n, rate, depth, centre, fb, st); break;
+        default: runPhaserCascade<12> (l, r, n, rate, depth, centre, fb, st); break;
+    }
+}
 
-    for (int i = 0; i < n; ++i)
+// The LFO and the all-pass coefficients are evaluated every phaserControlInterval samples and ramped linearly in
+// between; the cascade itself runs both channels at once.
+template <int Stages>
+inline void FxChain::runPhaserCascade (float* l, float* r, int n, float rate, float depth, float centre, float fb, float st) noexcept
+{
+    using V = simd::Vec4;
+    static_assert (Stages <= phaserMaxStages);
+
+    const float invSr = 1.0f / (float) sampleRate;
+    const float maxHz = juce::jmin (18000.0f, (float) sampleRate * 0.45f);
+    auto coefAt = [&] (float phase, float cHz) noexcept
     {
-        phaserLfoPhase += rate / (float) sampleRate;
-        if (phaserLfoPhase >= 1.0f)
-            phaserLfoPhase -= 1.0f;
+        const float freq = juce::jlimit (20.0f, maxHz, cHz * ies::math::fastExp2 (depth * ies::math::fastSin2Pi (phase)));
+        const float t = ies::math::fastTanPi (freq * invSr);
+        return (1.0f - t) / (1.0f + t);
+    };
+    const float centreR = centre * (1.0f + 0.08f * st);
+    const float offsetR = 0.2f * st;
 
-        const float phL = phaserLfoPhase;
-        const float phR = phaserLfoPhase + 0.2f * st;
-        const float lfoL = std::sin (juce::MathConstants<float>::twoPi * phL);
-        const float lfoR = std::sin (juce::MathConstants<float>::twoPi * (phR - std::floor (phR)));
+    V::T state[Stages];
+    for (int s = 0; s < Stages; ++s)
+        state[s] = V::load (phaserState.data() + 4 * s);
+    auto fbMem = V::load (phaserFbMem.data());
+    auto a = V::load (phaserCoef.data());
+    const auto fbGain = V::set (fb);
 
-        auto coefFromLfo = [&] (float lfo, float cHz) noexcept
-        {
-            const float freq = juce::jlimit (20.0f, 18000.0f, cHz * std::exp2 (depth * lfo));
-            const float w = juce::MathConstants<float>::pi * freq / (float) sampleRate;
-            const float t = std::tan (w);
-            return (1.0f - t) / (1.0f + t + 1.0e-9f);
-        };
+    if (! phaserCoefValid)
+    {
+        a = V::set (coefAt (phaserLfoPhase, centre), coefAt (phaserLfoPhase + offsetR, centreR), 0.0f, 0.0f);
+        phaserCoefValid = true;
+    }
 
-        const float aL = coefFromLfo (lfoL, centre);
-        const float aR = coefFromLfo (lfoR, centre * (1.0f + 0.08f * st));
+    alignas (16) float out[4];
+    for (int start = 0; start < n; start += phaserControlInterval)
+    {
+        const int len = juce::jmin (phaserControlInterval, n - start);
 
-        float xl = l[i] + fb * fbMemL;
-        float xr = (r != nullptr ? r[i] : l[i]) + fb * fbMemR;
+        // Coefficients at the end of this stretch; ramp towards them.
+        phaserLfoPhase += rate * invSr * (float) len;
+        phaserLfoPhase -= std::floor (phaserLfoPhase);
+        const auto target = V::set (coefAt (phaserLfoPhase, centre), coefAt (phaserLfoPhase + offsetR, centreR), 0.0f, 0.0f);
+        const auto step = V::mul (V::sub (target, a), V::set (1.0f / (float) len));
 
-        for (int s = 0; s < stageCount; ++s)
+        for (int i = start; i < start + len; ++i)
         {
-            const float yl = -aL * xl + phaserStateL[(size_t) s];
-            phaserStateL[(size_t) s] = xl + aL * yl;
-            xl = yl;
+            a = V::add (a, step);
+
+            const float inL = l[i];
+            const float inR = (r != nullptr) ? r[i] : inL;
+            auto x = V::add (V::set (inL, inR, 0.0f, 0.0f), V::mul (fbGain, fbMem));
 
-            const float yr = -aR * xr + phaserStateR[(size_t) s];
-            phaserStateR[(size_t) s] = xr + aR * yr;
-            xr = yr;
+            for (int s = 0; s < Stages; ++s)
+            {
+                const auto y = V::sub (state[s], V::mul (a, x));
+                state[s] = V::add (x, V::mul (a, y));
+                x = y;
+            }
+
+            fbMem = x;
+            V::store (out, x);
+            if (r != nullptr)
+            {
+                l[i] = out[0];
+                r[i] = out[1];
+            }
+            else
+            {
+                l[i] = 0.5f * (out[0] + out[1]);
+            }
         }
 
-        fbMemL = xl;
-        fbMemR = xr;
-        l[i] = xl;
-        if (r != nullptr) r[i] = xr;
-        else l[i] = 0.5f * (xl + xr);
+        a = target; // no drift from the accumulated steps
     }
+
+    for (int s = 0; s < Stages; ++s)
+        V::store (phaserState.data() + 4 * s, state[s]);
+    V::store (phaserFbMem.data(), fbMem);
+    V::store (phaserCoef.data(), a);
 }
 
 inline void FxChain::processEffectOctaver (float* l, float* r, int n, const RuntimeParams& p) noexcept
@@ -966,10 +1185,9 @@ inline void FxChain::process (juce::AudioBuffer<float>& buffer, int startSample,
     setTargetIfChanged (octToneSm, juce::jlimit (0.0f, 1.0f, p.octaverTone01));
 
     // Oversampling policy (applies to distortion stage). Reset state on switch to avoid bursts.
-    const int osChoice = juce::jlimit ((int) params::fx::global::osOff, (int) params::fx::global::os4x, oversampleChoice);
-    const int osFactor = (osChoice == (int) params::fx::global::os2x) ? 2
-                       : (osChoice == (int) params::fx::global::os4x) ? 4
-                       : 1;
+    const int osFactor = osFactorFor (oversampleChoice);
+    const int latency = getLatencySamples();
+    const int distPad = latency - osLatencyFor (osFactor);
 
     if (osFactor != osFactorPrev)
     {
@@ -977,64 +1195,146 @@ inline void FxChain::process (juce::AudioBuffer<float>& buffer, int startSample,
         osFactorPrev = osFactor;
     }
 
+    // Enable fades. After a reset the effects start from clean state, so they come in without a fade.
+    for (int bi = 0; bi < (int) numBlocks; ++bi)
+    {
+        auto& sm = enableSm[(size_t) bi];
+        const float target = isBlockEnabled ((Block) bi, p) ? 1.0f : 0.0f;
+        if (enableSnapPending)
+            sm.setCurrentAndTargetValue (target);
+        else
+            setTargetIfChanged (sm, target);
+    }
+    enableSnapPending = false;
+
     // Work pointers for this region.
     auto* l = buffer.getWritePointer (0, startSample);
     float* r = (channels > 1 && buffer.getNumChannels() > 1) ? buffer.getWritePointer (1, startSample) : nullptr;
 
-    // Preserve dry for global mix.
+    auto isBypassed = [&] (Block b) noexcept
+    {
+        return ! isBlockEnabled (b, p) && ! enableSm[(size_t) b].isSmoothing();
+    };
+
+    bool anyActive = false;
+    for (int bi = 0; bi < (int) numBlocks; ++bi)
+        anyActive = anyActive || ! isBypassed ((Block) bi);
+
+    if (! anyActive)
+    {
+        // Idle rack: wet == dry, so the global mix is a no-op too. Smoothers still keep time.
+        for (int bi = 0; bi < (int) numBlocks; ++bi)
+            getMixSmoother ((Block) bi).skip (numSamples);
+        globalMixSm.skip (numSamples);
+
+        // Still delayed by the Dist slot, so the latency does not depend on which blocks are on.
+        if (latency > 0)
+        {
+            globalAlignL.writeBlock (l, numSamples);
+            alignBlock (distAlignL, l, numSamples, latency);
+            if (r != nullptr)
+            {
+                globalAlignR.writeBlock (r, numSamples);
+                alignBlock (distAlignR, r, numSamples, latency);
+            }
+        }
+
+        if (metersEnabled)
+        {
+            const float peak = blockPeak (l, r, numSamples);
+            for (int bi = 0; bi < (int) numBlocks; ++bi)
+            {
+                updatePeak (meters.prePeak[(size_t) bi], peak);
+                updatePeak (meters.postPeak[(size_t) bi], peak);
+            }
+            updatePeak (meters.outPeak, peak);
+        }
+        return;
+    }
+
+    // Preserve the rack input for the global mix.
     auto* dryL = scratch.getWritePointer (0, 0);
     float* dryR = (channels > 1) ? scratch.getWritePointer (1, 0) : nullptr;
-    std::memcpy (dryL, l, (size_t) numSamples * sizeof (float));
-    if (r != nullptr && dryR != nullptr)
-        std::memcpy (dryR, r, (size_t) numSamples * sizeof (float));
+    auto* inL = scratch.getWritePointer (channels, 0);
+    float* inR = (channels > 1) ? scratch.getWritePointer (channels + 1, 0) : nullptr;
+    std::memcpy (inL, l, (size_t) numSamples * sizeof (float));
+    if (r != nullptr && inR != nullptr)
+        std::memcpy (inR, r, (size_t) numSamples * sizeof (float));
+
+    if (latency > 0)
+    {
+        alignBlock (globalAlignL, inL, numSamples, latency);
+        if (r != nullptr && inR != nullptr)
+            alignBlock (globalAlignR, inR, numSamples, latency);
+    }
 
     auto run = [&] (Block b) noexcept
     {
         const int bi = (int) b;
+        auto& mixSm = getMixSmoother (b);
 
-        // Cache pre peak.
-        const float pre = blockPeak (l, r, numSamples);
-        meters.prePeak[(size_t) bi].store (juce::jmax (meters.prePeak[(size_t) bi].load (std::memory_order_relaxed) * 0.92f, pre),
-                                           std::memory_order_relaxed);
+        // Bypassed: the effect keeps its state untouched until it is switched back on.
+        if (isBypassed (b))
+        {
+            mixSm.skip (numSamples);
+            if (b == dist && latency > 0)
+            {
+                alignBlock (distAlignL, l, numSamples, latency);
+                if (r != nullptr)
+                    alignBlock (distAlignR, r, numSamples, latency);
+            }
+            if (metersEnabled)
+            {
+                const float peak = blockPeak (l, r, numSamples);
+                updatePeak (meters.prePeak[(size_t) bi], peak);
+                updatePeak (meters.postPeak[(size_t) bi], peak);
+            }
+            return;
+        }
+
+        if (metersEnabled)
+            updatePeak (meters.prePeak[(size_t) bi], blockPeak (l, r, numSamples));
 
         // Per-FX wet/dry: keep a dry copy for this block in scratch.
         std::memcpy (dryL, l, (size_t) numSamples * sizeof (float));
         if (r != nullptr && dryR != nullptr)
             std::memcpy (dryR, r, (size_t) numSamples * sizeof (float));
 
+        // Runs while enabled and while fading out after being disabled.
         switch (b)
         {
-            case chorus:
-                if (p.chorusEnable) processEffectChorus (l, r, numSamples, p);
-                mixWetDry (l, r, dryL, dryR, numSamples, chorusMixSm.getNextValue());
-                break;
-            case delay:
-                if (p.delayEnable) processEffectDelay (l, r, numSamples, p);
-                mixWetDry (l, r, dryL, dryR, numSamples, delayMixSm.getNextValue());
-                break;
-            case reverb:
-                if (p.reverbEnable) processEffectReverb (l, r, numSamples, p);
-                mixWetDry (l, r, dryL, dryR, numSamples, reverbMixSm.getNextValue());
-                break;
+            case chorus:  processEffectChorus (l, r, numSamples, p); break;
+            case delay:   processEffectDelay (l, r, numSamples, p); break;
+            case reverb:  processEffectReverb (l, r, numSamples, p); break;
             case dist:
-                if (p.distEnable) processEffectDist (l, r, numSamples, osFactor, p);
-                mixWetDry (l, r, dryL, dryR, numSamples, distMixSm.getNextValue());
-                break;
-            case phaser:
-                if (p.phaserEnable) processEffectPhaser (l, r, numSamples, p);
-                mixWetDry (l, r, dryL, dryR, numSamples, phaserMixSm.getNextValue());
-                break;
-            case octaver:
-                if (p.octaverEnable) processEffectOctaver (l, r, numSamples, p);
-                mixWetDry (l, r, dryL, dryR, numSamples, octMixSm.getNextValue());
+                processEffectDist (l, r, numSamples, osFactor, p);
+                if (distPad > 0)
+                {
+                    alignBlock (distPadL, l, numSamples, distPad);
+                    if (r != nullptr)
+                        alignBlock (distPadR, r, numSamples, distPad);
+                }
+                if (latency > 0)
+                {
+                    alignBlock (distAlignL, dryL, numSamples, latency);
+                    if (r != nullptr && dryR != nullptr)
+                        alignBlock (distAlignR, dryR, numSamples, latency);
+                }
                 break;
+            case phaser:  processEffectPhaser (l, r, numSamples, p); break;
+            case octaver: processEffectOctaver (l, r, numSamples, p); break;
             case numBlocks:
             default: break;
         }
 
-        const float post = blockPeak (l, r, numSamples);
-        meters.postPeak[(size_t) bi].store (juce::jmax (meters.postPeak[(size_t) bi].load (std::memory_order_relaxed) * 0.92f, post),
-                                            std::memory_order_relaxed);
+        auto& enSm = enableSm[(size_t) bi];
+        if (enSm.isSmoothing())
+            mixWetDryFaded (l, r, dryL, dryR, numSamples, mixSm, enSm);
+        else
+            mixWetDry (l, r, dryL, dryR, numSamples, mixSm);
+
+        if (metersEnabled)
+            updatePeak (meters.postPeak[(size_t) bi], blockPeak (l, r, numSamples));
     };
 
     const int ord = juce::jlimit ((int) params::fx::global::orderFixedA, (int) params::fx::global::orderCustom, orderChoice);
@@ -1062,14 +1362,11 @@ inline void FxChain::process (juce::AudioBuffer<float>& buffer, int startSample,
         run (reverb);
     }
 
-    // Global wet/dry (dry is original pre-FX).
-    mixWetDry (l, r, scratch.getReadPointer (0, 0),
-               (channels > 1 ? scratch.getReadPointer (1, 0) : nullptr),
-               numSamples, globalMixSm.getNextValue());
+    // Global wet/dry (dry is the rack input).
+    mixWetDry (l, r, inL, inR, numSamples, globalMixSm);
 
     // Out peak (UI).
-    const float peak = blockPeak (l, r, numSamples);
-    meters.outPeak.store (juce::jmax (meters.outPeak.load (std::memory_order_relaxed) * 0.92f, peak),
-                          std::memory_order_relaxed);
+    if (metersEnabled)
+        updatePeak (meters.outPeak, blockPeak (l, r, numSamples));
 }
 } // namespace ies::dsp
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <JuceHeader.h>
+
+#include <array>
+
+#include "SimdVec.h"
+
+namespace ies::dsp
+{
+// Weighted sum of the first harmonics of a phasor, sum_k w_k * sin (k * 2pi * phase), built from a single sin/cos
+// pair per sample with the Chebyshev recurrence sin (k t) = 2 cos t * sin ((k - 1) t) - sin ((k - 2) t).
+// Four samples run per vector; odd and even harmonics are two independent chains stepping by 2t so the
+// dependency chain is half as long. Weights are meant to change at control rate (between processBlock calls);
+// harmonics after the last non-zero weight cost nothing.
+class HarmonicSeries final
+{
+public:
+    static constexpr int maxHarmonics = 16;
+
+    // weights[k] applies to harmonic k + 1.
+    void setWeights (const float* weights, int numHarmonics) noexcept
+    {
+        const auto n = juce::jlimit (0, maxHarmonics, numHarmonics);
+        numActive = 0;
+        for (int k = 0; k < maxHarmonics; ++k)
+        {
+            w[(size_t) k] = k < n ? weights[k] : 0.0f;
+            if (w[(size_t) k] != 0.0f)
+                numActive = k + 1;
+        }
+    }
+
+    void processBlock (const float* phases01, float* out, int numSamples) const noexcept
+    {
+        int i = 0;
+        for (; i + 4 <= numSamples; i += 4)
+            Vec::storeUnaligned (out + i, process4 (Vec::loadUnaligned (phases01 + i)));
+
+        if (i < numSamples)
+        {
+            alignas (16) float tmp[4] {};
+            const int rest = numSamples - i;
+            for (int k = 0; k < rest; ++k)
+                tmp[k] = phases01[i + k];
+
+            Vec::store (tmp, process4 (Vec::load (tmp)));
+            for (int k = 0; k < rest; ++k)
+                out[i + k] = tmp[k];
+        }
+    }
+
+private:
+    using Vec = simd::Vec4;
+
+    Vec::T process4 (Vec::T phase) const noexcept
+    {
+        const auto s1 = simd::sin2Pi (phase);
+        if (numActive <= 1)
+            return Vec::mul (s1, Vec::set (w[0]));
+
+        const auto c1 = simd::sin2Pi (Vec::add (phase, Vec::set (0.25f)));
+        const auto two = Vec::set (2.0f);
+        const auto s2 = Vec::mul (two, Vec::mul (s1, c1));
+        const auto twoC2 = Vec::mul (two, Vec::sub (Vec::mul (two, Vec::mul (c1, c1)), Vec::set (1.0f)));
+
+        // Odd chain: sin t, sin 3t, ...; even chain: sin 2t, sin 4t, ...
+        auto oddPrev = Vec::sub (Vec::set (0.0f), s1); // sin (-t)
+        auto odd = s1;
+        auto evenPrev = Vec::set (0.0f);
+        auto even = s2;
+
+        auto sum = Vec::add (Vec::mul (odd, Vec::set (w[0])), Vec::mul (even, Vec::set (w[1])));
+        for (int k = 2; k < numActive; k += 2)
+        {
+            const auto oddNext = Vec::sub (Vec::mul (twoC2, odd), oddPrev);
+            const auto evenNext = Vec::sub (Vec::mul (twoC2, even), evenPrev);
+            oddPrev = odd;
+            odd = oddNext;
+            evenPrev = even;
+            even = evenNext;
+
+            sum = Vec::add (sum, Vec::add (Vec::mul (odd, Vec::set (w[(size_t) k])),
+                                           Vec::mul (even, Vec::set (w[(size_t) k + 1]))));
+        }
+
+        return sum;
+    }
+
+    std::array<float, maxHarmonics> w {};
+    int numActive = 0;
+};
+} // namespace ies::dsp
@@ -41,6 +41,17 @@ public:
         return out;
     }
 
+    // Control-rate step: returns the value at the current phase, then advances by numSamples.
+    float process (int numSamples) noexcept
+    {
+        const auto out = render (phase, wave);
+
+        phase += frequencyHz * (float) juce::jmax (1, numSamples) / sampleRateHz;
+        phase -= std::floor (phase);
+
+        return out;
+    }
+
 private:
     static float wrap01 (float x) noexcept
     {
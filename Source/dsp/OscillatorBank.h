@@ -0,0 +1,390 @@
+#pragma once
+
+#include <JuceHeader.h>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "../Util/Math.h"
+#include "SimdVec.h"
+#include "WavetableReader.h"
+#include "WavetableSet.h"
+
+namespace ies::dsp
+{
+// Four oscillators in SoA lanes (osc1..3 + a spare lane for a sub/noise source).
+// Primitive waves (polyBLEP saw/square, polyBLAMP triangle) run 4-wide, four consecutive samples of one lane per
+// vector; wavetable lanes are read per lane in a second pass. Lane 0 can hard-sync lane 1, which falls back to
+// running the four lanes side by side, one sample at a time.
+class OscillatorBank final
+{
+public:
+    static constexpr int numLanes = 4;
+
+    enum class Shape
+    {
+        off,
+        saw,
+        square,
+        triangle,
+        wavetable
+    };
+
+    void prepare (double sampleRateHz, int maxBlockSize)
+    {
+        sampleRate = sampleRateHz > 0.0 ? (float) sampleRateHz : 44100.0f;
+        maxFrames = juce::jmax (1, maxBlockSize);
+
+        // Interleaved lane frames: [inc0 inc1 inc2 inc3] / [out0 out1 out2 out3] per sample, 16-byte aligned.
+        // Increments get three spare frames so the free-running kernel can always transpose whole four-sample chunks.
+        increments.assign ((size_t) ((maxFrames + 3) * numLanes + numLanes), 0.0f);
+        frames.assign ((size_t) (maxFrames * numLanes + numLanes), 0.0f);
+        phaseFrames.assign ((size_t) (maxFrames * numLanes + numLanes), 0.0f);
+
+        // Lane-major runs for the free-running kernel: increments, and the phases of wavetable lanes.
+        laneStride = (maxFrames + 3) & ~3;
+        laneScratch.assign ((size_t) (laneStride * numLanes + numLanes), 0.0f);
+        laneIncs.assign ((size_t) (laneStride * numLanes + numLanes), 0.0f);
+
+        phase.fill (0.0f);
+        shapes.fill (Shape::off);
+        tables.fill (nullptr);
+        for (auto& r : readers)
+            r.setTable (nullptr);
+        syncEnabled = false;
+        syncPhase = 0.0f;
+    }
+
+    void setPhase (int lane, float newPhase01) noexcept
+    {
+        const auto l = (size_t) juce::jlimit (0, numLanes - 1, lane);
+        phase[l] = ies::math::wrap01 (newPhase01);
+    }
+
+    // Wavetable lanes with a null table fall back to saw.
+    void setShape (int lane, Shape shape, const WavetableSet* table = nullptr) noexcept
+    {
+        const auto l = (size_t) juce::jlimit (0, numLanes - 1, lane);
+        if (shape == Shape::wavetable && table == nullptr)
+            shape = Shape::saw;
+
+        shapes[l] = shape;
+        tables[l] = (shape == Shape::wavetable) ? table : nullptr;
+        readers[l].setTable (tables[l]);
+    }
+
+    void setWavetableInterpolation (WavetableReader::Interpolation mode) noexcept
+    {
+        for (auto& r : readers)
+            r.setInterpolation (mode);
+    }
+
+    // On every lane 0 wrap, lane 1 restarts from phase01.
+    void setHardSync (bool enabled, float phase01) noexcept
+    {
+        syncEnabled = enabled;
+        syncPhase = phase01;
+    }
+
+    float incrementForHz (float hz) const noexcept
+    {
+        auto inc = (sampleRate > 0.0f) ? (hz / sampleRate) : 0.0f;
+        if (! std::isfinite (inc) || inc < 0.0f) inc = 0.0f;
+        if (inc > 0.5f) inc = 0.5f; // keep dt sensible for polyBLEP
+        return inc;
+    }
+
+    // The numLanes phase increments (cycles/sample) of one sample frame; fill before processBlock().
+    float* incrementsAt (int sampleIndex) noexcept
+    {
+        return alignedFrames (increments) + (size_t) juce::jlimit (0, maxFrames - 1, sampleIndex) * (size_t) numLanes;
+    }
+
+    // outs[lane] may be null for lanes whose output isn't needed. n must not exceed the prepared block size.
+    void processBlock (float* const* outs, int n) noexcept
+    {
+        n = juce::jmin (n, maxFrames);
+        if (n <= 0)
+            return;
+
+        if (syncEnabled)
+            processSynced (outs, n);
+        else
+            processFree (outs, n);
+    }
+
+    // Kernel helpers, shared with UnisonOscillator.
+    static float* alignedFrames (std::vector<float>& v) noexcept
+    {
+        // The vectors carry one spare frame so the data can be rounded up to a 16-byte boundary.
+        auto addr = reinterpret_cast<std::uintptr_t> (v.data());
+        addr = (addr + 15u) & ~(std::uintptr_t) 15u;
+        return reinterpret_cast<float*> (addr);
+    }
+
+    static float idealTriangleFromPhase (float t) noexcept
+    {
+        // Triangle that is -1 at phase edges and +1 at phase 0.5.
+        const auto naive = 4.0f * std::abs (t - 0.5f) - 1.0f; // +1 at edges, -1 at 0.5
+        return -naive;
+    }
+
+private:
+    using Vec = simd::Vec4;
+
+    // Free-running lanes are independent, so each lane runs on its own, four consecutive samples per vector. The
+    // phase is 0.32 fixed point, which turns its recurrence into a wrapping prefix sum (integer adds, no wrap test)
+    // with one loop-carried step per four samples. The triangle is drawn from the phase (polyBLAMP at the corners)
+    // rather than integrated from the square, so nothing else carries from sample to sample.
+    void processFree (float* const* outs, int n) noexcept
+    {
+        // Lane-major increments. Frames past n (up to the next multiple of four) are zeroed, so the last chunk
+        // leaves each phase where sample n put it.
+        const int numChunks = (n + 3) / 4;
+        float* inc = alignedFrames (increments);
+        std::fill (inc + (size_t) n * numLanes, inc + (size_t) numChunks * 4 * numLanes, 0.0f);
+        float* laneInc = alignedFrames (laneIncs);
+        for (int c = 0; c < numChunks; ++c)
+        {
+            const auto* frame = inc + (size_t) c * 4 * numLanes;
+            auto a = Vec::load (frame), b = Vec::load (frame + 4), d = Vec::load (frame + 8), e = Vec::load (frame + 12);
+            Vec::transpose (a, b, d, e);
+            Vec::store (laneInc + (size_t) c * 4, a);
+            Vec::store (laneInc + (size_t) (laneStride + c * 4), b);
+            Vec::store (laneInc + (size_t) (2 * laneStride + c * 4), d);
+            Vec::store (laneInc + (size_t) (3 * laneStride + c * 4), e);
+        }
+
+        // Nothing listens to a lane that is off or has no output, so it is not run at all; its phase holds until
+        // it is needed again (free-running phase is arbitrary anyway, and new notes set it explicitly).
+        for (size_t l = 0; l < (size_t) numLanes; ++l)
+        {
+            auto* dst = outs[l];
+            if (dst == nullptr)
+                continue;
+
+            switch (shapes[l])
+            {
+                case Shape::saw:       runLane<Shape::saw> (l, dst, n); break;
+                case Shape::square:    runLane<Shape::square> (l, dst, n); break;
+                case Shape::triangle:  runLane<Shape::triangle> (l, dst, n); break;
+                case Shape::wavetable:
+                {
+                    auto* phases = alignedFrames (laneScratch) + l * (size_t) laneStride;
+                    runLane<Shape::wavetable> (l, phases, n);
+                    readers[l].readBlock (phases, laneInc + l * (size_t) laneStride, 1, dst, n);
+                    break;
+                }
+                case Shape::off:
+                default:
+                    std::fill (dst, dst + n, 0.0f);
+                    break;
+            }
+        }
+    }
+
+    // Writes lane l's wave (its phases for wavetable lanes) for n samples and advances its phase.
+    template <Shape shape>
+    void runLane (size_t l, float* out, int n) noexcept
+    {
+        const float* dts = alignedFrames (laneIncs) + l * (size_t) laneStride;
+
+        const auto one = Vec::set (1.0f);
+        const auto two = Vec::set (2.0f);
+        const auto four = Vec::set (4.0f);
+        const auto eight = Vec::set (8.0f);
+        const auto half = Vec::set (0.5f);
+        const auto halfCycle = Vec::set (simd::fromBits (0x80000000u));
+
+        auto carry = Vec::set (simd::fromBits ((std::uint32_t) ((double) phase[l] * 4294967296.0)));
+
+        auto step = [&] (int i) noexcept
+        {
+            const auto d = Vec::load (dts + i);
+
+            // Phase at each of the four samples (before its own increment), then the carry into the next chunk.
+            const auto fd = Vec::fixedFromUnit (d);
+            auto scan = Vec::addFixed (fd, Vec::shiftUp1 (fd));
+            scan = Vec::addFixed (scan, Vec::shiftUp2 (scan));
+            const auto x = Vec::addFixed (carry, Vec::shiftUp1 (scan));
+            carry = Vec::splatLast (Vec::addFixed (carry, scan));
+            const auto t = Vec::unitFromFixed (x);
+
+            if constexpr (shape == Shape::wavetable)
+            {
+                return t;
+            }
+            else
+            {
+                // Distance from the middle of the cycle; the residuals below are only non-zero within dt of an edge
+                // or corner, so most chunks skip them entirely.
+                const auto fromMid = Vec::abs (Vec::sub (t, half));
+
+                if constexpr (shape == Shape::saw)
+                {
+                    auto y = Vec::sub (Vec::mul (two, t), one);
+                    if (Vec::any (Vec::gt (fromMid, Vec::sub (half, d))))
+                        y = Vec::sub (y, simd::polyBlep (t, d));
+                    return y;
+                }
+                else
+                {
+                    // Square edges and triangle corners sit at 0 and 0.5.
+                    const auto nearEdge = Vec::lt (Vec::min (fromMid, Vec::sub (half, fromMid)), d);
+
+                    if constexpr (shape == Shape::square)
+                    {
+                        auto y = Vec::sub (one, Vec::bitAnd (two, Vec::ge (t, half)));
+                        if (Vec::any (nearEdge))
+                        {
+                            const auto t2 = Vec::unitFromFixed (Vec::addFixed (x, halfCycle));
+                            y = Vec::sub (Vec::add (y, simd::polyBlep (t, d)), simd::polyBlep (t2, d));
+                        }
+                        return y;
+                    }
+                    else
+                    {
+                        // -1 at the cycle edges, +1 in the middle; the slope turns by 8 * dt per sample at each corner.
+                        auto y = Vec::sub (one, Vec::mul (four, fromMid));
+                        if (Vec::any (nearEdge))
+                        {
+                            const auto t2 = Vec::unitFromFixed (Vec::addFixed (x, halfCycle));
+                            const auto corners = Vec::sub (simd::polyBlamp (t, d), simd::polyBlamp (t2, d));
+                            y = Vec::add (y, Vec::mul (Vec::mul (eight, d), corners));
+                        }
+                        return y;
+                    }
+                }
+            }
+        };
+
+        const int whole = n & ~3;
+        for (int i = 0; i < whole; i += 4)
+            Vec::storeUnaligned (out + i, step (i));
+
+        if (whole < n)
+        {
+            alignas (16) float tail[4];
+            Vec::store (tail, step (whole));
+            std::copy (tail, tail + (n - whole), out + whole);
+        }
+
+        alignas (16) float v[4];
+        Vec::store (v, carry);
+        phase[l] = (float) (simd::toBits (v[0]) >> 8) * (1.0f / 16777216.0f);
+    }
+
+    // Hard sync couples lane 1 to lane 0 sample by sample, so this path runs the lanes side by side instead.
+    void processSynced (float* const* outs, int n) noexcept
+    {
+        alignas (16) float maskSaw[numLanes], maskSquare[numLanes], maskOn[numLanes];
+        bool anyTable = false;
+        for (size_t l = 0; l < (size_t) numLanes; ++l)
+        {
+            maskSaw[l]    = simd::bitsIf (shapes[l] == Shape::saw);
+            maskSquare[l] = simd::bitsIf (shapes[l] == Shape::square);
+            maskOn[l]     = simd::bitsIf (shapes[l] != Shape::off);
+            anyTable = anyTable || (shapes[l] == Shape::wavetable);
+        }
+
+        const auto mSaw = Vec::load (maskSaw);
+        const auto mSquare = Vec::load (maskSquare);
+        const auto mOn = Vec::load (maskOn);
+
+        const auto one = Vec::set (1.0f);
+        const auto minusOne = Vec::set (-1.0f);
+        const auto two = Vec::set (2.0f);
+        const auto four = Vec::set (4.0f);
+        const auto eight = Vec::set (8.0f);
+        const auto half = Vec::set (0.5f);
+
+        auto p = Vec::load (phase.data());
+
+        const float* inc = alignedFrames (increments);
+        float* frame = alignedFrames (frames);
+        float* phaseFrame = alignedFrames (phaseFrames);
+
+        for (int i = 0; i < n; ++i, inc += numLanes, frame += numLanes, phaseFrame += numLanes)
+        {
+            const auto dt = Vec::load (inc);
+
+            auto saw = Vec::sub (Vec::mul (two, p), one);
+            auto sq = Vec::select (Vec::lt (p, half), one, minusOne);
+            auto tri = Vec::sub (one, Vec::mul (four, Vec::abs (Vec::sub (p, half))));
+            auto t2 = Vec::sub (Vec::add (p, one), half);
+            t2 = Vec::sub (t2, Vec::bitAnd (one, Vec::ge (t2, one)));
+
+            // polyBLEP/BLAMP residuals are only non-zero within dt of an edge; most samples skip them entirely.
+            const auto oneMinusDt = Vec::sub (one, dt);
+            const auto nearEdge = Vec::bitOr (Vec::bitOr (Vec::lt (p, dt), Vec::gt (p, oneMinusDt)),
+                                              Vec::bitOr (Vec::lt (t2, dt), Vec::gt (t2, oneMinusDt)));
+            if (Vec::any (nearEdge))
+            {
+                const auto blep = simd::polyBlep (p, dt);
+                saw = Vec::sub (saw, blep);
+                sq = Vec::add (sq, blep);
+                sq = Vec::sub (sq, simd::polyBlep (t2, dt));
+                tri = Vec::add (tri, Vec::mul (Vec::mul (eight, dt), Vec::sub (simd::polyBlamp (p, dt), simd::polyBlamp (t2, dt))));
+            }
+
+            const auto out = Vec::select (mSaw, saw, Vec::select (mSquare, sq, tri));
+            Vec::store (frame, Vec::bitAnd (out, mOn));
+
+            // Wavetable lanes are looked up after the loop from the recorded phases (hard sync included).
+            if (anyTable)
+                Vec::store (phaseFrame, p);
+
+            p = Vec::add (p, dt);
+            const auto wrapped = Vec::ge (p, one);
+            if (Vec::any (wrapped))
+            {
+                p = Vec::sub (p, Vec::bitAnd (one, wrapped));
+
+                if (Vec::firstLane (wrapped))
+                {
+                    Vec::store (phase.data(), p);
+                    setPhase (1, syncPhase);
+                    p = Vec::load (phase.data());
+                }
+            }
+        }
+
+        Vec::store (phase.data(), p);
+
+        if (anyTable)
+        {
+            for (size_t l = 0; l < (size_t) numLanes; ++l)
+                if (tables[l] != nullptr)
+                    readers[l].readBlock (alignedFrames (phaseFrames) + l, alignedFrames (increments) + l, numLanes,
+                                          alignedFrames (frames) + l, n);
+        }
+
+        const float* src = alignedFrames (frames);
+        for (size_t l = 0; l < (size_t) numLanes; ++l)
+        {
+            if (auto* dst = outs[l])
+                for (int i = 0; i < n; ++i)
+                    dst[i] = src[(size_t) i * (size_t) numLanes + l];
+        }
+    }
+
+    float sampleRate = 44100.0f;
+
+    alignas (16) std::array<float, (size_t) numLanes> phase {};
+    std::array<Shape, (size_t) numLanes> shapes {};
+    std::array<const WavetableSet*, (size_t) numLanes> tables {};
+    std::array<WavetableReader, (size_t) numLanes> readers {};
+    std::vector<float> increments;
+    std::vector<float> frames;
+    std::vector<float> phaseFrames;
+    std::vector<float> laneScratch;
+    std::vector<float> laneIncs;
+    int laneStride = 4;
+    int maxFrames = 1;
+
+    bool syncEnabled = false;
+    float syncPhase = 0.0f;
+};
+} // namespace ies::dsp
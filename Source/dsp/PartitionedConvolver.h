@@ -0,0 +1,197 @@
+#pragma once
+
+#include <JuceHeader.h>
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <vector>
+
+namespace ies::dsp
+{
+// Frequency-domain partitions of one FIR kernel, in the layout PartitionedConvolver consumes. Built off the audio
+// thread with PartitionedConvolver::makeKernel().
+struct ConvolutionKernel final
+{
+    std::vector<float> spectra; // numPartitions x (blockSize + 1) interleaved re/im bins
+    int numPartitions = 0;
+};
+
+// Uniformly partitioned overlap-save convolution (UPOLS). Input is collected in blocks of blockSize; each
+// full block costs one forward FFT, one complex multiply-accumulate per kernel partition and one inverse FFT, so
+// the work per block is fixed by the kernel length chosen in prepare(). Latency is blockSize samples.
+// New kernels are copied in (no transforms on the audio thread) and crossfaded over the next block.
+class PartitionedConvolver final
+{
+public:
+    static constexpr int blockOrder = 8;
+    static constexpr int blockSize = 1 << blockOrder;
+    static constexpr int fftSize = 2 * blockSize;
+    static constexpr int spectrumSize = 2 * (blockSize + 1); // floats per partition
+
+    static int numPartitionsFor (int kernelLength) noexcept
+    {
+        return juce::jmax (1, (kernelLength + blockSize - 1) / blockSize);
+    }
+
+    // Allocates; call off the audio thread.
+    void prepare (int maxKernelLength)
+    {
+        maxPartitions = numPartitionsFor (maxKernelLength);
+        fft = std::make_unique<juce::dsp::FFT> (blockOrder + 1);
+
+        fdl.assign ((size_t) (maxPartitions * spectrumSize), 0.0f);
+        for (auto& k : kernels)
+        {
+            k.spectra.assign ((size_t) (maxPartitions * spectrumSize), 0.0f);
+            k.numPartitions = 0;
+        }
+
+        window.assign ((size_t) fftSize, 0.0f);
+        work.assign ((size_t) (2 * fftSize), 0.0f);
+        acc.assign ((size_t) (2 * fftSize), 0.0f);
+        outBuf.assign ((size_t) blockSize, 0.0f);
+
+        activeKernel = 0;
+        hasKernel = false;
+        fadePending = false;
+        reset();
+    }
+
+    void reset() noexcept
+    {
+        std::fill (fdl.begin(), fdl.end(), 0.0f);
+        std::fill (window.begin(), window.end(), 0.0f);
+        std::fill (outBuf.begin(), outBuf.end(), 0.0f);
+        fdlPos = 0;
+        inPos = 0;
+    }
+
+    int getLatencySamples() const noexcept { return blockSize; }
+
+    // Any thread. fftToUse must be of order blockOrder + 1 and not shared with another thread; scratch is resized
+    // as needed.
+    static void makeKernel (const float* ir, int length, ConvolutionKernel& out,
+                            juce::dsp::FFT& fftToUse, std::vector<float>& scratch)
+    {
+        out.numPartitions = numPartitionsFor (length);
+        out.spectra.resize ((size_t) (out.numPartitions * spectrumSize));
+        scratch.resize ((size_t) (2 * fftSize));
+
+        for (int p = 0; p < out.numPartitions; ++p)
+        {
+            std::fill (scratch.begin(), scratch.end(), 0.0f);
+            const auto start = p * blockSize;
+            const auto n = juce::jmin (blockSize, length - start);
+            std::copy (ir + start, ir + start + n, scratch.begin());
+
+            fftToUse.performRealOnlyForwardTransform (scratch.data(), true);
+            std::copy (scratch.begin(), scratch.begin() + spectrumSize, out.spectra.begin() + p * spectrumSize);
+        }
+    }
+
+    // Audio thread. Kernels longer than the prepared length are truncated. The first kernel after prepare() is
+    // used as-is; later ones fade in over the next block.
+    void setKernel (const ConvolutionKernel& k) noexcept
+    {
+        const auto target = hasKernel ? 1 - activeKernel : activeKernel;
+        auto& dst = kernels[(size_t) target];
+        dst.numPartitions = juce::jmin (maxPartitions, k.numPartitions);
+        std::copy (k.spectra.begin(), k.spectra.begin() + dst.numPartitions * spectrumSize, dst.spectra.begin());
+
+        fadePending = hasKernel;
+        hasKernel = true;
+    }
+
+    // In place.
+    void process (float* x, int numSamples) noexcept
+    {
+        if (! hasKernel || fft == nullptr)
+            return;
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            window[(size_t) (blockSize + inPos)] = x[i];
+            x[i] = outBuf[(size_t) inPos];
+
+            if (++inPos == blockSize)
+            {
+                processPartition();
+                inPos = 0;
+            }
+        }
+    }
+
+private:
+    void processPartition() noexcept
+    {
+        // Spectrum of the last two input blocks goes to the front of the frequency-domain delay line.
+        fdlPos = (fdlPos == 0 ? maxPartitions : fdlPos) - 1;
+        std::copy (window.begin(), window.end(), work.begin());
+        std::fill (work.begin() + fftSize, work.end(), 0.0f);
+        fft->performRealOnlyForwardTransform (work.data(), true);
+        std::copy (work.begin(), work.begin() + spectrumSize, fdl.begin() + fdlPos * spectrumSize);
+        std::copy (window.begin() + blockSize, window.end(), window.begin());
+
+        convolve (kernels[(size_t) activeKernel]);
+        std::copy (acc.begin() + blockSize, acc.begin() + fftSize, outBuf.begin());
+
+        if (fadePending)
+        {
+            const auto next = 1 - activeKernel;
+            convolve (kernels[(size_t) next]);
+
+            const auto step = 1.0f / (float) blockSize;
+            for (int j = 0; j < blockSize; ++j)
+            {
+                const auto t = ((float) j + 0.5f) * step;
+                auto& y = outBuf[(size_t) j];
+                y += t * (acc[(size_t) (blockSize + j)] - y);
+            }
+
+            activeKernel = next;
+            fadePending = false;
+        }
+    }
+
+    // acc = IFFT (sum_p X[n - p] * H[p]); the valid output is its second half.
+    void convolve (const ConvolutionKernel& k) noexcept
+    {
+        std::fill (acc.begin(), acc.begin() + spectrumSize, 0.0f);
+
+        for (int p = 0; p < k.numPartitions; ++p)
+        {
+            const auto slot = (fdlPos + p) % maxPartitions;
+            const auto* xs = fdl.data() + slot * spectrumSize;
+            const auto* hs = k.spectra.data() + p * spectrumSize;
+            auto* a = acc.data();
+
+            for (int b = 0; b < spectrumSize; b += 2)
+            {
+                const auto xr = xs[b], xi = xs[b + 1];
+                const auto hr = hs[b], hi = hs[b + 1];
+                a[b]     += xr * hr - xi * hi;
+                a[b + 1] += xr * hi + xi * hr;
+            }
+        }
+
+        fft->performRealOnlyInverseTransform (acc.data());
+    }
+
+    std::unique_ptr<juce::dsp::FFT> fft;
+    int maxPartitions = 1;
+
+    std::vector<float> fdl;    // maxPartitions input spectra, newest at fdlPos
+    int fdlPos = 0;
+    std::vector<float> window; // previous block | current block
+    int inPos = 0;
+    std::vector<float> work;
+    std::vector<float> acc;
+    std::vector<float> outBuf; // output of the last full block, played back while the next one fills
+
+    std::array<ConvolutionKernel, 2> kernels;
+    int activeKernel = 0;
+    bool hasKernel = false;
+    bool fadePending = false;
+};
+} // namespace ies::dsp
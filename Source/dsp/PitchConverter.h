@@ -0,0 +1,34 @@
+#pragma once
+
+#include <JuceHeader.h>
+
+#include "../Util/Math.h"
+
+namespace ies::dsp
+{
+// MIDI note (fractional) -> Hz / oscillator phase increment, using the table+polynomial exp2.
+// Increments are clamped the same way the oscillators clamp them (0..0.5 cycles/sample).
+class PitchConverter final
+{
+public:
+    void prepare (double sampleRateHz) noexcept
+    {
+        const auto sr = sampleRateHz > 0.0 ? sampleRateHz : 44100.0;
+        a4Increment = (float) (440.0 / sr);
+    }
+
+    static float noteToHz (float note) noexcept
+    {
+        return ies::math::midiNoteToHzFast (note);
+    }
+
+    float noteToIncrement (float note) const noexcept
+    {
+        const auto inc = a4Increment * ies::math::fastExp2 ((note - 69.0f) * (1.0f / 12.0f));
+        return juce::jlimit (0.0f, 0.5f, inc);
+    }
+
+private:
+    float a4Increment = 440.0f / 44100.0f;
+};
+} // namespace ies::dsp
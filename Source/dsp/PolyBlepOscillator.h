@@ -4,6 +4,7 @@
 
 #include "../Util/Math.h"
 #include "../Params.h"
+#include "WavetableReader.h"
 #include "WavetableSet.h"
 
 namespace ies::dsp
@@ -69,23 +70,10 @@ public:
 
     float processWavetable (const WavetableSet& table, bool* wrapped = nullptr) noexcept
     {
-        // Choose mip based on playback rate (size * phaseInc ~= samples advanced per output sample in table space).
-        // Higher playback rate => fewer usable harmonics => use a more filtered table.
-        int mip = 0;
-        const float rate = (float) WavetableSet::tableSize * phaseInc;
-        if (rate > 0.0f)
-            mip = juce::jlimit (0, WavetableSet::numMips - 1, (int) std::ceil (std::log2 (juce::jmax (1.0e-6f, rate))));
-
-        const auto* t = table.level (mip);
-
-        const float idx = phase * (float) WavetableSet::tableSize;
-        const int i0 = juce::jlimit (0, WavetableSet::tableSize - 1, (int) std::floor (idx));
-        const int i1 = (i0 + 1) % WavetableSet::tableSize;
-        const float frac = idx - (float) i0;
-
-        const float a = t[(size_t) i0];
-        const float b = t[(size_t) i1];
-        const float out = a + frac * (b - a);
+        // The reader keeps its mip pair until the increment changes and crossfades between adjacent mips.
+        float out = 0.0f;
+        wavetableReader.setTable (&table);
+        wavetableReader.readBlock (&phase, &phaseInc, 1, &out, 1);
 
         phase += phaseInc;
 
@@ -170,5 +158,6 @@ private:
     float phase = 0.0f;
     float phaseInc = 0.0f;
     float triState = -0.25f;
+    WavetableReader wavetableReader;
 };
 } // namespace ies::dsp
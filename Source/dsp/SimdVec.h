@@ -0,0 +1,309 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#if defined (__SSE2__) || defined (_M_X64) || (defined (_M_IX86_FP) && _M_IX86_FP >= 2)
+ #include <emmintrin.h>
+ #define IES_SIMD_SSE2 1
+#elif defined (__ARM_NEON) || defined (__ARM_NEON__)
+ #include <arm_neon.h>
+ #define IES_SIMD_NEON 1
+#endif
+
+namespace ies::dsp::simd
+{
+// All-ones / all-zeros lane mask as a float.
+inline float bitsIf (bool b) noexcept
+{
+    const std::uint32_t u = b ? 0xffffffffu : 0u;
+    float f;
+    std::memcpy (&f, &u, sizeof (f));
+    return f;
+}
+
+inline float fromBits (std::uint32_t u) noexcept
+{
+    float f;
+    std::memcpy (&f, &u, sizeof (f));
+    return f;
+}
+
+inline std::uint32_t toBits (float f) noexcept
+{
+    std::uint32_t u;
+    std::memcpy (&u, &f, sizeof (u));
+    return u;
+}
+
+// Four float lanes: SSE2, NEON, or a scalar fallback with the same semantics.
+#if IES_SIMD_SSE2
+struct Vec4
+{
+    using T = __m128;
+    static T set (float v) noexcept { return _mm_set1_ps (v); }
+    static T set (float a, float b, float c, float d) noexcept { return _mm_setr_ps (a, b, c, d); }
+    static T load (const float* p) noexcept { return _mm_load_ps (p); }
+    static void store (float* p, T v) noexcept { _mm_store_ps (p, v); }
+    static T loadUnaligned (const float* p) noexcept { return _mm_loadu_ps (p); }
+    static void storeUnaligned (float* p, T v) noexcept { _mm_storeu_ps (p, v); }
+    static T add (T a, T b) noexcept { return _mm_add_ps (a, b); }
+    static T sub (T a, T b) noexcept { return _mm_sub_ps (a, b); }
+    static T mul (T a, T b) noexcept { return _mm_mul_ps (a, b); }
+    static T div (T a, T b) noexcept { return _mm_div_ps (a, b); }
+    static T min (T a, T b) noexcept { return _mm_min_ps (a, b); }
+    static T max (T a, T b) noexcept { return _mm_max_ps (a, b); }
+    static T abs (T a) noexcept { return _mm_andnot_ps (_mm_set1_ps (-0.0f), a); }
+    // Valid for |a| < 2^31.
+    static T floor (T a) noexcept
+    {
+        const auto t = _mm_cvtepi32_ps (_mm_cvttps_epi32 (a));
+        return _mm_sub_ps (t, _mm_and_ps (_mm_cmpgt_ps (t, a), _mm_set1_ps (1.0f)));
+    }
+    static T lt (T a, T b) noexcept { return _mm_cmplt_ps (a, b); }
+    static T gt (T a, T b) noexcept { return _mm_cmpgt_ps (a, b); }
+    static T ge (T a, T b) noexcept { return _mm_cmpge_ps (a, b); }
+    static T bitAnd (T a, T b) noexcept { return _mm_and_ps (a, b); }
+    static T bitOr (T a, T b) noexcept { return _mm_or_ps (a, b); }
+    static bool any (T m) noexcept { return _mm_movemask_ps (m) != 0; }
+    static T select (T m, T a, T b) noexcept { return _mm_or_ps (_mm_and_ps (m, a), _mm_andnot_ps (m, b)); }
+    static bool firstLane (T m) noexcept { return (_mm_movemask_ps (m) & 1) != 0; }
+    static float sum (T a) noexcept
+    {
+        const auto s = _mm_add_ps (a, _mm_shuffle_ps (a, a, _MM_SHUFFLE (2, 3, 0, 1)));
+        return _mm_cvtss_f32 (_mm_add_ss (s, _mm_movehl_ps (s, s)));
+    }
+    // Unnormalised 4-point Hadamard across the lanes: (a+b+c+d, a-b+c-d, a+b-c-d, a-b-c+d).
+    static T hadamard4 (T a) noexcept
+    {
+        const auto y = _mm_add_ps (_mm_mul_ps (a, _mm_setr_ps (1.0f, -1.0f, 1.0f, -1.0f)), _mm_shuffle_ps (a, a, _MM_SHUFFLE (2, 3, 0, 1)));
+        return _mm_add_ps (_mm_mul_ps (y, _mm_setr_ps (1.0f, 1.0f, -1.0f, -1.0f)), _mm_shuffle_ps (y, y, _MM_SHUFFLE (1, 0, 3, 2)));
+    }
+    // Lanes moved up by one / two, zeros shifted in: (0, a, b, c) and (0, 0, a, b).
+    static T shiftUp1 (T a) noexcept { return _mm_castsi128_ps (_mm_slli_si128 (_mm_castps_si128 (a), 4)); }
+    static T shiftUp2 (T a) noexcept { return _mm_castsi128_ps (_mm_slli_si128 (_mm_castps_si128 (a), 8)); }
+    static T splatLast (T a) noexcept { return _mm_shuffle_ps (a, a, _MM_SHUFFLE (3, 3, 3, 3)); }
+    // In-place 4x4 transpose: rows become columns.
+    static void transpose (T& a, T& b, T& c, T& d) noexcept { _MM_TRANSPOSE4_PS (a, b, c, d); }
+    // Phases as 0.32 fixed point (lanes hold uint32 bits), so accumulating wraps for free. fixedFromUnit is valid
+    // for [0, 0.5]; unitFromFixed keeps 24 bits and returns [0, 1).
+    static T fixedFromUnit (T a) noexcept { return _mm_castsi128_ps (_mm_cvttps_epi32 (_mm_mul_ps (a, _mm_set1_ps (4294967296.0f)))); }
+    static T unitFromFixed (T a) noexcept
+    {
+        return _mm_mul_ps (_mm_cvtepi32_ps (_mm_srli_epi32 (_mm_castps_si128 (a), 8)), _mm_set1_ps (1.0f / 16777216.0f));
+    }
+    static T addFixed (T a, T b) noexcept { return _mm_castsi128_ps (_mm_add_epi32 (_mm_castps_si128 (a), _mm_castps_si128 (b))); }
+};
+#elif IES_SIMD_NEON
+struct Vec4
+{
+    using T = float32x4_t;
+    static T set (float v) noexcept { return vdupq_n_f32 (v); }
+    static T set (float a, float b, float c, float d) noexcept { const float v[4] { a, b, c, d }; return vld1q_f32 (v); }
+    static T load (const float* p) noexcept { return vld1q_f32 (p); }
+    static void store (float* p, T v) noexcept { vst1q_f32 (p, v); }
+    static T loadUnaligned (const float* p) noexcept { return vld1q_f32 (p); }
+    static void storeUnaligned (float* p, T v) noexcept { vst1q_f32 (p, v); }
+    static T add (T a, T b) noexcept { return vaddq_f32 (a, b); }
+    static T sub (T a, T b) noexcept { return vsubq_f32 (a, b); }
+    static T mul (T a, T b) noexcept { return vmulq_f32 (a, b); }
+    static T div (T a, T b) noexcept
+    {
+       #if defined (__aarch64__) || defined (_M_ARM64)
+        return vdivq_f32 (a, b);
+       #else
+        alignas (16) float x[4], y[4];
+        vst1q_f32 (x, a); vst1q_f32 (y, b);
+        for (int k = 0; k < 4; ++k) x[k] /= y[k];
+        return vld1q_f32 (x);
+       #endif
+    }
+    static T min (T a, T b) noexcept { return vminq_f32 (a, b); }
+    static T max (T a, T b) noexcept { return vmaxq_f32 (a, b); }
+    static T abs (T a) noexcept { return vabsq_f32 (a); }
+    // Valid for |a| < 2^31.
+    static T floor (T a) noexcept
+    {
+        const auto t = vcvtq_f32_s32 (vcvtq_s32_f32 (a));
+        return vsubq_f32 (t, vreinterpretq_f32_u32 (vandq_u32 (vcgtq_f32 (t, a), vreinterpretq_u32_f32 (vdupq_n_f32 (1.0f)))));
+    }
+    static T fromMask (uint32x4_t m) noexcept { return vreinterpretq_f32_u32 (m); }
+    static T lt (T a, T b) noexcept { return fromMask (vcltq_f32 (a, b)); }
+    static T gt (T a, T b) noexcept { return fromMask (vcgtq_f32 (a, b)); }
+    static T ge (T a, T b) noexcept { return fromMask (vcgeq_f32 (a, b)); }
+    static T bitAnd (T a, T b) noexcept { return vreinterpretq_f32_u32 (vandq_u32 (vreinterpretq_u32_f32 (a), vreinterpretq_u32_f32 (b))); }
+    static T bitOr (T a, T b) noexcept { return vreinterpretq_f32_u32 (vorrq_u32 (vreinterpretq_u32_f32 (a), vreinterpretq_u32_f32 (b))); }
+    static bool any (T m) noexcept
+    {
+        const auto u = vreinterpretq_u32_f32 (m);
+        return (vgetq_lane_u32 (u, 0) | vgetq_lane_u32 (u, 1) | vgetq_lane_u32 (u, 2) | vgetq_lane_u32 (u, 3)) != 0u;
+    }
+    static T select (T m, T a, T b) noexcept { return vbslq_f32 (vreinterpretq_u32_f32 (m), a, b); }
+    static bool firstLane (T m) noexcept { return vgetq_lane_u32 (vreinterpretq_u32_f32 (m), 0) != 0u; }
+    static float sum (T a) noexcept
+    {
+        const auto s = vadd_f32 (vget_low_f32 (a), vget_high_f32 (a));
+        return vget_lane_f32 (vpadd_f32 (s, s), 0);
+    }
+    static T hadamard4 (T a) noexcept
+    {
+        const float pairSigns[4] { 1.0f, -1.0f, 1.0f, -1.0f };
+        const float halfSigns[4] { 1.0f, 1.0f, -1.0f, -1.0f };
+        const auto y = vmlaq_f32 (vrev64q_f32 (a), a, vld1q_f32 (pairSigns));
+        return vmlaq_f32 (vextq_f32 (y, y, 2), y, vld1q_f32 (halfSigns));
+    }
+    static T shiftUp1 (T a) noexcept { return vextq_f32 (vdupq_n_f32 (0.0f), a, 3); }
+    static T shiftUp2 (T a) noexcept { return vextq_f32 (vdupq_n_f32 (0.0f), a, 2); }
+    static T splatLast (T a) noexcept { return vdupq_n_f32 (vgetq_lane_f32 (a, 3)); }
+    static T fixedFromUnit (T a) noexcept { return vreinterpretq_f32_u32 (vcvtq_u32_f32 (vmulq_n_f32 (a, 4294967296.0f))); }
+    static T unitFromFixed (T a) noexcept
+    {
+        return vmulq_n_f32 (vcvtq_f32_u32 (vshrq_n_u32 (vreinterpretq_u32_f32 (a), 8)), 1.0f / 16777216.0f);
+    }
+    static T addFixed (T a, T b) noexcept { return vreinterpretq_f32_u32 (vaddq_u32 (vreinterpretq_u32_f32 (a), vreinterpretq_u32_f32 (b))); }
+    static void transpose (T& a, T& b, T& c, T& d) noexcept
+    {
+        const auto ab = vtrnq_f32 (a, b); // (a0 b0 a2 b2), (a1 b1 a3 b3)
+        const auto cd = vtrnq_f32 (c, d);
+        a = vcombine_f32 (vget_low_f32 (ab.val[0]), vget_low_f32 (cd.val[0]));
+        b = vcombine_f32 (vget_low_f32 (ab.val[1]), vget_low_f32 (cd.val[1]));
+        c = vcombine_f32 (vget_high_f32 (ab.val[0]), vget_high_f32 (cd.val[0]));
+        d = vcombine_f32 (vget_high_f32 (ab.val[1]), vget_high_f32 (cd.val[1]));
+    }
+};
+#else
+// Scalar fallback with the same lane semantics (the compiler is free to vectorise it).
+struct Vec4
+{
+    struct T { float v[4]; };
+
+    template <typename Fn>
+    static T map (T a, T b, Fn fn) noexcept { T r; for (int k = 0; k < 4; ++k) r.v[k] = fn (a.v[k], b.v[k]); return r; }
+    static float mask (bool b) noexcept { return bitsIf (b); }
+    static bool isSet (float m) noexcept { std::uint32_t u; std::memcpy (&u, &m, sizeof (u)); return u != 0u; }
+
+    static T set (float v) noexcept { return { { v, v, v, v } }; }
+    static T set (float a, float b, float c, float d) noexcept { return { { a, b, c, d } }; }
+    static T load (const float* p) noexcept { return { { p[0], p[1], p[2], p[3] } }; }
+    static void store (float* p, T v) noexcept { for (int k = 0; k < 4; ++k) p[k] = v.v[k]; }
+    static T loadUnaligned (const float* p) noexcept { return load (p); }
+    static void storeUnaligned (float* p, T v) noexcept { store (p, v); }
+    static T add (T a, T b) noexcept { return map (a, b, [] (float x, float y) { return x + y; }); }
+    static T sub (T a, T b) noexcept { return map (a, b, [] (float x, float y) { return x - y; }); }
+    static T mul (T a, T b) noexcept { return map (a, b, [] (float x, float y) { return x * y; }); }
+    static T div (T a, T b) noexcept { return map (a, b, [] (float x, float y) { return x / y; }); }
+    static T min (T a, T b) noexcept { return map (a, b, [] (float x, float y) { return x < y ? x : y; }); }
+    static T max (T a, T b) noexcept { return map (a, b, [] (float x, float y) { return x > y ? x : y; }); }
+    static T abs (T a) noexcept { return map (a, a, [] (float x, float) { return std::abs (x); }); }
+    static T floor (T a) noexcept { return map (a, a, [] (float x, float) { return std::floor (x); }); }
+    static T lt (T a, T b) noexcept { return map (a, b, [] (float x, float y) { return mask (x < y); }); }
+    static T gt (T a, T b) noexcept { return map (a, b, [] (float x, float y) { return mask (x > y); }); }
+    static T ge (T a, T b) noexcept { return map (a, b, [] (float x, float y) { return mask (x >= y); }); }
+    static T bitAnd (T a, T m) noexcept { return map (a, m, [] (float x, float y) { return isSet (y) ? x : 0.0f; }); }
+    static T bitOr (T a, T b) noexcept { return map (a, b, [] (float x, float y) { return mask (isSet (x) || isSet (y)); }); }
+    static bool any (T m) noexcept { return isSet (m.v[0]) || isSet (m.v[1]) || isSet (m.v[2]) || isSet (m.v[3]); }
+    static T select (T m, T a, T b) noexcept { T r; for (int k = 0; k < 4; ++k) r.v[k] = isSet (m.v[k]) ? a.v[k] : b.v[k]; return r; }
+    static bool firstLane (T m) noexcept { return isSet (m.v[0]); }
+    static float sum (T a) noexcept { return (a.v[0] + a.v[1]) + (a.v[2] + a.v[3]); }
+    static T hadamard4 (T a) noexcept
+    {
+        const float y0 = a.v[0] + a.v[1], y1 = a.v[0] - a.v[1], y2 = a.v[2] + a.v[3], y3 = a.v[2] - a.v[3];
+        return { { y0 + y2, y1 + y3, y0 - y2, y1 - y3 } };
+    }
+    static T shiftUp1 (T a) noexcept { return { { 0.0f, a.v[0], a.v[1], a.v[2] } }; }
+    static T shiftUp2 (T a) noexcept { return { { 0.0f, 0.0f, a.v[0], a.v[1] } }; }
+    static T splatLast (T a) noexcept { return set (a.v[3]); }
+    static T fixedFromUnit (T a) noexcept
+    {
+        T r;
+        for (int k = 0; k < 4; ++k)
+            r.v[k] = fromBits ((std::uint32_t) ((double) a.v[k] * 4294967296.0));
+        return r;
+    }
+    static T unitFromFixed (T a) noexcept
+    {
+        T r;
+        for (int k = 0; k < 4; ++k)
+            r.v[k] = (float) (toBits (a.v[k]) >> 8) * (1.0f / 16777216.0f);
+        return r;
+    }
+    static T addFixed (T a, T b) noexcept
+    {
+        T r;
+        for (int k = 0; k < 4; ++k)
+            r.v[k] = fromBits (toBits (a.v[k]) + toBits (b.v[k]));
+        return r;
+    }
+    static void transpose (T& a, T& b, T& c, T& d) noexcept
+    {
+        const T r[4] { a, b, c, d };
+        a = { { r[0].v[0], r[1].v[0], r[2].v[0], r[3].v[0] } };
+        b = { { r[0].v[1], r[1].v[1], r[2].v[1], r[3].v[1] } };
+        c = { { r[0].v[2], r[1].v[2], r[2].v[2], r[3].v[2] } };
+        d = { { r[0].v[3], r[1].v[3], r[2].v[3], r[3].v[3] } };
+    }
+};
+#endif
+
+// polyBLEP residual for four phases at once (zero outside [0, dt) and (1 - dt, 1)).
+inline Vec4::T polyBlep (Vec4::T t, Vec4::T dt) noexcept
+{
+    const auto zero = Vec4::set (0.0f);
+    const auto one = Vec4::set (1.0f);
+    const auto active = Vec4::gt (dt, zero);
+
+    // t < dt: rising residual
+    const auto u1 = Vec4::div (t, dt);
+    const auto r1 = Vec4::sub (Vec4::sub (Vec4::add (u1, u1), Vec4::mul (u1, u1)), one);
+
+    // t > 1 - dt: falling residual
+    const auto u2 = Vec4::div (Vec4::sub (t, one), dt);
+    const auto r2 = Vec4::add (Vec4::add (Vec4::add (Vec4::mul (u2, u2), u2), u2), one);
+
+    const auto r = Vec4::select (Vec4::lt (t, dt), r1, Vec4::select (Vec4::gt (t, Vec4::sub (one, dt)), r2, zero));
+    return Vec4::bitAnd (r, active);
+}
+
+// polyBLAMP residual for a slope change of one per sample at phase 0, four phases at once (zero outside [0, dt)
+// and (1 - dt, 1)). It is the integral of the polyBLEP residual: scale by the slope change per sample.
+inline Vec4::T polyBlamp (Vec4::T t, Vec4::T dt) noexcept
+{
+    const auto zero = Vec4::set (0.0f);
+    const auto one = Vec4::set (1.0f);
+    const auto sixth = Vec4::set (1.0f / 6.0f);
+    const auto active = Vec4::gt (dt, zero);
+
+    // t < dt: (1 - t/dt)^3 / 6
+    const auto a = Vec4::sub (one, Vec4::div (t, dt));
+    const auto r1 = Vec4::mul (Vec4::mul (Vec4::mul (a, a), a), sixth);
+
+    // t > 1 - dt: (1 + (t - 1)/dt)^3 / 6
+    const auto b = Vec4::add (one, Vec4::div (Vec4::sub (t, one), dt));
+    const auto r2 = Vec4::mul (Vec4::mul (Vec4::mul (b, b), b), sixth);
+
+    const auto r = Vec4::select (Vec4::lt (t, dt), r1, Vec4::select (Vec4::gt (t, Vec4::sub (one, dt)), r2, zero));
+    return Vec4::bitAnd (r, active);
+}
+
+// sin (2 pi x) for any x (|x| < 2^31): wrap to [-0.5, 0.5), reflect into [-0.25, 0.25], odd 9th-order Taylor
+// (absolute error < 4e-6). Same maths as ies::math::fastSin2Pi.
+inline Vec4::T sin2Pi (Vec4::T x) noexcept
+{
+    const auto half = Vec4::set (0.5f);
+    const auto quarter = Vec4::set (0.25f);
+
+    auto r = Vec4::sub (x, Vec4::floor (Vec4::add (x, half)));
+    r = Vec4::select (Vec4::gt (r, quarter), Vec4::sub (half, r),
+                      Vec4::select (Vec4::lt (r, Vec4::set (-0.25f)), Vec4::sub (Vec4::set (-0.5f), r), r));
+
+    const auto z = Vec4::mul (r, Vec4::set (6.283185307f));
+    const auto z2 = Vec4::mul (z, z);
+    auto p = Vec4::set (2.755731922e-6f);
+    p = Vec4::add (Vec4::mul (p, z2), Vec4::set (-1.984126984e-4f));
+    p = Vec4::add (Vec4::mul (p, z2), Vec4::set (8.333333333e-3f));
+    p = Vec4::add (Vec4::mul (p, z2), Vec4::set (-1.666666667e-1f));
+    p = Vec4::add (Vec4::mul (p, z2), Vec4::set (1.0f));
+    return Vec4::mul (p, z);
+}
+} // namespace ies::dsp::simd
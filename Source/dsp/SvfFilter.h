@@ -3,6 +3,7 @@
 #include <JuceHeader.h>
 
 #include "../Params.h"
+#include "../Util/Math.h"
 
 namespace ies::dsp
 {
@@ -12,6 +13,9 @@ public:
     void prepare (double sampleRate)
     {
         sr = (sampleRate > 0.0) ? (float) sampleRate : 44100.0f;
+        invSr = 1.0f / sr;
+        maxCutoff = sr * 0.45f;
+        lastCutoffHz = -1.0f; // force a coefficient update
         reset();
     }
 
@@ -28,15 +32,11 @@ public:
 
     float processSample (float x, float cutoffHz, float resonance) noexcept
     {
-        // Clamp to avoid tan() blowups at Nyquist.
-        const auto fc = juce::jlimit (20.0f, sr * 0.45f, cutoffHz);
-        const auto res = juce::jmax (0.05f, resonance);
+        // A static cutoff (no env, keytrack or mod movement) hits the cache and skips the prewarp entirely.
+        if (cutoffHz != lastCutoffHz || resonance != lastResonance)
+            updateCoeffs (cutoffHz, resonance);
 
-        const auto g = std::tan (juce::MathConstants<float>::pi * fc / sr);
-        const auto R2 = 1.0f / res;
-        const auto h = 1.0f / (1.0f + R2 * g + g * g);
-
-        const auto yHP = h * (x - s1 * (g + R2) - s2);
+        const auto yHP = h * (x - s1 * gPlusR2 - s2);
         const auto yBP = yHP * g + s1;
         s1 = yHP * g + yBP;
 
@@ -51,12 +51,42 @@ public:
         }
     }
 
+    // In place over x; cutoffHz and resonance hold one value per sample.
+    void processBlock (float* x, const float* cutoffHz, const float* resonance, int numSamples) noexcept
+    {
+        for (int i = 0; i < numSamples; ++i)
+            x[i] = processSample (x[i], cutoffHz[i], resonance[i]);
+    }
+
 private:
+    void updateCoeffs (float cutoffHz, float resonance) noexcept
+    {
+        lastCutoffHz = cutoffHz;
+        lastResonance = resonance;
+
+        // Clamp to avoid tan() blowups at Nyquist.
+        const auto fc = juce::jlimit (20.0f, maxCutoff, cutoffHz);
+        const auto res = juce::jmax (0.05f, resonance);
+
+        g = ies::math::fastTanPi (fc * invSr);
+        const auto R2 = 1.0f / res;
+        gPlusR2 = g + R2;
+        h = 1.0f / (1.0f + R2 * g + g * g);
+    }
+
     float sr = 44100.0f;
+    float invSr = 1.0f / 44100.0f;
+    float maxCutoff = 44100.0f * 0.45f;
     params::filter::Type type = params::filter::lp;
 
     float s1 = 0.0f;
     float s2 = 0.0f;
+
+    // Coefficients for the last (cutoff, resonance) pair seen.
+    float lastCutoffHz = -1.0f;
+    float lastResonance = -1.0f;
+    float g = 0.0f;
+    float gPlusR2 = 0.0f;
+    float h = 1.0f;
 };
 } // namespace ies::dsp
-
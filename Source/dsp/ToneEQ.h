@@ -14,6 +14,14 @@ struct BiquadCoeffs final
     float a1 = 0.0f, a2 = 0.0f;
 };
 
+// The frequency/Q-dependent part of an RBJ design: cos (w0) and alpha = sin (w0) / 2Q. Gain changes only
+// need these plus A, so a band that only moves in gain never recomputes sin/cos.
+struct BiquadTrig final
+{
+    float cosW0 = 1.0f;
+    float alpha = 0.0f;
+};
+
 class Biquad final
 {
 public:
@@ -24,6 +32,7 @@ public:
     }
 
     void setCoeffs (const BiquadCoeffs& c) noexcept { coeffs = c; }
+    const BiquadCoeffs& getCoeffs() const noexcept { return coeffs; }
 
     float processSample (float x) noexcept
     {
@@ -33,6 +42,130 @@ public:
         return y;
     }
 
+    // In place; state and coefficients stay in registers across the block.
+    void processBlock (float* x, int numSamples) noexcept
+    {
+        const auto c = coeffs;
+        auto s1 = z1;
+        auto s2 = z2;
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const auto in = x[i];
+            const auto y = c.b0 * in + s1;
+            s1 = c.b1 * in - c.a1 * y + s2;
+            s2 = c.b2 * in - c.a2 * y;
+            x[i] = y;
+        }
+
+        z1 = s1;
+        z2 = s2;
+    }
+
+    // Runs numStages static biquads in series over the block, sample by sample. One stage alone is bound by its
+    // own feedback latency; interleaving a few lets consecutive samples of different stages overlap.
+    template <int numStages>
+    static void processCascade (Biquad* const* stages, float* x, int numSamples) noexcept
+    {
+        BiquadCoeffs c[numStages];
+        float s1[numStages];
+        float s2[numStages];
+        for (int k = 0; k < numStages; ++k)
+        {
+            c[k] = stages[k]->coeffs;
+            s1[k] = stages[k]->z1;
+            s2[k] = stages[k]->z2;
+        }
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            auto v = x[i];
+            for (int k = 0; k < numStages; ++k)
+            {
+                const auto y = c[k].b0 * v + s1[k];
+                s1[k] = c[k].b1 * v - c[k].a1 * y + s2[k];
+                s2[k] = c[k].b2 * v - c[k].a2 * y;
+                v = y;
+            }
+            x[i] = v;
+        }
+
+        for (int k = 0; k < numStages; ++k)
+        {
+            stages[k]->z1 = s1[k];
+            stages[k]->z2 = s2[k];
+        }
+    }
+
+    // Runs main in place over x (ramping its coefficients by *step first when step is non-null) and side on the
+    // same input, handing each side output to onSide, in one loop so the feedback chains overlap.
+    template <typename SideFn>
+    static void processWithSidechain (Biquad& main, const BiquadCoeffs* step, Biquad& side,
+                                      float* x, int numSamples, SideFn&& onSide) noexcept
+    {
+        auto c = main.coeffs;
+        auto s1 = main.z1;
+        auto s2 = main.z2;
+        const auto d = side.coeffs;
+        auto d1 = side.z1;
+        auto d2 = side.z2;
+        const auto st = step != nullptr ? *step : BiquadCoeffs { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const auto in = x[i];
+
+            const auto ys = d.b0 * in + d1;
+            d1 = d.b1 * in - d.a1 * ys + d2;
+            d2 = d.b2 * in - d.a2 * ys;
+            onSide (ys);
+
+            c.b0 += st.b0;
+            c.b1 += st.b1;
+            c.b2 += st.b2;
+            c.a1 += st.a1;
+            c.a2 += st.a2;
+
+            const auto y = c.b0 * in + s1;
+            s1 = c.b1 * in - c.a1 * y + s2;
+            s2 = c.b2 * in - c.a2 * y;
+            x[i] = y;
+        }
+
+        main.coeffs = c;
+        main.z1 = s1;
+        main.z2 = s2;
+        side.z1 = d1;
+        side.z2 = d2;
+    }
+
+    // processBlock with the coefficients moving by step before every sample (a linear ramp).
+    void processBlockRamped (float* x, int numSamples, const BiquadCoeffs& step) noexcept
+    {
+        auto c = coeffs;
+        auto s1 = z1;
+        auto s2 = z2;
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            c.b0 += step.b0;
+            c.b1 += step.b1;
+            c.b2 += step.b2;
+            c.a1 += step.a1;
+            c.a2 += step.a2;
+
+            const auto in = x[i];
+            const auto y = c.b0 * in + s1;
+            s1 = c.b1 * in - c.a1 * y + s2;
+            s2 = c.b2 * in - c.a2 * y;
+            x[i] = y;
+        }
+
+        coeffs = c;
+        z1 = s1;
+        z2 = s2;
+    }
+
     static BiquadCoeffs makeLowPass (double sampleRate, float freqHz, float q) noexcept
     {
         const auto sr = (float) (sampleRate > 0.0 ? sampleRate : 44100.0);
@@ -87,17 +220,29 @@ public:
         return out;
     }
 
-    static BiquadCoeffs makePeak (double sampleRate, float freqHz, float gainDb, float q) noexcept
+    static BiquadTrig makeTrig (double sampleRate, float freqHz, float q) noexcept
     {
         const auto sr = (float) (sampleRate > 0.0 ? sampleRate : 44100.0);
         const auto f = juce::jlimit (20.0f, sr * 0.45f, freqHz);
         const auto Q = juce::jmax (0.001f, q);
-        const auto A = std::pow (10.0f, gainDb / 40.0f);
 
         const auto w0 = 2.0f * juce::MathConstants<float>::pi * f / sr;
-        const auto c = std::cos (w0);
-        const auto s = std::sin (w0);
-        const auto alpha = s / (2.0f * Q);
+        BiquadTrig t;
+        t.cosW0 = std::cos (w0);
+        t.alpha = std::sin (w0) / (2.0f * Q);
+        return t;
+    }
+
+    static BiquadCoeffs makePeak (double sampleRate, float freqHz, float gainDb, float q) noexcept
+    {
+        return makePeak (makeTrig (sampleRate, freqHz, q), gainDb);
+    }
+
+    static BiquadCoeffs makePeak (const BiquadTrig& t, float gainDb) noexcept
+    {
+        const auto A = std::pow (10.0f, gainDb / 40.0f);
+        const auto c = t.cosW0;
+        const auto alpha = t.alpha;
 
         const auto b0 = 1.0f + alpha * A;
         const auto b1 = -2.0f * c;
@@ -117,14 +262,13 @@ public:
 
     static BiquadCoeffs makeNotch (double sampleRate, float freqHz, float q) noexcept
     {
-        const auto sr = (float) (sampleRate > 0.0 ? sampleRate : 44100.0);
-        const auto f = juce::jlimit (20.0f, sr * 0.45f, freqHz);
-        const auto Q = juce::jmax (0.001f, q);
+        return makeNotch (makeTrig (sampleRate, freqHz, q));
+    }
 
-        const auto w0 = 2.0f * juce::MathConstants<float>::pi * f / sr;
-        const auto c = std::cos (w0);
-        const auto s = std::sin (w0);
-        const auto alpha = s / (2.0f * Q);
+    static BiquadCoeffs makeNotch (const BiquadTrig& t) noexcept
+    {
+        const auto c = t.cosW0;
+        const auto alpha = t.alpha;
 
         const auto b0 = 1.0f;
         const auto b1 = -2.0f * c;
@@ -144,14 +288,13 @@ public:
 
     static BiquadCoeffs makeBandPass (double sampleRate, float freqHz, float q) noexcept
     {
-        const auto sr = (float) (sampleRate > 0.0 ? sampleRate : 44100.0);
-        const auto f = juce::jlimit (20.0f, sr * 0.45f, freqHz);
-        const auto Q = juce::jmax (0.001f, q);
+        return makeBandPass (makeTrig (sampleRate, freqHz, q));
+    }
 
-        const auto w0 = 2.0f * juce::MathConstants<float>::pi * f / sr;
-        const auto c = std::cos (w0);
-        const auto s = std::sin (w0);
-        const auto alpha = s / (2.0f * Q);
+    static BiquadCoeffs makeBandPass (const BiquadTrig& t) noexcept
+    {
+        const auto c = t.cosW0;
+        const auto alpha = t.alpha;
 
         const auto b0 = alpha;
         const auto b1 = 0.0f;
@@ -171,15 +314,15 @@ public:
 
     static BiquadCoeffs makeLowShelf (double sampleRate, float freqHz, float gainDb, float q) noexcept
     {
-        const auto sr = (float) (sampleRate > 0.0 ? sampleRate : 44100.0);
-        const auto f = juce::jlimit (20.0f, sr * 0.45f, freqHz);
-        const auto Q = juce::jmax (0.001f, q);
+        return makeLowShelf (makeTrig (sampleRate, freqHz, q), gainDb);
+    }
+
+    static BiquadCoeffs makeLowShelf (const BiquadTrig& t, float gainDb) noexcept
+    {
         const auto A = std::pow (10.0f, gainDb / 40.0f);
         const auto sqrtA = std::sqrt (A);
-        const auto w0 = 2.0f * juce::MathConstants<float>::pi * f / sr;
-        const auto c = std::cos (w0);
-        const auto s = std::sin (w0);
-        const auto alpha = s / (2.0f * Q);
+        const auto c = t.cosW0;
+        const auto alpha = t.alpha;
         const auto twoSqrtAAlpha = 2.0f * sqrtA * alpha;
 
         const auto b0 = A * ((A + 1.0f) - (A - 1.0f) * c + twoSqrtAAlpha);
@@ -200,15 +343,15 @@ public:
 
     static BiquadCoeffs makeHighShelf (double sampleRate, float freqHz, float gainDb, float q) noexcept
     {
-        const auto sr = (float) (sampleRate > 0.0 ? sampleRate : 44100.0);
-        const auto f = juce::jlimit (20.0f, sr * 0.45f, freqHz);
-        const auto Q = juce::jmax (0.001f, q);
+        return makeHighShelf (makeTrig (sampleRate, freqHz, q), gainDb);
+    }
+
+    static BiquadCoeffs makeHighShelf (const BiquadTrig& t, float gainDb) noexcept
+    {
         const auto A = std::pow (10.0f, gainDb / 40.0f);
         const auto sqrtA = std::sqrt (A);
-        const auto w0 = 2.0f * juce::MathConstants<float>::pi * f / sr;
-        const auto c = std::cos (w0);
-        const auto s = std::sin (w0);
-        const auto alpha = s / (2.0f * Q);
+        const auto c = t.cosW0;
+        const auto alpha = t.alpha;
         const auto twoSqrtAAlpha = 2.0f * sqrtA * alpha;
 
         const auto b0 = A * ((A + 1.0f) + (A - 1.0f) * c + twoSqrtAAlpha);
@@ -238,11 +381,30 @@ class ToneEQ final
 public:
     using PeakType = params::tone::PeakType;
 
+    static constexpr int maxBands = 24;
+
+    struct BandParams final
+    {
+        bool on = false;
+        int type = (int) PeakType::peakBell;
+        float freqHz = 1000.0f;
+        float gainDb = 0.0f;
+        float q = 1.0f;
+        bool dynOn = false;
+        float dynRangeDb = 0.0f;
+        float dynThresholdDb = -18.0f;
+    };
+
     void prepare (double sampleRate) noexcept
     {
         sr = (sampleRate > 0.0) ? sampleRate : 44100.0;
         attackCoeff = coeffFromMs (sr, 5.0f);
         releaseCoeff = coeffFromMs (sr, 80.0f);
+
+        // The per-sample smoothing/decay of the dynamic gain, compounded over one control interval.
+        dynSmoothPerTick = 1.0f - std::pow (0.86f, (float) dynControlInterval);
+        dynDecayPerTick = std::pow (0.90f, (float) dynControlInterval);
+
         reset();
         updateCoeffs();
     }
@@ -262,36 +424,44 @@ public:
         {
             b.detEnv = 0.0f;
             b.dynGainDb = 0.0f;
+            b.built = false;
+            b.ramping = false;
         }
+
+        builtLowCutHz = -1.0f;
+        builtHighCutHz = -1.0f;
+        samplesToControl = 0;
     }
 
     void setEnabled (bool e) noexcept { enabled = e; }
 
-    void setParams (float lowCutHzIn, float highCutHzIn, int lowCutSlopeIn, int highCutSlopeIn,
-                    bool peak1OnIn, int peak1TypeIn, float peak1FreqHzIn, float peak1GainDbIn, float peak1QIn, bool peak1DynOnIn, float peak1DynRangeDbIn, float peak1DynThresholdDbIn,
-                    bool peak2OnIn, int peak2TypeIn, float peak2FreqHzIn, float peak2GainDbIn, float peak2QIn, bool peak2DynOnIn, float peak2DynRangeDbIn, float peak2DynThresholdDbIn,
-                    bool peak3OnIn, int peak3TypeIn, float peak3FreqHzIn, float peak3GainDbIn, float peak3QIn, bool peak3DynOnIn, float peak3DynRangeDbIn, float peak3DynThresholdDbIn,
-                    bool peak4OnIn, int peak4TypeIn, float peak4FreqHzIn, float peak4GainDbIn, float peak4QIn, bool peak4DynOnIn, float peak4DynRangeDbIn, float peak4DynThresholdDbIn,
-                    bool peak5OnIn, int peak5TypeIn, float peak5FreqHzIn, float peak5GainDbIn, float peak5QIn, bool peak5DynOnIn, float peak5DynRangeDbIn, float peak5DynThresholdDbIn,
-                    bool peak6OnIn, int peak6TypeIn, float peak6FreqHzIn, float peak6GainDbIn, float peak6QIn, bool peak6DynOnIn, float peak6DynRangeDbIn, float peak6DynThresholdDbIn,
-                    bool peak7OnIn, int peak7TypeIn, float peak7FreqHzIn, float peak7GainDbIn, float peak7QIn, bool peak7DynOnIn, float peak7DynRangeDbIn, float peak7DynThresholdDbIn,
-                    bool peak8OnIn, int peak8TypeIn, float peak8FreqHzIn, float peak8GainDbIn, float peak8QIn, bool peak8DynOnIn, float peak8DynRangeDbIn, float peak8DynThresholdDbIn) noexcept
+    void setCuts (float lowCutHzIn, float highCutHzIn, int lowCutSlopeIn, int highCutSlopeIn) noexcept
     {
         lowCutHz = lowCutHzIn;
         highCutHz = highCutHzIn;
         lowCutSlopeStages = slopeToStages (lowCutSlopeIn);
         highCutSlopeStages = slopeToStages (highCutSlopeIn);
+    }
 
-        setBand (0, peak1OnIn, peak1TypeIn, peak1FreqHzIn, peak1GainDbIn, peak1QIn, peak1DynOnIn, peak1DynRangeDbIn, peak1DynThresholdDbIn);
-        setBand (1, peak2OnIn, peak2TypeIn, peak2FreqHzIn, peak2GainDbIn, peak2QIn, peak2DynOnIn, peak2DynRangeDbIn, peak2DynThresholdDbIn);
-        setBand (2, peak3OnIn, peak3TypeIn, peak3FreqHzIn, peak3GainDbIn, peak3QIn, peak3DynOnIn, peak3DynRangeDbIn, peak3DynThresholdDbIn);
-        setBand (3, peak4OnIn, peak4TypeIn, peak4FreqHzIn, peak4GainDbIn, peak4QIn, peak4DynOnIn, peak4DynRangeDbIn, peak4DynThresholdDbIn);
-        setBand (4, peak5OnIn, peak5TypeIn, peak5FreqHzIn, peak5GainDbIn, peak5QIn, peak5DynOnIn, peak5DynRangeDbIn, peak5DynThresholdDbIn);
-        setBand (5, peak6OnIn, peak6TypeIn, peak6FreqHzIn, peak6GainDbIn, peak6QIn, peak6DynOnIn, peak6DynRangeDbIn, peak6DynThresholdDbIn);
-        setBand (6, peak7OnIn, peak7TypeIn, peak7FreqHzIn, peak7GainDbIn, peak7QIn, peak7DynOnIn, peak7DynRangeDbIn, peak7DynThresholdDbIn);
-        setBand (7, peak8OnIn, peak8TypeIn, peak8FreqHzIn, peak8GainDbIn, peak8QIn, peak8DynOnIn, peak8DynRangeDbIn, peak8DynThresholdDbIn);
+    // Bands never set stay off.
+    void setBand (int index, const BandParams& p) noexcept
+    {
+        if (index < 0 || index >= maxBands)
+            return;
+
+        auto& b = bands[(size_t) index];
+        b.on = p.on;
+        b.type = clampType (p.type);
+        b.freqHz = juce::jlimit (20.0f, 20000.0f, p.freqHz);
+        b.gainDb = juce::jlimit (-24.0f, 24.0f, p.gainDb);
+        b.q = juce::jlimit (0.1f, 18.0f, p.q);
+        b.dynOn = p.dynOn;
+        b.dynRangeDb = juce::jlimit (-24.0f, 24.0f, p.dynRangeDb);
+        b.dynThresholdDb = juce::jlimit (-60.0f, 0.0f, p.dynThresholdDb);
     }
 
+    // Rebuilds only what changed since the last call: the engine calls this whenever a Tone parameter is
+    // smoothing, and most of the time nothing has moved.
     void updateCoeffs() noexcept
     {
         const auto low = juce::jlimit (20.0f, 20000.0f, lowCutHz);
@@ -299,69 +469,113 @@ public:
         const auto lo = juce::jmin (low, high);
         const auto hi = juce::jmax (low, high);
 
-        const auto hpC = Biquad::makeHighPass (sr, lo, 0.7071f);
-        const auto lpC = Biquad::makeLowPass  (sr, hi, 0.7071f);
-        for (auto& s : hp)
-            s.setCoeffs (hpC);
-        for (auto& s : lp)
-            s.setCoeffs (lpC);
+        if (lo != builtLowCutHz)
+        {
+            builtLowCutHz = lo;
+            const auto hpC = Biquad::makeHighPass (sr, lo, 0.7071f);
+            for (auto& s : hp)
+                s.setCoeffs (hpC);
+        }
+
+        if (hi != builtHighCutHz)
+        {
+            builtHighCutHz = hi;
+            const auto lpC = Biquad::makeLowPass (sr, hi, 0.7071f);
+            for (auto& s : lp)
+                s.setCoeffs (lpC);
+        }
 
-        const BiquadCoeffs identity {};
         for (size_t i = 0; i < bands.size(); ++i)
         {
-            const auto& b = bands[i];
-            peaks[i].setCoeffs (b.on ? makeBandCoeffs (b.type, b.freqHz, b.gainDb + b.dynGainDb, b.q) : identity);
-            detectors[i].setCoeffs (Biquad::makeBandPass (sr, b.freqHz, juce::jlimit (0.2f, 18.0f, b.q)));
+            auto& b = bands[i];
+            const auto trigChanged = ! b.built || b.freqHz != b.builtFreqHz || b.q != b.builtQ;
+            if (! trigChanged && b.on == b.builtOn && b.type == b.builtType && b.gainDb == b.builtGainDb)
+                continue;
+
+            if (trigChanged)
+            {
+                b.trig = Biquad::makeTrig (sr, b.freqHz, b.q);
+                detectors[i].setCoeffs (Biquad::makeBandPass (sr, b.freqHz, juce::jlimit (0.2f, 18.0f, b.q)));
+            }
+
+            // A band that is switched off forgets its dynamic state rather than decaying it unheard.
+            if (! b.on)
+            {
+                b.dynGainDb = 0.0f;
+                b.detEnv = 0.0f;
+            }
+
+            b.built = true;
+            b.builtOn = b.on;
+            b.builtType = b.type;
+            b.builtFreqHz = b.freqHz;
+            b.builtGainDb = b.gainDb;
+            b.builtQ = b.q;
+
+            b.ramping = false;
+            b.appliedDynDb = b.dynGainDb;
+            peaks[i].setCoeffs (b.on ? makeBandCoeffs (b, b.gainDb + b.dynGainDb) : BiquadCoeffs {});
         }
+
+        refreshActiveBands();
     }
 
-    float processSample (float x) noexcept
+    // In place, stage-major: the cut stages and active bands run over the whole block one after another, and
+    // bands that are off or flat are not in the list at all. Runs of static stages go through
+    // Biquad::processCascade a few at a time; bands moving at control rate run on their own.
+    void processBlock (float* x, int numSamples) noexcept
     {
-        if (! enabled)
-            return x;
+        if (! enabled || numSamples <= 0)
+            return;
 
-        auto y = x;
-        for (int i = 0; i < lowCutSlopeStages; ++i)
-            y = hp[(size_t) i].processSample (y);
+        Biquad* run[maxCascade];
+        int runLength = 0;
 
-        for (size_t i = 0; i < bands.size(); ++i)
+        auto flush = [&]
         {
-            auto& b = bands[i];
-            if (b.on && b.dynOn && std::abs (b.dynRangeDb) > 1.0e-4f)
+            processCascade (run, runLength, x, numSamples);
+            runLength = 0;
+        };
+
+        auto push = [&] (Biquad& stage)
+        {
+            run[runLength++] = &stage;
+            if (runLength == maxCascade)
+                flush();
+        };
+
+        for (int s = 0; s < lowCutSlopeStages; ++s)
+            push (hp[(size_t) s]);
+
+        for (int k = 0; k < numActive; ++k)
+        {
+            const auto i = (size_t) activeBands[(size_t) k];
+            if (isStatic (bands[i]))
             {
-                const auto det = std::abs (detectors[i].processSample (y));
-                const auto coeff = (det > b.detEnv) ? attackCoeff : releaseCoeff;
-                b.detEnv += (det - b.detEnv) * coeff;
-
-                const auto envDb = juce::Decibels::gainToDecibels (b.detEnv + 1.0e-6f, -120.0f);
-                float targetDyn = 0.0f;
-
-                if (b.dynRangeDb < 0.0f)
-                {
-                    const auto amt = juce::jlimit (0.0f, 1.0f, (envDb - b.dynThresholdDb) / 24.0f);
-                    targetDyn = b.dynRangeDb * amt;
-                }
-                else
-                {
-                    const auto amt = juce::jlimit (0.0f, 1.0f, (b.dynThresholdDb - envDb) / 24.0f);
-                    targetDyn = b.dynRangeDb * amt;
-                }
-
-                b.dynGainDb += (targetDyn - b.dynGainDb) * 0.14f;
-                peaks[i].setCoeffs (makeBandCoeffs (b.type, b.freqHz, b.gainDb + b.dynGainDb, b.q));
+                push (peaks[i]);
             }
-            else if (std::abs (b.dynGainDb) > 1.0e-6f)
+            else
             {
-                b.dynGainDb *= 0.90f;
-                peaks[i].setCoeffs (makeBandCoeffs (b.type, b.freqHz, b.gainDb + b.dynGainDb, b.q));
+                flush();
+                processBand (i, x, numSamples);
             }
-
-            y = peaks[i].processSample (y);
         }
 
-        for (int i = 0; i < highCutSlopeStages; ++i)
-            y = lp[(size_t) i].processSample (y);
-        return y;
+        for (int s = 0; s < highCutSlopeStages; ++s)
+            push (lp[(size_t) s]);
+
+        flush();
+
+        samplesToControl = samplesToTickAfter (samplesToControl, numSamples);
+
+        if (activeDirty)
+            refreshActiveBands();
+    }
+
+    float processSample (float x) noexcept
+    {
+        processBlock (&x, 1);
+        return x;
     }
 
     static float biquadMagnitudeDb (const BiquadCoeffs& c, double sampleRate, float freqHz) noexcept
@@ -390,18 +604,22 @@ public:
         return juce::Decibels::gainToDecibels (mag, -120.0f);
     }
 
+    // Static (non-dynamic) magnitude response of the whole EQ at freqHz.
     static void makeResponse (double sampleRate,
                               float lowCutHz, float highCutHz, int lowCutSlope, int highCutSlope,
-                              bool peak1On, int peak1Type, float peak1FreqHz, float peak1GainDb, float peak1Q,
-                              bool peak2On, int peak2Type, float peak2FreqHz, float peak2GainDb, float peak2Q,
-                              bool peak3On, int peak3Type, float peak3FreqHz, float peak3GainDb, float peak3Q,
-                              bool peak4On, int peak4Type, float peak4FreqHz, float peak4GainDb, float peak4Q,
-                              bool peak5On, int peak5Type, float peak5FreqHz, float peak5GainDb, float peak5Q,
-                              bool peak6On, int peak6Type, float peak6FreqHz, float peak6GainDb, float peak6Q,
-                              bool peak7On, int peak7Type, float peak7FreqHz, float peak7GainDb, float peak7Q,
-                              bool peak8On, int peak8Type, float peak8FreqHz, float peak8GainDb, float peak8Q,
+                              const BandParams* bandParams, int numBands,
                               float freqHz,
                               float& outDb) noexcept
+    {
+        makeResponse (sampleRate, lowCutHz, highCutHz, lowCutSlope, highCutSlope, bandParams, numBands,
+                      &freqHz, &outDb, 1);
+    }
+
+    // Same, at numFreqs frequencies; every section is designed once for the whole set.
+    static void makeResponse (double sampleRate,
+                              float lowCutHz, float highCutHz, int lowCutSlope, int highCutSlope,
+                              const BandParams* bandParams, int numBands,
+                              const float* freqsHz, float* outDb, int numFreqs) noexcept
     {
         const auto low = juce::jlimit (20.0f, 20000.0f, lowCutHz);
         const auto high = juce::jlimit (20.0f, 20000.0f, highCutHz);
@@ -412,27 +630,28 @@ public:
 
         const auto hpC = Biquad::makeHighPass (sampleRate, lo, 0.7071f);
         const auto lpC = Biquad::makeLowPass  (sampleRate, hi, 0.7071f);
-        const auto pk1 = peak1On ? makeBandCoeffsStatic (sampleRate, peak1Type, peak1FreqHz, peak1GainDb, peak1Q) : BiquadCoeffs{};
-        const auto pk2 = peak2On ? makeBandCoeffsStatic (sampleRate, peak2Type, peak2FreqHz, peak2GainDb, peak2Q) : BiquadCoeffs{};
-        const auto pk3 = peak3On ? makeBandCoeffsStatic (sampleRate, peak3Type, peak3FreqHz, peak3GainDb, peak3Q) : BiquadCoeffs{};
-        const auto pk4 = peak4On ? makeBandCoeffsStatic (sampleRate, peak4Type, peak4FreqHz, peak4GainDb, peak4Q) : BiquadCoeffs{};
-        const auto pk5 = peak5On ? makeBandCoeffsStatic (sampleRate, peak5Type, peak5FreqHz, peak5GainDb, peak5Q) : BiquadCoeffs{};
-        const auto pk6 = peak6On ? makeBandCoeffsStatic (sampleRate, peak6Type, peak6FreqHz, peak6GainDb, peak6Q) : BiquadCoeffs{};
-        const auto pk7 = peak7On ? makeBandCoeffsStatic (sampleRate, peak7Type, peak7FreqHz, peak7GainDb, peak7Q) : BiquadCoeffs{};
-        const auto pk8 = peak8On ? makeBandCoeffsStatic (sampleRate, peak8Type, peak8FreqHz, peak8GainDb, peak8Q) : BiquadCoeffs{};
-
-        float db = 0.0f;
-        db += (float) hpStages * biquadMagnitudeDb (hpC, sampleRate, freqHz);
-        db += biquadMagnitudeDb (pk1, sampleRate, freqHz);
-        db += biquadMagnitudeDb (pk2, sampleRate, freqHz);
-        db += biquadMagnitudeDb (pk3, sampleRate, freqHz);
-        db += biquadMagnitudeDb (pk4, sampleRate, freqHz);
-        db += biquadMagnitudeDb (pk5, sampleRate, freqHz);
-        db += biquadMagnitudeDb (pk6, sampleRate, freqHz);
-        db += biquadMagnitudeDb (pk7, sampleRate, freqHz);
-        db += biquadMagnitudeDb (pk8, sampleRate, freqHz);
-        db += (float) lpStages * biquadMagnitudeDb (lpC, sampleRate, freqHz);
-        outDb = db;
+
+        std::array<BiquadCoeffs, (size_t) maxBands> bandC {};
+        int numOn = 0;
+        for (int i = 0; i < juce::jmin (numBands, maxBands); ++i)
+        {
+            const auto& b = bandParams[i];
+            if (b.on)
+                bandC[(size_t) numOn++] = makeBandCoeffsStatic (sampleRate, b.type, b.freqHz, b.gainDb, b.q);
+        }
+
+        for (int f = 0; f < numFreqs; ++f)
+        {
+            const auto freqHz = freqsHz[f];
+            float db = 0.0f;
+            db += (float) hpStages * biquadMagnitudeDb (hpC, sampleRate, freqHz);
+
+            for (int i = 0; i < numOn; ++i)
+                db += biquadMagnitudeDb (bandC[(size_t) i], sampleRate, freqHz);
+
+            db += (float) lpStages * biquadMagnitudeDb (lpC, sampleRate, freqHz);
+            outDb[f] = db;
+        }
     }
 
 private:
@@ -448,8 +667,203 @@ private:
         float dynThresholdDb = -18.0f;
         float dynGainDb = 0.0f;
         float detEnv = 0.0f;
+
+        // What the peak biquad currently holds (see updateCoeffs / updateDynamics).
+        bool built = false;
+        bool builtOn = false;
+        int builtType = 0;
+        float builtFreqHz = 0.0f;
+        float builtGainDb = 0.0f;
+        float builtQ = 0.0f;
+        BiquadTrig trig;
+        float appliedDynDb = 0.0f;
+
+        // Linear coefficient ramp towards target over one control interval. Both ends are stable designs at
+        // the same frequency, and the stable (a1, a2) region is convex, so every step in between is too.
+        bool ramping = false;
+        BiquadCoeffs target;
+        BiquadCoeffs step;
+
+        bool active = false; // in the processing list
     };
 
+    static constexpr int dynControlInterval = 16;
+
+    static bool isDynamic (const Band& b) noexcept
+    {
+        return b.on && b.dynOn && std::abs (b.dynRangeDb) > 1.0e-4f;
+    }
+
+    static bool isGainDependent (int type) noexcept
+    {
+        const auto t = (PeakType) type;
+        return t == PeakType::peakBell || t == PeakType::peakLowShelf || t == PeakType::peakHighShelf;
+    }
+
+    // Off bands, and gain-type bands sitting at exactly 0 dB, are the identity: no need to run them.
+    static bool needsProcessing (const Band& b) noexcept
+    {
+        if (! b.on)
+            return false;
+
+        return ! isGainDependent (b.type) || isDynamic (b) || b.ramping
+            || b.gainDb != 0.0f || b.dynGainDb != 0.0f;
+    }
+
+    void refreshActiveBands() noexcept
+    {
+        numActive = 0;
+        for (size_t i = 0; i < bands.size(); ++i)
+        {
+            auto& b = bands[i];
+            const auto active = needsProcessing (b);
+
+            // Whatever state a band had when it dropped out belongs to an old signal.
+            if (active && ! b.active)
+                peaks[i].reset();
+
+            b.active = active;
+            if (active)
+                activeBands[(size_t) numActive++] = (int) i;
+        }
+
+        activeDirty = false;
+    }
+
+    static int samplesToTickAfter (int toTick, int numSamples) noexcept
+    {
+        if (toTick <= 0)
+            toTick = dynControlInterval;
+
+        if (numSamples < toTick)
+            return toTick - numSamples;
+
+        // 0 means the next tick is due on the first sample of the next block.
+        const auto past = (numSamples - toTick) % dynControlInterval;
+        return past == 0 ? 0 : dynControlInterval - past;
+    }
+
+    static constexpr int maxCascade = 4;
+
+    static void processCascade (Biquad* const* stages, int numStages, float* x, int numSamples) noexcept
+    {
+        switch (numStages)
+        {
+            case 1:  Biquad::processCascade<1> (stages, x, numSamples); break;
+            case 2:  Biquad::processCascade<2> (stages, x, numSamples); break;
+            case 3:  Biquad::processCascade<3> (stages, x, numSamples); break;
+            case 4:  Biquad::processCascade<4> (stages, x, numSamples); break;
+            default: break;
+        }
+    }
+
+    // Nothing about the band moves at control rate.
+    static bool isStatic (const Band& b) noexcept
+    {
+        return ! isDynamic (b) && ! b.ramping && b.dynGainDb == 0.0f;
+    }
+
+    void processBand (size_t i, float* x, int numSamples) noexcept
+    {
+        auto& b = bands[i];
+        auto& peak = peaks[i];
+
+        int toTick = samplesToControl;
+        for (int pos = 0; pos < numSamples;)
+        {
+            if (toTick <= 0)
+            {
+                updateDynamics (i);
+                toTick = dynControlInterval;
+            }
+
+            const auto len = juce::jmin (numSamples - pos, toTick);
+            auto* seg = x + pos;
+
+            // The detector envelope stays per sample so attacks are caught; gain follows at control rate.
+            if (isDynamic (b))
+            {
+                auto env = b.detEnv;
+                const auto att = attackCoeff;
+                const auto rel = releaseCoeff;
+                Biquad::processWithSidechain (peak, b.ramping ? &b.step : nullptr, detectors[i], seg, len,
+                                              [&env, att, rel] (float det) noexcept
+                                              {
+                                                  const auto d = std::abs (det);
+                                                  env += (d - env) * ((d > env) ? att : rel);
+                                              });
+                b.detEnv = env;
+            }
+            else if (b.ramping)
+            {
+                peak.processBlockRamped (seg, len, b.step);
+            }
+            else
+            {
+                peak.processBlock (seg, len);
+            }
+
+            pos += len;
+            toTick -= len;
+        }
+    }
+
+    // Control-rate part of the dynamic EQ for one band: detector level to dB, target gain, smoothing, and a
+    // coefficient ramp towards the new gain.
+    void updateDynamics (size_t i) noexcept
+    {
+        auto& b = bands[i];
+
+        if (b.ramping)
+        {
+            peaks[i].setCoeffs (b.target);
+            b.ramping = false;
+            activeDirty = true; // may have landed back on flat
+        }
+
+        if (isDynamic (b))
+        {
+            const auto envDb = juce::Decibels::gainToDecibels (b.detEnv + 1.0e-6f, -120.0f);
+            float targetDyn = 0.0f;
+
+            if (b.dynRangeDb < 0.0f)
+            {
+                const auto amt = juce::jlimit (0.0f, 1.0f, (envDb - b.dynThresholdDb) / 24.0f);
+                targetDyn = b.dynRangeDb * amt;
+            }
+            else
+            {
+                const auto amt = juce::jlimit (0.0f, 1.0f, (b.dynThresholdDb - envDb) / 24.0f);
+                targetDyn = b.dynRangeDb * amt;
+            }
+
+            b.dynGainDb += (targetDyn - b.dynGainDb) * dynSmoothPerTick;
+        }
+        else if (b.dynGainDb != 0.0f)
+        {
+            b.dynGainDb *= dynDecayPerTick;
+            if (std::abs (b.dynGainDb) <= 1.0e-6f)
+                b.dynGainDb = 0.0f;
+        }
+
+        if (! b.built || ! b.on || b.dynGainDb == b.appliedDynDb)
+            return;
+
+        b.appliedDynDb = b.dynGainDb;
+        if (! isGainDependent (b.type))
+            return;
+
+        b.target = makeBandCoeffs (b, b.gainDb + b.dynGainDb);
+        const auto& c = peaks[i].getCoeffs();
+        constexpr auto invLen = 1.0f / (float) dynControlInterval;
+        b.step.b0 = (b.target.b0 - c.b0) * invLen;
+        b.step.b1 = (b.target.b1 - c.b1) * invLen;
+        b.step.b2 = (b.target.b2 - c.b2) * invLen;
+        b.step.a1 = (b.target.a1 - c.a1) * invLen;
+        b.step.a2 = (b.target.a2 - c.a2) * invLen;
+        b.ramping = true;
+    }
+
     static int clampType (int t) noexcept
     {
         return juce::jlimit ((int) PeakType::peakBell, (int) PeakType::peakBandPass, t);
@@ -474,9 +888,18 @@ private:
         }
     }
 
-    BiquadCoeffs makeBandCoeffs (int type, float freqHz, float gainDb, float q) const noexcept
+    // Same designs as makeBandCoeffsStatic, from the band's cached trig.
+    static BiquadCoeffs makeBandCoeffs (const Band& b, float gainDb) noexcept
     {
-        return makeBandCoeffsStatic (sr, type, freqHz, gainDb, q);
+        switch ((PeakType) b.type)
+        {
+            case PeakType::peakNotch:     return Biquad::makeNotch (b.trig);
+            case PeakType::peakLowShelf:  return Biquad::makeLowShelf (b.trig, gainDb);
+            case PeakType::peakHighShelf: return Biquad::makeHighShelf (b.trig, gainDb);
+            case PeakType::peakBandPass:  return Biquad::makeBandPass (b.trig);
+            case PeakType::peakBell:
+            default:                      return Biquad::makePeak (b.trig, gainDb);
+        }
     }
 
     static float coeffFromMs (double sampleRate, float ms) noexcept
@@ -486,19 +909,6 @@ private:
         return 1.0f - std::exp ((float) (-1.0 / (srSafe * (double) s)));
     }
 
-    void setBand (size_t i, bool on, int type, float freq, float gain, float q, bool dynOn, float dynRange, float dynThreshold) noexcept
-    {
-        auto& b = bands[i];
-        b.on = on;
-        b.type = clampType (type);
-        b.freqHz = juce::jlimit (20.0f, 20000.0f, freq);
-        b.gainDb = juce::jlimit (-24.0f, 24.0f, gain);
-        b.q = juce::jlimit (0.1f, 18.0f, q);
-        b.dynOn = dynOn;
-        b.dynRangeDb = juce::jlimit (-24.0f, 24.0f, dynRange);
-        b.dynThresholdDb = juce::jlimit (-60.0f, 0.0f, dynThreshold);
-    }
-
     double sr = 44100.0;
     bool enabled = false;
     float lowCutHz = 20.0f;
@@ -507,12 +917,21 @@ private:
     int highCutSlopeStages = 2;
     float attackCoeff = 0.01f;
     float releaseCoeff = 0.001f;
+    float dynSmoothPerTick = 1.0f;
+    float dynDecayPerTick = 0.0f;
+    int samplesToControl = 0;
+    float builtLowCutHz = -1.0f;
+    float builtHighCutHz = -1.0f;
+
+    std::array<Band, (size_t) maxBands> bands {};
+    std::array<int, (size_t) maxBands> activeBands {};
+    int numActive = 0;
+    bool activeDirty = false;
 
-    std::array<Band, 8> bands {};
     std::array<Biquad, 4> hp {};
     std::array<Biquad, 4> lp {};
-    std::array<Biquad, 8> peaks {};
-    std::array<Biquad, 8> detectors {};
+    std::array<Biquad, (size_t) maxBands> peaks {};
+    std::array<Biquad, (size_t) maxBands> detectors {};
 };
 
 } // namespace ies::dsp
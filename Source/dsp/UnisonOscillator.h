@@ -0,0 +1,229 @@
+#pragma once
+
+#include <JuceHeader.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+#include "../Util/Math.h"
+#include "OscillatorBank.h"
+#include "SimdVec.h"
+#include "WavetableReader.h"
+#include "WavetableSet.h"
+
+namespace ies::dsp
+{
+// Unison stack for one oscillator: up to 16 detuned copies of the same wave, run 4 voices per SIMD group.
+// Voices follow a shared base increment (the oscillator's pitch) times a fixed per-voice ratio, and are summed
+// to mono with power-normalised gains so the level stays roughly constant as the voice count changes.
+class UnisonOscillator final
+{
+public:
+    static constexpr int maxVoices = 16;
+    static constexpr int lanes = 4;
+    static constexpr int maxGroups = maxVoices / lanes;
+    static constexpr float maxDetuneCents = 50.0f;
+
+    using Shape = OscillatorBank::Shape;
+
+    void prepare() noexcept
+    {
+        phase.fill (0.0f);
+        triState.fill (-0.25f);
+        numVoices = 0;
+        configure (1, 0.0f, 1.0f);
+    }
+
+    // detune01 scales the outermost voices to +-maxDetuneCents; blend01 is the level of the side voices
+    // relative to the centre voice(s). Cheap to call every block: only recomputes when something changed.
+    void configure (int voices, float detune01, float blend01) noexcept
+    {
+        voices = juce::jlimit (1, maxVoices, voices);
+        detune01 = juce::jlimit (0.0f, 1.0f, detune01);
+        blend01 = juce::jlimit (0.0f, 1.0f, blend01);
+        if (voices == numVoices && detune01 == detuneAmount && blend01 == blendAmount)
+            return;
+
+        numVoices = voices;
+        detuneAmount = detune01;
+        blendAmount = blend01;
+        numGroups = (numVoices + lanes - 1) / lanes;
+
+        float power = 0.0f;
+        for (int v = 0; v < maxVoices; ++v)
+        {
+            if (v >= numVoices)
+            {
+                ratio[(size_t) v] = 1.0f;
+                gain[(size_t) v] = 0.0f;
+                continue;
+            }
+
+            // Evenly spaced offsets in -1..1; the middle voice (or pair) is the "centre".
+            const auto offset = numVoices > 1 ? (2.0f * (float) v / (float) (numVoices - 1) - 1.0f) : 0.0f;
+            const auto mid = 0.5f * (float) (numVoices - 1);
+            const bool centre = std::abs ((float) v - mid) < 0.75f;
+
+            ratio[(size_t) v] = std::exp2 (offset * detuneAmount * maxDetuneCents / 1200.0f);
+            gain[(size_t) v] = centre ? 1.0f : blendAmount;
+            power += gain[(size_t) v] * gain[(size_t) v];
+        }
+
+        const auto norm = 1.0f / std::sqrt (juce::jmax (1.0e-6f, power));
+        for (auto& g : gain)
+            g *= norm;
+    }
+
+    // Wavetable stacks with a null table fall back to saw.
+    void setShape (Shape newShape, const WavetableSet* table = nullptr) noexcept
+    {
+        if (newShape == Shape::wavetable && table == nullptr)
+            newShape = Shape::saw;
+
+        shape = newShape;
+        wavetable = (shape == Shape::wavetable) ? table : nullptr;
+        for (auto& r : readers)
+            r.setTable (wavetable);
+    }
+
+    void setWavetableInterpolation (WavetableReader::Interpolation mode) noexcept
+    {
+        for (auto& r : readers)
+            r.setInterpolation (mode);
+    }
+
+    // Voice v starts at base + spread * frac(v * golden ratio), so spread 0 keeps all voices in phase.
+    void resetPhases (float base01, float spread01) noexcept
+    {
+        spread01 = juce::jlimit (0.0f, 1.0f, spread01);
+        for (int v = 0; v < maxVoices; ++v)
+        {
+            const auto offset = ies::math::wrap01 ((float) v * 0.6180339887f);
+            phase[(size_t) v] = ies::math::wrap01 (base01 + spread01 * offset);
+            triState[(size_t) v] = OscillatorBank::idealTriangleFromPhase (phase[(size_t) v]) * 0.25f;
+        }
+    }
+
+    int getNumVoices() const noexcept { return numVoices; }
+
+    // baseInc[i * stride] is the oscillator increment for sample i (e.g. one lane of the bank's increment frames).
+    void processBlock (const float* baseInc, int stride, float* out, int n) noexcept
+    {
+        switch (shape)
+        {
+            case Shape::off:       std::fill (out, out + juce::jmax (0, n), 0.0f); break;
+            case Shape::saw:       processPrimitive<Shape::saw> (baseInc, stride, out, n); break;
+            case Shape::square:    processPrimitive<Shape::square> (baseInc, stride, out, n); break;
+            case Shape::triangle:  processPrimitive<Shape::triangle> (baseInc, stride, out, n); break;
+            case Shape::wavetable: processWavetable (baseInc, stride, out, n); break;
+        }
+    }
+
+private:
+    using Vec = simd::Vec4;
+
+    template <Shape S>
+    void processPrimitive (const float* baseInc, int stride, float* out, int n) noexcept
+    {
+        const auto one = Vec::set (1.0f);
+        const auto minusOne = Vec::set (-1.0f);
+        const auto two = Vec::set (2.0f);
+        const auto four = Vec::set (4.0f);
+        const auto half = Vec::set (0.5f);
+        const auto leak = Vec::set (0.99999f);
+
+        Vec::T p[maxGroups], tri[maxGroups], r[maxGroups], g[maxGroups];
+        for (int k = 0; k < numGroups; ++k)
+        {
+            p[(size_t) k] = Vec::load (phase.data() + k * lanes);
+            tri[(size_t) k] = Vec::load (triState.data() + k * lanes);
+            r[(size_t) k] = Vec::load (ratio.data() + k * lanes);
+            g[(size_t) k] = Vec::load (gain.data() + k * lanes);
+        }
+
+        for (int i = 0; i < n; ++i)
+        {
+            const auto base = Vec::set (baseInc[(size_t) i * (size_t) stride]);
+            auto acc = Vec::set (0.0f);
+
+            for (int k = 0; k < numGroups; ++k)
+            {
+                auto& pk = p[(size_t) k];
+                auto dt = Vec::mul (base, r[(size_t) k]);
+                dt = Vec::select (Vec::gt (dt, half), half, dt);
+                const auto oneMinusDt = Vec::sub (one, dt);
+
+                Vec::T wave;
+                if constexpr (S == Shape::saw)
+                {
+                    wave = Vec::sub (Vec::mul (two, pk), one);
+                    if (Vec::any (Vec::bitOr (Vec::lt (pk, dt), Vec::gt (pk, oneMinusDt))))
+                        wave = Vec::sub (wave, simd::polyBlep (pk, dt));
+                }
+                else
+                {
+                    auto sq = Vec::select (Vec::lt (pk, half), one, minusOne);
+                    auto t2 = Vec::sub (Vec::add (pk, one), half);
+                    t2 = Vec::sub (t2, Vec::bitAnd (one, Vec::ge (t2, one)));
+
+                    const auto nearEdge = Vec::bitOr (Vec::bitOr (Vec::lt (pk, dt), Vec::gt (pk, oneMinusDt)),
+                                                      Vec::bitOr (Vec::lt (t2, dt), Vec::gt (t2, oneMinusDt)));
+                    if (Vec::any (nearEdge))
+                        sq = Vec::sub (Vec::add (sq, simd::polyBlep (pk, dt)), simd::polyBlep (t2, dt));
+
+                    if constexpr (S == Shape::triangle)
+                    {
+                        // Triangle integrates the band-limited square, with a very slow leak against drift.
+                        auto& tk = tri[(size_t) k];
+                        tk = Vec::mul (Vec::add (tk, Vec::mul (sq, dt)), leak);
+                        wave = Vec::mul (tk, four);
+                    }
+                    else
+                    {
+                        wave = sq;
+                    }
+                }
+
+                acc = Vec::add (acc, Vec::mul (wave, g[(size_t) k]));
+
+                pk = Vec::add (pk, dt);
+                pk = Vec::sub (pk, Vec::bitAnd (one, Vec::ge (pk, one)));
+            }
+
+            alignas (16) float sum[lanes];
+            Vec::store (sum, acc);
+            out[i] = (sum[0] + sum[1]) + (sum[2] + sum[3]);
+        }
+
+        for (int k = 0; k < numGroups; ++k)
+        {
+            Vec::store (phase.data() + k * lanes, p[(size_t) k]);
+            Vec::store (triState.data() + k * lanes, tri[(size_t) k]);
+        }
+    }
+
+    void processWavetable (const float* baseInc, int stride, float* out, int n) noexcept
+    {
+        // Voice-major, so each voice's reader picks its mips once per block for a static pitch.
+        std::fill (out, out + juce::jmax (0, n), 0.0f);
+        for (int v = 0; v < numVoices; ++v)
+            readers[(size_t) v].accumulateBlock (phase[(size_t) v], baseInc, stride, ratio[(size_t) v], gain[(size_t) v], out, n);
+    }
+
+    alignas (16) std::array<float, (size_t) maxVoices> phase {};
+    alignas (16) std::array<float, (size_t) maxVoices> triState {};
+    alignas (16) std::array<float, (size_t) maxVoices> ratio {};
+    alignas (16) std::array<float, (size_t) maxVoices> gain {};
+
+    std::array<WavetableReader, (size_t) maxVoices> readers {};
+
+    Shape shape = Shape::saw;
+    const WavetableSet* wavetable = nullptr;
+
+    int numVoices = 0;
+    int numGroups = 1;
+    float detuneAmount = -1.0f;
+    float blendAmount = -1.0f;
+};
+} // namespace ies::dsp
@@ -5,6 +5,7 @@
 #include <array>
 
 #include "../Params.h"
+#include "Adaa.h"
 
 namespace ies::dsp
 {
@@ -25,6 +26,8 @@ public:
         enabled = false;
         driveGain = 1.0f;
         mix = 1.0f;
+        adaa.reset();
+        dryDelay.reset();
 
         // Default linear transfer.
         for (int i = 0; i < numPoints; ++i)
@@ -37,6 +40,9 @@ public:
     void setDriveDb (float db) noexcept { driveGain = juce::Decibels::decibelsToGain (juce::jlimit (-48.0f, 48.0f, db), -100.0f); }
     void setMix (float wet01) noexcept { mix = juce::jlimit (0.0f, 1.0f, wet01); }
 
+    // params::destroy::AntiAlias: Off, or first/second-order ADAA over the curve.
+    void setAntiAlias (int order) noexcept { antiAliasOrder = juce::jlimit (0, 2, order); }
+
     void setPoint (int index, float y) noexcept
     {
         if (index < 0 || index >= numPoints)
@@ -67,11 +73,18 @@ public:
             rebuildTable();
     }
 
-    float processSample (float x) const noexcept
+    float processSample (float x) noexcept
     {
         if (! enabled)
             return x;
 
+        if (antiAliasOrder != (int) params::destroy::aaOff)
+        {
+            const auto wet = adaa.process (x * driveGain, antiAliasOrder, TableShape { *this });
+            const auto dryAligned = dryDelay.process (x, antiAliasOrder);
+            return dryAligned + (wet - dryAligned) * mix;
+        }
+
         const auto dry = x;
 
         // Keep transfer lookup stable while preserving aggressive behaviour.
@@ -86,6 +99,62 @@ public:
     }
 
 private:
+    // The transfer as ADAA sees it: the table interpolated linearly and held flat outside [-1, 1], with exact
+    // antiderivatives of that piecewise-linear curve taken from the integral tables.
+    struct TableShape
+    {
+        const WaveShaper& s;
+
+        static constexpr double dx = 2.0 / (double) (tableSize - 1);
+
+        static int cellOf (double u) noexcept
+        {
+            return juce::jlimit (0, tableSize - 2, (int) ((u + 1.0) / dx));
+        }
+
+        double f (double u) const noexcept
+        {
+            const auto c = juce::jlimit (-1.0, 1.0, u);
+            const auto i = cellOf (c);
+            const auto t = (c + 1.0) / dx - (double) i;
+            return (double) s.table[(size_t) i] + t * (double) (s.table[(size_t) i + 1] - s.table[(size_t) i]);
+        }
+
+        double F1 (double u) const noexcept
+        {
+            if (u <= -1.0)
+                return (double) s.table.front() * (u + 1.0);
+            if (u >= 1.0)
+                return s.integral1.back() + (double) s.table.back() * (u - 1.0);
+
+            const auto i = cellOf (u);
+            const auto d = u - (-1.0 + (double) i * dx);
+            const auto y0 = (double) s.table[(size_t) i];
+            const auto slope = ((double) s.table[(size_t) i + 1] - y0) / dx;
+            return s.integral1[(size_t) i] + y0 * d + 0.5 * slope * d * d;
+        }
+
+        double F2 (double u) const noexcept
+        {
+            if (u <= -1.0)
+            {
+                const auto d = u + 1.0;
+                return 0.5 * (double) s.table.front() * d * d;
+            }
+            if (u >= 1.0)
+            {
+                const auto d = u - 1.0;
+                return s.integral2.back() + s.integral1.back() * d + 0.5 * (double) s.table.back() * d * d;
+            }
+
+            const auto i = cellOf (u);
+            const auto d = u - (-1.0 + (double) i * dx);
+            const auto y0 = (double) s.table[(size_t) i];
+            const auto slope = ((double) s.table[(size_t) i + 1] - y0) / dx;
+            return s.integral2[(size_t) i] + s.integral1[(size_t) i] * d + 0.5 * y0 * d * d + slope * d * d * d / 6.0;
+        }
+    };
+
     void rebuildTable() noexcept
     {
         for (int i = 0; i < tableSize; ++i)
@@ -99,15 +168,36 @@ private:
             const auto y1 = points[(size_t) (seg + 1)];
             table[(size_t) i] = juce::jlimit (-1.0f, 1.0f, juce::jmap (frac, y0, y1));
         }
+
+        // Running first and second integrals from -1, exact for the linearly interpolated table.
+        constexpr double dx = TableShape::dx;
+        integral1[0] = 0.0;
+        integral2[0] = 0.0;
+        for (int i = 0; i + 1 < tableSize; ++i)
+        {
+            const auto y0 = (double) table[(size_t) i];
+            const auto y1 = (double) table[(size_t) i + 1];
+            integral1[(size_t) i + 1] = integral1[(size_t) i] + 0.5 * dx * (y0 + y1);
+            integral2[(size_t) i + 1] = integral2[(size_t) i] + integral1[(size_t) i] * dx + dx * dx * (2.0 * y0 + y1) / 6.0;
+        }
+
+        // Second-order ADAA keeps a divided difference taken from the old integrals.
+        adaa.shapeChanged();
     }
 
     double sr = 44100.0;
     bool enabled = false;
     float driveGain = 1.0f;
     float mix = 1.0f;
+    int antiAliasOrder = (int) params::destroy::aaOff;
 
     std::array<float, numPoints> points {};
     std::array<float, tableSize> table {};
+    std::array<double, tableSize> integral1 {};
+    std::array<double, tableSize> integral2 {};
+
+    Adaa<TableShape> adaa;
+    AdaaDryDelay dryDelay;
 };
 } // namespace ies::dsp
 
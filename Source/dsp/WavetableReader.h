@@ -0,0 +1,158 @@
+#pragma once
+
+#include <JuceHeader.h>
+
+#include <cmath>
+
+#include "../Util/Math.h"
+#include "WavetableSet.h"
+
+namespace ies::dsp
+{
+// Block reader for one wavetable voice. The mip pair and crossfade are only recomputed when the phase increment
+// changes (once per block for a static pitch), and adjacent mips are crossfaded so glides don't click at octave
+// boundaries. Level sizes are powers of two, so wrapping is a mask.
+class WavetableReader final
+{
+public:
+    enum class Interpolation
+    {
+        linear,
+        cubic // 4-point Hermite
+    };
+
+    void setTable (const WavetableSet* newTable) noexcept
+    {
+        if (newTable != table)
+        {
+            table = newTable;
+            lastInc = -1.0f;
+        }
+    }
+
+    void setInterpolation (Interpolation mode) noexcept { interpolation = mode; }
+
+    // Looks up n samples at the given phases; phases, incs and out are all `stride` floats apart.
+    void readBlock (const float* phases, const float* incs, int stride, float* out, int n) noexcept
+    {
+        if (interpolation == Interpolation::cubic)
+            readBlock<true> (phases, incs, stride, out, n);
+        else
+            readBlock<false> (phases, incs, stride, out, n);
+    }
+
+    // Advances its own phase by incScale * incs (stride apart, capped at 0.5) and adds gain * wave into out (contiguous).
+    void accumulateBlock (float& phase, const float* incs, int stride, float incScale, float gain, float* out, int n) noexcept
+    {
+        if (interpolation == Interpolation::cubic)
+            accumulateBlock<true> (phase, incs, stride, incScale, gain, out, n);
+        else
+            accumulateBlock<false> (phase, incs, stride, incScale, gain, out, n);
+    }
+
+private:
+    struct Level
+    {
+        const float* data = nullptr;
+        int mask = 0;
+        float size = 0.0f;
+    };
+
+    template <bool Cubic>
+    void readBlock (const float* phases, const float* incs, int stride, float* out, int n) noexcept
+    {
+        if (table == nullptr)
+            return;
+
+        for (int i = 0; i < n; ++i)
+        {
+            const auto k = (size_t) i * (size_t) stride;
+            out[k] = sample<Cubic> (phases[k], incs[k]);
+        }
+    }
+
+    template <bool Cubic>
+    void accumulateBlock (float& phase, const float* incs, int stride, float incScale, float gain, float* out, int n) noexcept
+    {
+        if (table == nullptr)
+            return;
+
+        auto ph = phase;
+        for (int i = 0; i < n; ++i)
+        {
+            const auto inc = juce::jmin (0.5f, incs[(size_t) i * (size_t) stride] * incScale);
+            out[i] += gain * sample<Cubic> (ph, inc);
+
+            ph += inc;
+            if (ph >= 1.0f)
+                ph -= 1.0f;
+        }
+        phase = ph;
+    }
+
+    template <bool Cubic>
+    float sample (float ph, float inc) noexcept
+    {
+        if (inc != lastInc)
+            selectMips (inc);
+
+        auto s = lookup<Cubic> (lo, ph);
+        if (fade > 0.0f)
+            s += fade * (lookup<Cubic> (hi, ph) - s);
+        return s;
+    }
+
+    // Level m is alias-free up to tableSize * inc = 2^m. Fading from level floor(log2 rate) + 1 towards the next
+    // one keeps both ends alias-free, and the mix is continuous when the rate crosses an octave.
+    void selectMips (float inc) noexcept
+    {
+        lastInc = inc;
+
+        const auto rate = (float) WavetableSet::tableSize * inc;
+        auto pos = rate > 1.0e-6f ? ies::math::fastLog2 (rate) + 1.0f : 0.0f;
+        pos = juce::jlimit (0.0f, (float) (WavetableSet::numMips - 1), pos);
+
+        const auto m = juce::jmin ((int) pos, WavetableSet::numMips - 1);
+        fade = (m < WavetableSet::numMips - 1) ? pos - (float) m : 0.0f;
+        lo = levelOf (m);
+        hi = levelOf (juce::jmin (m + 1, WavetableSet::numMips - 1));
+    }
+
+    Level levelOf (int m) const noexcept
+    {
+        const auto size = WavetableSet::levelSize (m);
+        return { table->level (m), size - 1, (float) size };
+    }
+
+    template <bool Cubic>
+    static float lookup (const Level& l, float ph) noexcept
+    {
+        const auto idx = ph * l.size;
+        const auto i0 = (int) idx;
+        const auto frac = idx - (float) i0;
+
+        const auto y0 = l.data[i0 & l.mask];
+        const auto y1 = l.data[(i0 + 1) & l.mask];
+        if constexpr (! Cubic)
+        {
+            return y0 + frac * (y1 - y0);
+        }
+        else
+        {
+            const auto ym = l.data[(i0 - 1) & l.mask];
+            const auto y2 = l.data[(i0 + 2) & l.mask];
+            const auto c1 = 0.5f * (y1 - ym);
+            const auto c2 = ym - 2.5f * y0 + 2.0f * y1 - 0.5f * y2;
+            const auto c3 = 0.5f * (y2 - ym) + 1.5f * (y0 - y1);
+            return ((c3 * frac + c2) * frac + c1) * frac + y0;
+        }
+    }
+
+    const WavetableSet* table = nullptr;
+    Interpolation interpolation = Interpolation::linear;
+
+    Level lo, hi;
+    float fade = 0.0f;
+    float lastInc = -1.0f;
+};
+} // namespace ies::dsp
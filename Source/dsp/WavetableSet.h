@@ -4,22 +4,55 @@
 
 #include <array>
 #include <cmath>
+#include <vector>
 
 namespace ies::dsp
 {
-// Single-cycle wavetable with a few pre-filtered mip levels (same table size for all mips).
-// This is intentionally simple: industrial character tolerates some aliasing, but mips help a lot.
+// Single-cycle wavetable as an octave-spaced mip pyramid. Level m is band-limited to the harmonics that cannot
+// alias when it is selected (fewer than tableSize / 2 >> m), so it only needs tableSize >> m samples; levels
+// stop shrinking at minLevelSize to keep linear interpolation accurate on the short tables.
 struct WavetableSet final
 {
     static constexpr int tableSize = 2048;
-    static constexpr int numMips = 8;
+    static constexpr int numMips = 10;
+    static constexpr int minLevelSize = 64;
 
-    std::array<std::array<float, (size_t) tableSize>, (size_t) numMips> mip {};
+    static constexpr int levelSize (int idx) noexcept
+    {
+        return (tableSize >> idx) > minLevelSize ? (tableSize >> idx) : minLevelSize;
+    }
+
+    static constexpr int levelOffset (int idx) noexcept
+    {
+        int offset = 0;
+        for (int m = 0; m < idx; ++m)
+            offset += levelSize (m);
+        return offset;
+    }
+
+    // Highest harmonic kept in a level (exclusive).
+    static constexpr int harmonicLimit (int idx) noexcept { return (tableSize / 2) >> idx; }
+
+    static constexpr int storageSize = []
+    {
+        int total = 0;
+        for (int m = 0; m < numMips; ++m)
+            total += (tableSize >> m) > minLevelSize ? (tableSize >> m) : minLevelSize;
+        return total;
+    }();
+
+    std::array<float, (size_t) storageSize> samples {};
 
     const float* level (int idx) const noexcept
     {
         idx = juce::jlimit (0, numMips - 1, idx);
-        return mip[(size_t) idx].data();
+        return samples.data() + levelOffset (idx);
+    }
+
+    float* level (int idx) noexcept
+    {
+        idx = juce::jlimit (0, numMips - 1, idx);
+        return samples.data() + levelOffset (idx);
     }
 };
 
@@ -48,22 +81,76 @@ inline void removeDcAndNormalise (float* samples, int n) noexcept
     }
 }
 
-inline void buildMipsFromLevel0 (WavetableSet& out) noexcept
+// Rebuilds every level from level 0 (tableSize samples): one FFT of level 0, then each level is the inverse FFT
+// of its truncated spectrum at its own size. DC is removed and all levels share level 0's normalisation gain,
+// so switching mips does not change the loudness. Allocates; call off the audio thread.
+inline void buildMipsFromLevel0 (WavetableSet& out)
 {
-    // Mip[k+1] is a 1-pole-ish lowpass of mip[k], keeping tableSize constant.
-    for (int m = 1; m < WavetableSet::numMips; ++m)
+    constexpr int n = WavetableSet::tableSize;
+    constexpr int order = 11;
+    static_assert ((1 << order) == n, "FFT order must match the table size");
+
+    std::vector<float> spectrum ((size_t) (2 * n), 0.0f);
+    std::vector<float> work ((size_t) (2 * n), 0.0f);
+
+    std::copy (out.level (0), out.level (0) + n, spectrum.begin());
+    juce::dsp::FFT (order).performRealOnlyForwardTransform (spectrum.data(), true);
+
+    for (int m = 0; m < WavetableSet::numMips; ++m)
     {
-        auto& dst = out.mip[(size_t) m];
-        const auto& src = out.mip[(size_t) (m - 1)];
+        const int size = WavetableSet::levelSize (m);
+        const int bins = juce::jmin (WavetableSet::harmonicLimit (m), size / 2);
+        const float scale = (float) size / (float) n;
 
-        for (int i = 0; i < WavetableSet::tableSize; ++i)
+        std::fill (work.begin(), work.end(), 0.0f);
+        for (int k = 1; k < bins; ++k)
         {
-            const int j = (i + 1) % WavetableSet::tableSize;
-            dst[(size_t) i] = 0.5f * (src[(size_t) i] + src[(size_t) j]);
+            work[(size_t) (2 * k)] = spectrum[(size_t) (2 * k)] * scale;
+            work[(size_t) (2 * k + 1)] = spectrum[(size_t) (2 * k + 1)] * scale;
         }
 
-        removeDcAndNormalise (dst.data(), WavetableSet::tableSize);
+        int levelOrder = order;
+        while ((1 << levelOrder) > size)
+            --levelOrder;
+
+        juce::dsp::FFT (levelOrder).performRealOnlyInverseTransform (work.data());
+        std::copy (work.begin(), work.begin() + size, out.level (m));
+    }
+
+    float peak = 0.0f;
+    for (int i = 0; i < n; ++i)
+        peak = juce::jmax (peak, std::abs (out.level (0)[i]));
+
+    if (peak > 1.0e-6f)
+    {
+        const float g = 0.98f / peak;
+        for (auto& s : out.samples)
+            s *= g;
     }
 }
-} // namespace ies::dsp
 
+// Level 0 from drawn points (y values at equidistant x in [0..1], last point = end of the cycle), then the pyramid.
+// The first point is replaced by the last so the cycle is periodic.
+inline void pointsToWavetable (WavetableSet& out, const float* points, int numPoints)
+{
+    const int n = juce::jmax (2, numPoints);
+    const auto pointAt = [points, n] (int i)
+    {
+        return juce::jlimit (-1.0f, 1.0f, points[i == 0 ? n - 1 : i]);
+    };
+
+    auto* t0 = out.level (0);
+    for (int i = 0; i < WavetableSet::tableSize; ++i)
+    {
+        const float x = (float) i / (float) WavetableSet::tableSize;
+        const float pos = x * (float) (n - 1);
+        const int i0 = juce::jlimit (0, n - 2, (int) std::floor (pos));
+        const float frac = pos - (float) i0;
+        const float a = pointAt (i0);
+        const float b = pointAt (i0 + 1);
+        t0[i] = a + frac * (b - a);
+    }
+
+    buildMipsFromLevel0 (out);
+}
+} // namespace ies::dsp
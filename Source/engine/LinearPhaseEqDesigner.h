@@ -0,0 +1,231 @@
+#pragma once
+
+#include <JuceHeader.h>
+
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "../Params.h"
+#include "../dsp/PartitionedConvolver.h"
+#include "../dsp/ToneEQ.h"
+#include "TripleBuffer.h"
+
+namespace ies::engine
+{
+// Designs the linear-phase Tone EQ kernel off the audio thread: the static magnitude response
+// (ToneEQ::makeResponse) is sampled on an FFT grid, turned into a zero-phase impulse response, centred, windowed
+// and split into convolver partitions. Requests and finished kernels both go through triple buffers, so the
+// audio thread never waits, allocates or runs a transform here; requests that arrive while a design runs are
+// coalesced to the latest settings. The thread only polls while the linear-phase path is in use; otherwise it
+// sleeps until setActive (true).
+class LinearPhaseEqDesigner final : private juce::Thread
+{
+public:
+    // What the kernel is designed from. A flat request (Tone off) yields a pure delay, so the reported latency
+    // does not depend on the Tone switch.
+    struct Settings final
+    {
+        bool flat = true;
+        float lowCutHz = 20.0f;
+        float highCutHz = 20000.0f;
+        int lowCutSlope = (int) params::tone::slope24;
+        int highCutSlope = (int) params::tone::slope24;
+        std::array<dsp::ToneEQ::BandParams, (size_t) params::tone::maxPeaks> bands {};
+
+        bool operator== (const Settings& o) const noexcept
+        {
+            if (flat != o.flat || lowCutHz != o.lowCutHz || highCutHz != o.highCutHz
+                || lowCutSlope != o.lowCutSlope || highCutSlope != o.highCutSlope)
+                return false;
+
+            for (size_t i = 0; i < bands.size(); ++i)
+            {
+                const auto& a = bands[i];
+                const auto& b = o.bands[i];
+                if (a.on != b.on)
+                    return false;
+                if (a.on && (a.type != b.type || a.freqHz != b.freqHz || a.gainDb != b.gainDb || a.q != b.q))
+                    return false;
+            }
+
+            return true;
+        }
+
+        bool operator!= (const Settings& o) const noexcept { return ! (*this == o); }
+    };
+
+    LinearPhaseEqDesigner() : juce::Thread ("IES linear-phase EQ designer") {}
+    ~LinearPhaseEqDesigner() override { stop(); }
+
+    // Message thread, with the designer stopped. Allocates, then designs `initial` on the calling thread so a
+    // kernel is ready for the first block.
+    void prepare (double sampleRate, const Settings& initial)
+    {
+        sr = (sampleRate > 0.0) ? sampleRate : 44100.0;
+
+        // About 80 ms of kernel: ~12 Hz grid resolution for the low cut and shelves.
+        designSize = 1024;
+        while (designSize < (int) std::ceil (sr * 0.08) && designSize < 32768)
+            designSize *= 2;
+        kernelLength = designSize - 1; // odd, so the centre tap sits on a whole sample
+
+        int order = 0;
+        while ((1 << order) < designSize)
+            ++order;
+        designFft = std::make_unique<juce::dsp::FFT> (order);
+        partitionFft = std::make_unique<juce::dsp::FFT> (dsp::PartitionedConvolver::blockOrder + 1);
+
+        const auto numBins = designSize / 2 + 1;
+        binFreqs.resize ((size_t) numBins);
+        for (int k = 0; k < numBins; ++k)
+            binFreqs[(size_t) k] = (float) ((double) k * sr / (double) designSize);
+        binDb.resize ((size_t) numBins);
+        spectrum.assign ((size_t) (2 * designSize), 0.0f);
+        impulse.resize ((size_t) kernelLength);
+        partitionScratch.clear();
+
+        windowTable.resize ((size_t) kernelLength);
+        const auto denom = (double) (kernelLength - 1);
+        for (int n = 0; n < kernelLength; ++n)
+        {
+            const auto x = juce::MathConstants<double>::twoPi * (double) n / denom;
+            windowTable[(size_t) n] = (float) (0.42 - 0.5 * std::cos (x) + 0.08 * std::cos (2.0 * x)); // Blackman
+        }
+
+        lastRequested = initial;
+        designedSerial = requestSerial; // anything still queued is older than `initial`
+        design (initial);
+    }
+
+    void start() { startThread(); }
+    void stop() { stopThread (1000); }
+
+    int getKernelLength() const noexcept { return kernelLength; }
+
+    // Convolver block plus the centre of the symmetric kernel.
+    int getLatencySamples() const noexcept
+    {
+        return dsp::PartitionedConvolver::blockSize + (kernelLength - 1) / 2;
+    }
+
+    // Audio thread, on a phase-mode switch (and at prepare). Waking the thread signals its event once per switch
+    // to Linear; nothing is signalled per block.
+    void setActive (bool shouldPoll) noexcept
+    {
+        if (active.exchange (shouldPoll, std::memory_order_acq_rel) != shouldPoll && shouldPoll)
+            notify();
+    }
+
+    // Audio thread; wait-free. Repeats of the last request are dropped.
+    void request (const Settings& s) noexcept
+    {
+        if (s == lastRequested)
+            return;
+
+        lastRequested = s;
+        auto& slot = requests.getWriteSlot();
+        slot.settings = s;
+        slot.serial = ++requestSerial;
+        requests.publish();
+    }
+
+    // Audio thread; the newest finished kernel, or null when there is nothing new since the last call.
+    const dsp::ConvolutionKernel* takeKernel() noexcept
+    {
+        const auto* k = kernels.acquire();
+        if (k == nullptr || k->serial == takenSerial)
+            return nullptr;
+
+        takenSerial = k->serial;
+        return &k->kernel;
+    }
+
+private:
+    struct Request
+    {
+        Settings settings;
+        unsigned serial = 0;
+    };
+
+    struct Kernel
+    {
+        dsp::ConvolutionKernel kernel;
+        unsigned serial = 0;
+    };
+
+    void run() override
+    {
+        // Polls while active instead of being notified per request: that would mean signalling an event from the
+        // audio thread every block. While inactive it blocks until setActive (true) or stop().
+        while (! threadShouldExit())
+        {
+            wait (active.load (std::memory_order_acquire) ? 10 : -1);
+
+            const auto* r = requests.acquire();
+            if (r != nullptr && r->serial != designedSerial)
+            {
+                designedSerial = r->serial;
+                design (r->settings);
+            }
+        }
+    }
+
+    void design (const Settings& s)
+    {
+        const auto numBins = designSize / 2 + 1;
+        if (s.flat)
+            std::fill (binDb.begin(), binDb.end(), 0.0f);
+        else
+            dsp::ToneEQ::makeResponse (sr, s.lowCutHz, s.highCutHz, s.lowCutSlope, s.highCutSlope,
+                                       s.bands.data(), (int) s.bands.size(),
+                                       binFreqs.data(), binDb.data(), numBins);
+
+        // Real, zero-phase spectrum -> impulse response symmetric around sample 0.
+        std::fill (spectrum.begin(), spectrum.end(), 0.0f);
+        for (int k = 0; k < numBins; ++k)
+            spectrum[(size_t) (2 * k)] = juce::Decibels::decibelsToGain (binDb[(size_t) k], -120.0f);
+        designFft->performRealOnlyInverseTransform (spectrum.data());
+
+        // Rotate so the peak sits in the middle of the kernel, then window.
+        const auto centre = (kernelLength - 1) / 2;
+        for (int n = 0; n < kernelLength; ++n)
+        {
+            const auto src = (n - centre + designSize) % designSize;
+            impulse[(size_t) n] = spectrum[(size_t) src] * windowTable[(size_t) n];
+        }
+
+        auto& slot = kernels.getWriteSlot();
+        dsp::PartitionedConvolver::makeKernel (impulse.data(), kernelLength, slot.kernel, *partitionFft, partitionScratch);
+        slot.serial = ++kernelSerial;
+        kernels.publish();
+    }
+
+    double sr = 44100.0;
+    int designSize = 4096;
+    int kernelLength = 4095;
+
+    // Designer side.
+    std::unique_ptr<juce::dsp::FFT> designFft;
+    std::unique_ptr<juce::dsp::FFT> partitionFft;
+    std::vector<float> binFreqs;
+    std::vector<float> binDb;
+    std::vector<float> spectrum;
+    std::vector<float> impulse;
+    std::vector<float> windowTable;
+    std::vector<float> partitionScratch;
+    unsigned designedSerial = 0;
+    unsigned kernelSerial = 0;
+
+    // Audio side.
+    std::atomic<bool> active { false };
+    Settings lastRequested;
+    unsigned requestSerial = 0;
+    unsigned takenSerial = 0;
+
+    TripleBuffer<Request> requests;
+    TripleBuffer<Kernel> kernels;
+};
+} // namespace ies::engine
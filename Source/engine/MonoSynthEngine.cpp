@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include <cmath>
+#include <cstring>
 
 namespace ies::engine
 {
@@ -11,23 +12,10 @@ static int msToSamples (double sampleRate, float ms) noexcept
     return (int) std::lround (sampleRate * (double) clampedMs / 1000.0);
 }
 
-static float readDelayLinear (const std::vector<float>& buf, int writePos, float delaySamples) noexcept
+static void setTargetIfChanged (juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear>& sm, float v) noexcept
 {
-    if (buf.empty())
-        return 0.0f;
-
-    const int size = (int) buf.size();
-    float rp = (float) writePos - delaySamples;
-    int i0 = (int) std::floor (rp);
-    float frac = rp - (float) i0;
-
-    while (i0 < 0)
-        i0 += size;
-
-    const int i1 = (i0 + 1) % size;
-    const float a = buf[(size_t) i0];
-    const float b = buf[(size_t) i1];
-    return a + frac * (b - a);
+    if (std::abs (v - sm.getTargetValue()) > 1.0e-6f)
+        sm.setTargetValue (v);
 }
 
 void MonoSynthEngine::prepare (double sr, int maxBlockSize)
@@ -51,42 +39,44 @@ void MonoSynthEngine::prepare (double sr, int maxBlockSize)
     pitchBendSemisSm.reset (sampleRateHz, 0.002);
     pitchBendSemisSm.setCurrentAndTargetValue (0.0f);
     modRngState = 0x52414e44u;
+    modCtrlValue.fill (0.0f);
+    modCtrlStep.fill (0.0f);
+    modCtrlCountdown = 0;
     randomNoteValue = 0.0f;
 
-    osc1.prepare (sampleRateHz);
-    osc2.prepare (sampleRateHz);
-    osc3.prepare (sampleRateHz);
-
-    // Ensure we have some default custom wavetable pointers so Draw mode never dereferences null.
-    // If the processor never sets them, Draw mode will fall back to Saw.
-    for (auto& a : customTables)
-        a.store (nullptr, std::memory_order_release);
+    oscBank.prepare (sampleRateHz, maxBlockSize);
+    for (auto& u : unison)
+        u.prepare();
+    pitchConverter.prepare (sampleRateHz);
+    drift.prepare (sampleRateHz);
 
     lfo1.prepare (sampleRateHz);
     lfo2.prepare (sampleRateHz);
 
-    destroyBase.prepare (sampleRateHz);
-    destroyOs2.prepare (sampleRateHz * 2.0);
-    destroyOs4.prepare (sampleRateHz * 4.0);
+    destroyBase.prepare (sampleRateHz, juce::jmax (1, maxBlockSize));
+    destroyOs2.prepare (sampleRateHz * 2.0, juce::jmax (1, maxBlockSize) * 2);
+    destroyOs4.prepare (sampleRateHz * 4.0, juce::jmax (1, maxBlockSize) * 4);
+    destroyOs8.prepare (sampleRateHz * 8.0, juce::jmax (1, maxBlockSize) * 8);
     filter.prepare (sampleRateHz);
     toneEq.prepare (sampleRateHz);
     shaper.prepare (sampleRateHz);
     fxChain.prepare (sampleRateHz, maxBlockSize, 2);
     const int xtraDelaySamples = juce::jmax (64, (int) std::ceil (sampleRateHz * 0.08));
-    xtraDelayL.assign ((size_t) xtraDelaySamples + 4u, 0.0f);
-    xtraDelayR.assign ((size_t) xtraDelaySamples + 4u, 0.0f);
+    xtraDelayL.prepare (xtraDelaySamples);
+    xtraDelayR.prepare (xtraDelaySamples);
     resetXtraState();
 
     // Oversampling/scratch buffers are allocated up-front (no audio-thread allocations).
     const auto maxN = juce::jmax (1, maxBlockSize);
     destroyBuffer.setSize (1, maxN, false, false, true);
+    destroyFadeBuffer.setSize (1, maxN, false, false, true);
     ampEnvBuf.resize ((size_t) maxN);
     filterEnvBuf.resize ((size_t) maxN);
     destroyNoteHz.resize ((size_t) maxN);
-    destroyFoldDriveDb.resize ((size_t) maxN);
+    destroyFoldDrive.resize ((size_t) maxN);
     destroyFoldAmount.resize ((size_t) maxN);
     destroyFoldMix.resize ((size_t) maxN);
-    destroyClipDriveDb.resize ((size_t) maxN);
+    destroyClipDrive.resize ((size_t) maxN);
     destroyClipAmount.resize ((size_t) maxN);
     destroyClipMix.resize ((size_t) maxN);
     destroyModAmount.resize ((size_t) maxN);
@@ -95,18 +85,40 @@ void MonoSynthEngine::prepare (double sr, int maxBlockSize)
     destroyCrushMix.resize ((size_t) maxN);
     shaperDriveDb.resize ((size_t) maxN);
     shaperMix.resize ((size_t) maxN);
+    pitchLockPhaseBuf.resize ((size_t) maxN);
+    pitchLockEnvBuf.resize ((size_t) maxN);
     filterModCutoffSemis.resize ((size_t) maxN);
     filterModResAdd.resize ((size_t) maxN);
+    filterCutoffBuf.resize ((size_t) maxN);
+    filterResBuf.resize ((size_t) maxN);
+    for (auto& b : oscOutBuf)
+        b.resize ((size_t) maxN);
+    for (auto& b : oscLevelBuf)
+        b.resize ((size_t) maxN);
+    noiseBuf.resize ((size_t) maxN);
+    polyBendRatio.resize ((size_t) maxN);
+    polyCutoffHz.resize ((size_t) maxN);
+    polyEnvSemis.resize ((size_t) maxN);
+    polyResonance.resize ((size_t) maxN);
+    voicePool.prepare (sampleRateHz, maxN);
     fxDryL.resize ((size_t) maxN);
     fxDryR.resize ((size_t) maxN);
     fxParallelL.resize ((size_t) maxN);
     fxParallelR.resize ((size_t) maxN);
+    fxParallelAlignL.prepare (fxChain.getLatencySamples(), maxN);
+    fxParallelAlignR.prepare (fxChain.getLatencySamples(), maxN);
 
     destroyOversampling2x.initProcessing ((size_t) maxN);
     destroyOversampling4x.initProcessing ((size_t) maxN);
+    destroyOversampling8x.initProcessing ((size_t) maxN);
     destroyOversampling2x.reset();
     destroyOversampling4x.reset();
-    destroyOversamplingFactorPrev = 1;
+    destroyOversampling8x.reset();
+    destroyOsFactor = 1;
+    destroyOsFadeRemaining = 0;
+    destroyOsStarted = false;
+    destroyOsFadeLength = juce::jmax (1, msToSamples (sampleRateHz, 10.0f));
+    destroyOsAutoHold = 0;
 
     // Smoothing for automation-heavy params (cutoff/drive/mix).
     constexpr double smoothSeconds = 0.02;
@@ -146,6 +158,13 @@ void MonoSynthEngine::prepare (double sr, int maxBlockSize)
     shaperMixSm.reset (sampleRateHz, smoothSeconds);
     shaperMixSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->shaperMix : nullptr, 1.0f));
 
+    oscLevelSm[0].reset (sampleRateHz, smoothSeconds);
+    oscLevelSm[0].setCurrentAndTargetValue (loadParam (params != nullptr ? params->osc1Level : nullptr, 0.8f));
+    oscLevelSm[1].reset (sampleRateHz, smoothSeconds);
+    oscLevelSm[1].setCurrentAndTargetValue (loadParam (params != nullptr ? params->osc2Level : nullptr, 0.5f));
+    oscLevelSm[2].reset (sampleRateHz, smoothSeconds);
+    oscLevelSm[2].setCurrentAndTargetValue (loadParam (params != nullptr ? params->osc3Level : nullptr, 0.0f));
+
     noiseLevelSm.reset (sampleRateHz, smoothSeconds);
     noiseLevelSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->noiseLevel : nullptr, 0.0f));
     noiseColorSm.reset (sampleRateHz, smoothSeconds);
@@ -190,117 +209,36 @@ void MonoSynthEngine::prepare (double sr, int maxBlockSize)
     toneLowCutSlope = (params != nullptr && params->toneLowCutSlope != nullptr) ? (int) std::lround (params->toneLowCutSlope->load()) : (int) params::tone::slope24;
     toneHighCutSlope = (params != nullptr && params->toneHighCutSlope != nullptr) ? (int) std::lround (params->toneHighCutSlope->load()) : (int) params::tone::slope24;
 
-    tonePeak1On = (params != nullptr && params->tonePeak1Enable != nullptr) ? (params->tonePeak1Enable->load() >= 0.5f) : true;
-    tonePeak1Type = (params != nullptr && params->tonePeak1Type != nullptr) ? (int) std::lround (params->tonePeak1Type->load()) : (int) params::tone::peakBell;
-    tonePeak1FreqHzSm.reset (sampleRateHz, smoothSeconds);
-    tonePeak1FreqHzSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak1FreqHz : nullptr, 220.0f));
-    tonePeak1GainDbSm.reset (sampleRateHz, smoothSeconds);
-    tonePeak1GainDbSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak1GainDb : nullptr, 0.0f));
-    tonePeak1QSm.reset (sampleRateHz, smoothSeconds);
-    tonePeak1QSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak1Q : nullptr, 0.90f));
-    tonePeak1DynOn = (params != nullptr && params->tonePeak1DynEnable != nullptr) ? (params->tonePeak1DynEnable->load() >= 0.5f) : false;
-    tonePeak1DynRangeDbSm.reset (sampleRateHz, smoothSeconds);
-    tonePeak1DynRangeDbSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak1DynRangeDb : nullptr, 0.0f));
-    tonePeak1DynThresholdDbSm.reset (sampleRateHz, smoothSeconds);
-    tonePeak1DynThresholdDbSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak1DynThresholdDb : nullptr, -18.0f));
-
-    tonePeak2On = (params != nullptr && params->tonePeak2Enable != nullptr) ? (params->tonePeak2Enable->load() >= 0.5f) : true;
-    tonePeak2Type = (params != nullptr && params->tonePeak2Type != nullptr) ? (int) std::lround (params->tonePeak2Type->load()) : (int) params::tone::peakBell;
-    tonePeak2FreqHzSm.reset (sampleRateHz, smoothSeconds);
-    tonePeak2FreqHzSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak2FreqHz : nullptr, 1000.0f));
-    tonePeak2GainDbSm.reset (sampleRateHz, smoothSeconds);
-    tonePeak2GainDbSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak2GainDb : nullptr, 0.0f));
-    tonePeak2QSm.reset (sampleRateHz, smoothSeconds);
-    tonePeak2QSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak2Q : nullptr, 0.7071f));
-    tonePeak2DynOn = (params != nullptr && params->tonePeak2DynEnable != nullptr) ? (params->tonePeak2DynEnable->load() >= 0.5f) : false;
-    tonePeak2DynRangeDbSm.reset (sampleRateHz, smoothSeconds);
-    tonePeak2DynRangeDbSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak2DynRangeDb : nullptr, 0.0f));
-    tonePeak2DynThresholdDbSm.reset (sampleRateHz, smoothSeconds);
-    tonePeak2DynThresholdDbSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak2DynThresholdDb : nullptr, -18.0f));
-
-    tonePeak3On = (params != nullptr && params->tonePeak3Enable != nullptr) ? (params->tonePeak3Enable->load() >= 0.5f) : true;
-    tonePeak3Type = (params != nullptr && params->tonePeak3Type != nullptr) ? (int) std::lround (params->tonePeak3Type->load()) : (int) params::tone::peakBell;
-    tonePeak3FreqHzSm.reset (sampleRateHz, smoothSeconds);
-    tonePeak3FreqHzSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak3FreqHz : nullptr, 4200.0f));
-    tonePeak3GainDbSm.reset (sampleRateHz, smoothSeconds);
-    tonePeak3GainDbSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak3GainDb : nullptr, 0.0f));
-    tonePeak3QSm.reset (sampleRateHz, smoothSeconds);
-    tonePeak3QSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak3Q : nullptr, 0.90f));
-    tonePeak3DynOn = (params != nullptr && params->tonePeak3DynEnable != nullptr) ? (params->tonePeak3DynEnable->load() >= 0.5f) : false;
-    tonePeak3DynRangeDbSm.reset (sampleRateHz, smoothSeconds);
-    tonePeak3DynRangeDbSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak3DynRangeDb : nullptr, 0.0f));
-    tonePeak3DynThresholdDbSm.reset (sampleRateHz, smoothSeconds);
-    tonePeak3DynThresholdDbSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak3DynThresholdDb : nullptr, -18.0f));
-
-    tonePeak4On = (params != nullptr && params->tonePeak4Enable != nullptr) ? (params->tonePeak4Enable->load() >= 0.5f) : false;
-    tonePeak4Type = (params != nullptr && params->tonePeak4Type != nullptr) ? (int) std::lround (params->tonePeak4Type->load()) : (int) params::tone::peakBell;
-    tonePeak4FreqHzSm.reset (sampleRateHz, smoothSeconds);
-    tonePeak4FreqHzSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak4FreqHz : nullptr, 700.0f));
-    tonePeak4GainDbSm.reset (sampleRateHz, smoothSeconds);
-    tonePeak4GainDbSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak4GainDb : nullptr, 0.0f));
-    tonePeak4QSm.reset (sampleRateHz, smoothSeconds);
-    tonePeak4QSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak4Q : nullptr, 0.90f));
-    tonePeak4DynOn = (params != nullptr && params->tonePeak4DynEnable != nullptr) ? (params->tonePeak4DynEnable->load() >= 0.5f) : false;
-    tonePeak4DynRangeDbSm.reset (sampleRateHz, smoothSeconds);
-    tonePeak4DynRangeDbSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak4DynRangeDb : nullptr, 0.0f));
-    tonePeak4DynThresholdDbSm.reset (sampleRateHz, smoothSeconds);
-    tonePeak4DynThresholdDbSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak4DynThresholdDb : nullptr, -18.0f));
-
-    tonePeak5On = (params != nullptr && params->tonePeak5Enable != nullptr) ? (params->tonePeak5Enable->load() >= 0.5f) : false;
-    tonePeak5Type = (params != nullptr && params->tonePeak5Type != nullptr) ? (int) std::lround (params->tonePeak5Type->load()) : (int) params::tone::peakBell;
-    tonePeak5FreqHzSm.reset (sampleRateHz, smoothSeconds);
-    tonePeak5FreqHzSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak5FreqHz : nullptr, 1800.0f));
-    tonePeak5GainDbSm.reset (sampleRateHz, smoothSeconds);
-    tonePeak5GainDbSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak5GainDb : nullptr, 0.0f));
-    tonePeak5QSm.reset (sampleRateHz, smoothSeconds);
-    tonePeak5QSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak5Q : nullptr, 0.90f));
-    tonePeak5DynOn = (params != nullptr && params->tonePeak5DynEnable != nullptr) ? (params->tonePeak5DynEnable->load() >= 0.5f) : false;
-    tonePeak5DynRangeDbSm.reset (sampleRateHz, smoothSeconds);
-    tonePeak5DynRangeDbSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak5DynRangeDb : nullptr, 0.0f));
-    tonePeak5DynThresholdDbSm.reset (sampleRateHz, smoothSeconds);
-    tonePeak5DynThresholdDbSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak5DynThresholdDb : nullptr, -18.0f));
-
-    tonePeak6On = (params != nullptr && params->tonePeak6Enable != nullptr) ? (params->tonePeak6Enable->load() >= 0.5f) : false;
-    tonePeak6Type = (params != nullptr && params->tonePeak6Type != nullptr) ? (int) std::lround (params->tonePeak6Type->load()) : (int) params::tone::peakBell;
-    tonePeak6FreqHzSm.reset (sampleRateHz, smoothSeconds);
-    tonePeak6FreqHzSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak6FreqHz : nullptr, 5200.0f));
-    tonePeak6GainDbSm.reset (sampleRateHz, smoothSeconds);
-    tonePeak6GainDbSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak6GainDb : nullptr, 0.0f));
-    tonePeak6QSm.reset (sampleRateHz, smoothSeconds);
-    tonePeak6QSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak6Q : nullptr, 0.90f));
-    tonePeak6DynOn = (params != nullptr && params->tonePeak6DynEnable != nullptr) ? (params->tonePeak6DynEnable->load() >= 0.5f) : false;
-    tonePeak6DynRangeDbSm.reset (sampleRateHz, smoothSeconds);
-    tonePeak6DynRangeDbSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak6DynRangeDb : nullptr, 0.0f));
-    tonePeak6DynThresholdDbSm.reset (sampleRateHz, smoothSeconds);
-    tonePeak6DynThresholdDbSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak6DynThresholdDb : nullptr, -18.0f));
-
-    tonePeak7On = (params != nullptr && params->tonePeak7Enable != nullptr) ? (params->tonePeak7Enable->load() >= 0.5f) : false;
-    tonePeak7Type = (params != nullptr && params->tonePeak7Type != nullptr) ? (int) std::lround (params->tonePeak7Type->load()) : (int) params::tone::peakBell;
-    tonePeak7FreqHzSm.reset (sampleRateHz, smoothSeconds);
-    tonePeak7FreqHzSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak7FreqHz : nullptr, 250.0f));
-    tonePeak7GainDbSm.reset (sampleRateHz, smoothSeconds);
-    tonePeak7GainDbSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak7GainDb : nullptr, 0.0f));
-    tonePeak7QSm.reset (sampleRateHz, smoothSeconds);
-    tonePeak7QSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak7Q : nullptr, 0.90f));
-    tonePeak7DynOn = (params != nullptr && params->tonePeak7DynEnable != nullptr) ? (params->tonePeak7DynEnable->load() >= 0.5f) : false;
-    tonePeak7DynRangeDbSm.reset (sampleRateHz, smoothSeconds);
-    tonePeak7DynRangeDbSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak7DynRangeDb : nullptr, 0.0f));
-    tonePeak7DynThresholdDbSm.reset (sampleRateHz, smoothSeconds);
-    tonePeak7DynThresholdDbSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak7DynThresholdDb : nullptr, -18.0f));
-
-    tonePeak8On = (params != nullptr && params->tonePeak8Enable != nullptr) ? (params->tonePeak8Enable->load() >= 0.5f) : false;
-    tonePeak8Type = (params != nullptr && params->tonePeak8Type != nullptr) ? (int) std::lround (params->tonePeak8Type->load()) : (int) params::tone::peakBell;
-    tonePeak8FreqHzSm.reset (sampleRateHz, smoothSeconds);
-    tonePeak8FreqHzSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak8FreqHz : nullptr, 9500.0f));
-    tonePeak8GainDbSm.reset (sampleRateHz, smoothSeconds);
-    tonePeak8GainDbSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak8GainDb : nullptr, 0.0f));
-    tonePeak8QSm.reset (sampleRateHz, smoothSeconds);
-    tonePeak8QSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak8Q : nullptr, 0.90f));
-    tonePeak8DynOn = (params != nullptr && params->tonePeak8DynEnable != nullptr) ? (params->tonePeak8DynEnable->load() >= 0.5f) : false;
-    tonePeak8DynRangeDbSm.reset (sampleRateHz, smoothSeconds);
-    tonePeak8DynRangeDbSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak8DynRangeDb : nullptr, 0.0f));
-    tonePeak8DynThresholdDbSm.reset (sampleRateHz, smoothSeconds);
-    tonePeak8DynThresholdDbSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak8DynThresholdDb : nullptr, -18.0f));
+    for (auto& peak : tonePeaks)
+    {
+        peak.freqHzSm.reset (sampleRateHz, smoothSeconds);
+        peak.gainDbSm.reset (sampleRateHz, smoothSeconds);
+        peak.qSm.reset (sampleRateHz, smoothSeconds);
+        peak.dynRangeDbSm.reset (sampleRateHz, smoothSeconds);
+        peak.dynThresholdDbSm.reset (sampleRateHz, smoothSeconds);
+    }
+    loadTonePeaks (true);
+
+    // Linear-phase Tone: the first kernel is designed here, later ones on the designer thread.
+    const auto toneOnNow = params != nullptr && params->toneEnable != nullptr && params->toneEnable->load() >= 0.5f;
+    blockControls.toneLinearPhase = params != nullptr && params->tonePhaseMode != nullptr
+                                    && (int) std::lround (params->tonePhaseMode->load()) == (int) params::tone::phaseLinear;
+    toneLinearPrev = blockControls.toneLinearPhase;
+    toneLinearDesigner.stop();
+    toneLinearDesigner.prepare (sampleRateHz, makeToneLinearSettings (! toneOnNow));
+    toneLinearConvolver.prepare (toneLinearDesigner.getKernelLength());
+    if (const auto* kernel = toneLinearDesigner.takeKernel())
+        toneLinearConvolver.setKernel (*kernel);
+
+    // Outside Linear mode the Tone input is read back with the same latency, so switching modes never changes the
+    // reported latency. The extra history lets a switch to Linear prime the convolver.
+    toneLinearAlign.prepare (toneLinearDesigner.getKernelLength() + 2 * dsp::PartitionedConvolver::blockSize, maxN);
+    toneLinearDesigner.setActive (blockControls.toneLinearPhase);
+    toneLinearDesigner.start();
+
+    fxRoutePrev = params != nullptr && params->fxGlobalRoute != nullptr
+                  ? (int) std::lround (params->fxGlobalRoute->load())
+                  : (int) params::fx::global::routeSerial;
 
     reset();
 }
@@ -314,17 +252,27 @@ void MonoSynthEngine::reset()
     noteGlide.setCurrentAndTarget (69.0f);
     ampEnv.reset();
     filterEnv.reset();
+    voicePool.reset();
 
     destroyBase.reset();
     destroyOs2.reset();
     destroyOs4.reset();
+    destroyOs8.reset();
     destroyOversampling2x.reset();
     destroyOversampling4x.reset();
-    destroyOversamplingFactorPrev = 1;
+    destroyOversampling8x.reset();
+    destroyOsFactor = 1;
+    destroyOsFadeRemaining = 0;
+    destroyOsStarted = false;
+    destroyOsAutoHold = 0;
     filter.reset();
     toneEq.reset();
+    toneLinearConvolver.reset();
+    toneLinearAlign.reset();
     shaper.reset();
     fxChain.reset();
+    fxParallelAlignL.reset();
+    fxParallelAlignR.reset();
     resetXtraState();
     toneCoeffCountdown = 0;
     toneEnabledPrev = false;
@@ -365,77 +313,11 @@ void MonoSynthEngine::reset()
     toneLowCutSlope = (params != nullptr && params->toneLowCutSlope != nullptr) ? (int) std::lround (params->toneLowCutSlope->load()) : (int) params::tone::slope24;
     toneHighCutSlope = (params != nullptr && params->toneHighCutSlope != nullptr) ? (int) std::lround (params->toneHighCutSlope->load()) : (int) params::tone::slope24;
 
-    tonePeak1On = (params != nullptr && params->tonePeak1Enable != nullptr) ? (params->tonePeak1Enable->load() >= 0.5f) : true;
-    tonePeak1Type = (params != nullptr && params->tonePeak1Type != nullptr) ? (int) std::lround (params->tonePeak1Type->load()) : (int) params::tone::peakBell;
-    tonePeak1FreqHzSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak1FreqHz : nullptr, 220.0f));
-    tonePeak1GainDbSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak1GainDb : nullptr, 0.0f));
-    tonePeak1QSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak1Q : nullptr, 0.90f));
-    tonePeak1DynOn = (params != nullptr && params->tonePeak1DynEnable != nullptr) ? (params->tonePeak1DynEnable->load() >= 0.5f) : false;
-    tonePeak1DynRangeDbSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak1DynRangeDb : nullptr, 0.0f));
-    tonePeak1DynThresholdDbSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak1DynThresholdDb : nullptr, -18.0f));
-
-    tonePeak2On = (params != nullptr && params->tonePeak2Enable != nullptr) ? (params->tonePeak2Enable->load() >= 0.5f) : true;
-    tonePeak2Type = (params != nullptr && params->tonePeak2Type != nullptr) ? (int) std::lround (params->tonePeak2Type->load()) : (int) params::tone::peakBell;
-    tonePeak2FreqHzSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak2FreqHz : nullptr, 1000.0f));
-    tonePeak2GainDbSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak2GainDb : nullptr, 0.0f));
-    tonePeak2QSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak2Q : nullptr, 0.7071f));
-    tonePeak2DynOn = (params != nullptr && params->tonePeak2DynEnable != nullptr) ? (params->tonePeak2DynEnable->load() >= 0.5f) : false;
-    tonePeak2DynRangeDbSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak2DynRangeDb : nullptr, 0.0f));
-    tonePeak2DynThresholdDbSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak2DynThresholdDb : nullptr, -18.0f));
-
-    tonePeak3On = (params != nullptr && params->tonePeak3Enable != nullptr) ? (params->tonePeak3Enable->load() >= 0.5f) : true;
-    tonePeak3Type = (params != nullptr && params->tonePeak3Type != nullptr) ? (int) std::lround (params->tonePeak3Type->load()) : (int) params::tone::peakBell;
-    tonePeak3FreqHzSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak3FreqHz : nullptr, 4200.0f));
-    tonePeak3GainDbSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak3GainDb : nullptr, 0.0f));
-    tonePeak3QSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak3Q : nullptr, 0.90f));
-    tonePeak3DynOn = (params != nullptr && params->tonePeak3DynEnable != nullptr) ? (params->tonePeak3DynEnable->load() >= 0.5f) : false;
-    tonePeak3DynRangeDbSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak3DynRangeDb : nullptr, 0.0f));
-    tonePeak3DynThresholdDbSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak3DynThresholdDb : nullptr, -18.0f));
-
-    tonePeak4On = (params != nullptr && params->tonePeak4Enable != nullptr) ? (params->tonePeak4Enable->load() >= 0.5f) : false;
-    tonePeak4Type = (params != nullptr && params->tonePeak4Type != nullptr) ? (int) std::lround (params->tonePeak4Type->load()) : (int) params::tone::peakBell;
-    tonePeak4FreqHzSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak4FreqHz : nullptr, 700.0f));
-    tonePeak4GainDbSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak4GainDb : nullptr, 0.0f));
-    tonePeak4QSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak4Q : nullptr, 0.90f));
-    tonePeak4DynOn = (params != nullptr && params->tonePeak4DynEnable != nullptr) ? (params->tonePeak4DynEnable->load() >= 0.5f) : false;
-    tonePeak4DynRangeDbSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak4DynRangeDb : nullptr, 0.0f));
-    tonePeak4DynThresholdDbSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak4DynThresholdDb : nullptr, -18.0f));
-
-    tonePeak5On = (params != nullptr && params->tonePeak5Enable != nullptr) ? (params->tonePeak5Enable->load() >= 0.5f) : false;
-    tonePeak5Type = (params != nullptr && params->tonePeak5Type != nullptr) ? (int) std::lround (params->tonePeak5Type->load()) : (int) params::tone::peakBell;
-    tonePeak5FreqHzSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak5FreqHz : nullptr, 1800.0f));
-    tonePeak5GainDbSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak5GainDb : nullptr, 0.0f));
-    tonePeak5QSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak5Q : nullptr, 0.90f));
-    tonePeak5DynOn = (params != nullptr && params->tonePeak5DynEnable != nullptr) ? (params->tonePeak5DynEnable->load() >= 0.5f) : false;
-    tonePeak5DynRangeDbSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak5DynRangeDb : nullptr, 0.0f));
-    tonePeak5DynThresholdDbSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak5DynThresholdDb : nullptr, -18.0f));
-
-    tonePeak6On = (params != nullptr && params->tonePeak6Enable != nullptr) ? (params->tonePeak6Enable->load() >= 0.5f) : false;
-    tonePeak6Type = (params != nullptr && params->tonePeak6Type != nullptr) ? (int) std::lround (params->tonePeak6Type->load()) : (int) params::tone::peakBell;
-    tonePeak6FreqHzSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak6FreqHz : nullptr, 5200.0f));
-    tonePeak6GainDbSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak6GainDb : nullptr, 0.0f));
-    tonePeak6QSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak6Q : nullptr, 0.90f));
-    tonePeak6DynOn = (params != nullptr && params->tonePeak6DynEnable != nullptr) ? (params->tonePeak6DynEnable->load() >= 0.5f) : false;
-    tonePeak6DynRangeDbSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak6DynRangeDb : nullptr, 0.0f));
-    tonePeak6DynThresholdDbSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak6DynThresholdDb : nullptr, -18.0f));
-
-    tonePeak7On = (params != nullptr && params->tonePeak7Enable != nullptr) ? (params->tonePeak7Enable->load() >= 0.5f) : false;
-    tonePeak7Type = (params != nullptr && params->tonePeak7Type != nullptr) ? (int) std::lround (params->tonePeak7Type->load()) : (int) params::tone::peakBell;
-    tonePeak7FreqHzSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak7FreqHz : nullptr, 250.0f));
-    tonePeak7GainDbSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak7GainDb : nullptr, 0.0f));
-    tonePeak7QSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak7Q : nullptr, 0.90f));
-    tonePeak7DynOn = (params != nullptr && params->tonePeak7DynEnable != nullptr) ? (params->tonePeak7DynEnable->load() >= 0.5f) : false;
-    tonePeak7DynRangeDbSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak7DynRangeDb : nullptr, 0.0f));
-    tonePeak7DynThresholdDbSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak7DynThresholdDb : nullptr, -18.0f));
-
-    tonePeak8On = (params != nullptr && params->tonePeak8Enable != nullptr) ? (params->tonePeak8Enable->load() >= 0.5f) : false;
-    tonePeak8Type = (params != nullptr && params->tonePeak8Type != nullptr) ? (int) std::lround (params->tonePeak8Type->load()) : (int) params::tone::peakBell;
-    tonePeak8FreqHzSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak8FreqHz : nullptr, 9500.0f));
-    tonePeak8GainDbSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak8GainDb : nullptr, 0.0f));
-    tonePeak8QSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak8Q : nullptr, 0.90f));
-    tonePeak8DynOn = (params != nullptr && params->tonePeak8DynEnable != nullptr) ? (params->tonePeak8DynEnable->load() >= 0.5f) : false;
-    tonePeak8DynRangeDbSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak8DynRangeDb : nullptr, 0.0f));
-    tonePeak8DynThresholdDbSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->tonePeak8DynThresholdDb : nullptr, -18.0f));
+    loadTonePeaks (true);
+
+    oscLevelSm[0].setCurrentAndTargetValue (loadParam (params != nullptr ? params->osc1Level : nullptr, 0.8f));
+    oscLevelSm[1].setCurrentAndTargetValue (loadParam (params != nullptr ? params->osc2Level : nullptr, 0.5f));
+    oscLevelSm[2].setCurrentAndTargetValue (loadParam (params != nullptr ? params->osc3Level : nullptr, 0.0f));
 
     noiseLevelSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->noiseLevel : nullptr, 0.0f));
     noiseColorSm.setCurrentAndTargetValue (loadParam (params != nullptr ? params->noiseColor : nullptr, 0.75f));
@@ -459,16 +341,20 @@ void MonoSynthEngine::reset()
     aftertouchSm.setCurrentAndTargetValue (0.0f);
     pitchBendSemisSm.setCurrentAndTargetValue (0.0f);
     modRngState = 0x52414e44u;
+    modCtrlValue.fill (0.0f);
+    modCtrlStep.fill (0.0f);
+    modCtrlCountdown = 0;
     randomNoteValue = 0.0f;
 
     // Keep drift running across notes, but reset to a neutral state on transport resets.
-    driftState1 = 0.0f;
-    driftState2 = 0.0f;
-    driftState3 = 0.0f;
+    drift.reset();
     pitchLockPhase = 0.0f;
     pitchLockFollower = 0.0f;
     pitchLockLowpass = 0.0f;
     pitchLockBrightness = 0.0f;
+    pitchLockWeightCountdown = 0;
+    pitchLockBrightnessSum = 0.0f;
+    pitchLockBrightnessCount = 0;
 
     if (params != nullptr)
     {
@@ -527,23 +413,10 @@ void MonoSynthEngine::updateFilterEnvParams()
     filterEnv.setParameters (filterEnvParams);
 }
 
-float MonoSynthEngine::computeDriftCents (juce::Random& rng, float& state, float alpha, float detuneAmount01) noexcept
-{
-    if (detuneAmount01 <= 0.0f)
-        return 0.0f;
-
-    const auto white = rng.nextFloat() * 2.0f - 1.0f;
-    state += alpha * (white - state);
-
-    constexpr float maxCents = 30.0f;
-    return state * (maxCents * detuneAmount01);
-}
-
 void MonoSynthEngine::resetXtraState()
 {
-    std::fill (xtraDelayL.begin(), xtraDelayL.end(), 0.0f);
-    std::fill (xtraDelayR.begin(), xtraDelayR.end(), 0.0f);
-    xtraDelayWrite = 0;
+    xtraDelayL.reset();
+    xtraDelayR.reset();
 
     xtraFlangerPhase = 0.0f;
     xtraTremoloPhase = 0.0f;
@@ -593,10 +466,12 @@ void MonoSynthEngine::processXtraBlock (float* left, float* right, int numSample
 
         if (enabled)
         {
-            if (! xtraDelayL.empty())
+            if (xtraDelayL.isPrepared())
             {
+                using Interp = dsp::DelayLine::Interpolation;
                 const float inMid = 0.5f * (wetL + wetR);
                 const float inSide = 0.5f * (wetL - wetR);
+                const float msToSamples = 0.001f * (float) sampleRateHz;
 
                 const float flangerRateHz = juce::jmap (flangerAmt, 0.08f, 0.85f);
                 const float flangerDepthMs = juce::jmap (flangerAmt, 0.0f, 5.5f);
@@ -605,29 +480,26 @@ void MonoSynthEngine::processXtraBlock (float* left, float* right, int numSample
 
                 xtraFlangerPhase += flangerRateHz / (float) sampleRateHz;
                 xtraFlangerPhase -= std::floor (xtraFlangerPhase);
-                const float flLfo = std::sin (juce::MathConstants<float>::twoPi * xtraFlangerPhase);
-                const float flDelaySamp = juce::jlimit (1.0f, (float) (xtraDelayL.size() - 3),
-                                                        (flangerBaseMs + flangerDepthMs * flLfo) * 0.001f * (float) sampleRateHz);
-                const float flReadL = readDelayLinear (xtraDelayL, xtraDelayWrite, flDelaySamp);
-                const float flReadR = readDelayLinear (xtraDelayR, xtraDelayWrite, flDelaySamp);
+                const float flLfo = ies::math::fastSin2Pi (xtraFlangerPhase);
+                const float flDelaySamp = (flangerBaseMs + flangerDepthMs * flLfo) * msToSamples;
+                const float flReadL = xtraDelayL.read<Interp::lagrange3> (flDelaySamp);
+                const float flReadR = xtraDelayR.read<Interp::lagrange3> (flDelaySamp);
 
                 const float doublerRateHz = juce::jmap (doublerAmt, 0.05f, 1.2f);
                 xtraDoublerPhase += doublerRateHz / (float) sampleRateHz;
                 xtraDoublerPhase -= std::floor (xtraDoublerPhase);
-                const float dph = juce::MathConstants<float>::twoPi * xtraDoublerPhase;
-                const float dSampL = (11.0f + 5.0f * std::sin (dph * 1.3f)) * 0.001f * (float) sampleRateHz;
-                const float dSampR = (16.0f + 6.0f * std::sin (dph * 0.9f + 1.1f)) * 0.001f * (float) sampleRateHz;
-                const float dbReadL = readDelayLinear (xtraDelayL, xtraDelayWrite, juce::jlimit (1.0f, (float) (xtraDelayL.size() - 3), dSampL));
-                const float dbReadR = readDelayLinear (xtraDelayR, xtraDelayWrite, juce::jlimit (1.0f, (float) (xtraDelayR.size() - 3), dSampR));
+                const float dSampL = (11.0f + 5.0f * ies::math::fastSin2Pi (xtraDoublerPhase * 1.3f)) * msToSamples;
+                const float dSampR = (16.0f + 6.0f * ies::math::fastSin2Pi (xtraDoublerPhase * 0.9f + 0.17507f)) * msToSamples;
+                const float dbReadL = xtraDelayL.read<Interp::lagrange3> (dSampL);
+                const float dbReadR = xtraDelayR.read<Interp::lagrange3> (dSampR);
 
                 wetL += flReadL * (0.45f * flangerAmt);
                 wetR += flReadR * (0.45f * flangerAmt);
                 wetL += (dbReadR - inSide) * (0.22f * doublerAmt);
                 wetR += (dbReadL + inSide) * (0.22f * doublerAmt);
 
-                xtraDelayL[(size_t) xtraDelayWrite] = inMid + inSide + flReadL * flangerFeedback;
-                xtraDelayR[(size_t) xtraDelayWrite] = inMid - inSide + flReadR * flangerFeedback;
-                xtraDelayWrite = (xtraDelayWrite + 1) % (int) xtraDelayL.size();
+                xtraDelayL.push (inMid + inSide + flReadL * flangerFeedback);
+                xtraDelayR.push (inMid - inSide + flReadR * flangerFeedback);
             }
 
             if (tremoloAmt > 1.0e-5f)
@@ -735,6 +607,264 @@ void MonoSynthEngine::processXtraBlock (float* left, float* right, int numSample
     }
 }
 
+int MonoSynthEngine::autoDestroyOsFactor (float bandwidthHz, int numSamples) noexcept
+{
+    constexpr float usableNyquist = 0.45f;
+    constexpr float stepDownHeadroom = 1.5f;
+    constexpr float holdMs = 250.0f;
+
+    auto factorFor = [this] (float bw) noexcept
+    {
+        int f = 1;
+        while (f < 8 && bw > usableNyquist * (float) sampleRateHz * (float) f)
+            f *= 2;
+        return f;
+    };
+
+    // Step up at once; step down only once the lower factor has had clear headroom for a while, so a vibrato or
+    // a drive wobbling around a threshold doesn't keep switching paths.
+    const auto wanted = factorFor (bandwidthHz * stepDownHeadroom);
+    if (wanted >= destroyOsFactor)
+    {
+        destroyOsAutoHold = msToSamples (sampleRateHz, holdMs);
+        return juce::jmax (destroyOsFactor, factorFor (bandwidthHz));
+    }
+
+    destroyOsAutoHold -= numSamples;
+    return destroyOsAutoHold > 0 ? destroyOsFactor : wanted;
+}
+
+void MonoSynthEngine::runDestroyPath (int factor, float* x, int numSamples, const dsp::DestroyChain::BlockInputs& in) noexcept
+{
+    if (factor == 1)
+    {
+        destroyBase.processBlockPreCrush (x, numSamples, 1, in);
+        return;
+    }
+
+    auto& os = (factor == 2) ? destroyOversampling2x : (factor == 4) ? destroyOversampling4x : destroyOversampling8x;
+    auto& dc = (factor == 2) ? destroyOs2 : (factor == 4) ? destroyOs4 : destroyOs8;
+
+    float* channels[] = { x };
+    juce::dsp::AudioBlock<float> baseBlock (channels, 1, (size_t) numSamples);
+    juce::dsp::AudioBlock<const float> constBase (baseBlock);
+
+    auto upBlock = os.processSamplesUp (constBase);
+    dc.processBlockPreCrush (upBlock.getChannelPointer (0), numSamples, factor, in);
+
+    os.processSamplesDown (baseBlock);
+}
+
+void MonoSynthEngine::updatePitchLockWeights (int mode, float noteHz) noexcept
+{
+    constexpr float lockGain = 0.50f;
+    constexpr int numHarmonics = dsp::HarmonicSeries::maxHarmonics;
+
+    // Brightness averaged over the last interval, so the fast follower doesn't alias into the weights.
+    const auto bright = pitchLockBrightnessCount > 0
+        ? juce::jlimit (0.0f, 1.0f, pitchLockBrightnessSum / (float) pitchLockBrightnessCount)
+        : juce::jlimit (0.0f, 1.0f, pitchLockBrightness);
+    pitchLockBrightnessSum = 0.0f;
+    pitchLockBrightnessCount = 0;
+
+    std::array<float, (size_t) numHarmonics> w {};
+    w[0] = 1.00f;
+    w[1] = 0.22f + 0.28f * bright;
+    w[2] = 0.12f + 0.26f * bright;
+    w[3] = 0.05f + 0.20f * bright;
+    w[4] = 0.02f + 0.12f * bright * bright;
+
+    // Upper harmonics only open up on bright input: steep roll-off when dull, ~1/k when bright.
+    const auto rollOff = 3.0f - 2.0f * bright;
+    for (int k = 5; k < numHarmonics; ++k)
+        w[(size_t) k] = w[4] * std::pow (5.0f / (float) (k + 1), rollOff);
+
+    // Fade harmonics out towards Nyquist.
+    const auto nyqSafe = juce::jmax (10.0f, (float) (0.48 * sampleRateHz));
+    float norm = 0.0f;
+    for (int k = 0; k < numHarmonics; ++k)
+    {
+        const auto rel = ((float) (k + 1) * noteHz) / nyqSafe;
+        if (k > 0)
+            w[(size_t) k] *= rel >= 1.0f ? 0.0f : juce::jlimit (0.0f, 1.0f, 1.0f - rel * rel);
+        norm += w[(size_t) k];
+    }
+
+    float harmonicBlend = 1.0f;
+    float modeGain = 1.0f;
+    switch ((params::destroy::PitchLockMode) mode)
+    {
+        case params::destroy::pitchModeFundamental:
+            harmonicBlend = 0.0f;
+            modeGain = 0.95f;
+            break;
+        case params::destroy::pitchModeHarmonic:
+            harmonicBlend = 1.0f;
+            modeGain = 1.00f;
+            break;
+        case params::destroy::pitchModeHybrid:
+        default:
+            harmonicBlend = juce::jlimit (0.0f, 1.0f, 0.35f + 0.55f * bright);
+            modeGain = 1.07f;
+            break;
+    }
+
+    // Fold the fundamental/harmonic blend and the output gain into the weights:
+    // lock = gain * ((1 - blend) * h1 + blend * sum (w_k h_k) / norm).
+    const auto gain = modeGain * lockGain * (0.75f + 0.35f * (1.0f - bright));
+    const auto harmonicScale = gain * harmonicBlend / juce::jmax (1.0e-4f, norm);
+    for (auto& wk : w)
+        wk *= harmonicScale;
+    w[0] += gain * (1.0f - harmonicBlend);
+
+    pitchLockHarmonics.setWeights (w.data(), harmonicBlend > 0.0f ? numHarmonics : 1);
+}
+
+void MonoSynthEngine::loadTonePeaks (bool snapToTarget) noexcept
+{
+    struct PeakSource
+    {
+        std::atomic<float>* enable;
+        std::atomic<float>* type;
+        std::atomic<float>* freqHz;
+        std::atomic<float>* gainDb;
+        std::atomic<float>* q;
+        std::atomic<float>* dynEnable;
+        std::atomic<float>* dynRangeDb;
+        std::atomic<float>* dynThresholdDb;
+        bool defaultOn;
+        float defaultFreqHz;
+        float defaultQ;
+    };
+
+    static const ParamPointers noParams;
+    const auto& p = params != nullptr ? *params : noParams;
+    const PeakSource sources[] =
+    {
+        { p.tonePeak1Enable, p.tonePeak1Type, p.tonePeak1FreqHz, p.tonePeak1GainDb, p.tonePeak1Q, p.tonePeak1DynEnable, p.tonePeak1DynRangeDb, p.tonePeak1DynThresholdDb, true,  220.0f,  0.90f },
+        { p.tonePeak2Enable, p.tonePeak2Type, p.tonePeak2FreqHz, p.tonePeak2GainDb, p.tonePeak2Q, p.tonePeak2DynEnable, p.tonePeak2DynRangeDb, p.tonePeak2DynThresholdDb, true,  1000.0f, 0.7071f },
+        { p.tonePeak3Enable, p.tonePeak3Type, p.tonePeak3FreqHz, p.tonePeak3GainDb, p.tonePeak3Q, p.tonePeak3DynEnable, p.tonePeak3DynRangeDb, p.tonePeak3DynThresholdDb, true,  4200.0f, 0.90f },
+        { p.tonePeak4Enable, p.tonePeak4Type, p.tonePeak4FreqHz, p.tonePeak4GainDb, p.tonePeak4Q, p.tonePeak4DynEnable, p.tonePeak4DynRangeDb, p.tonePeak4DynThresholdDb, false, 700.0f,  0.90f },
+        { p.tonePeak5Enable, p.tonePeak5Type, p.tonePeak5FreqHz, p.tonePeak5GainDb, p.tonePeak5Q, p.tonePeak5DynEnable, p.tonePeak5DynRangeDb, p.tonePeak5DynThresholdDb, false, 1800.0f, 0.90f },
+        { p.tonePeak6Enable, p.tonePeak6Type, p.tonePeak6FreqHz, p.tonePeak6GainDb, p.tonePeak6Q, p.tonePeak6DynEnable, p.tonePeak6DynRangeDb, p.tonePeak6DynThresholdDb, false, 5200.0f, 0.90f },
+        { p.tonePeak7Enable, p.tonePeak7Type, p.tonePeak7FreqHz, p.tonePeak7GainDb, p.tonePeak7Q, p.tonePeak7DynEnable, p.tonePeak7DynRangeDb, p.tonePeak7DynThresholdDb, false, 250.0f,  0.90f },
+        { p.tonePeak8Enable, p.tonePeak8Type, p.tonePeak8FreqHz, p.tonePeak8GainDb, p.tonePeak8Q, p.tonePeak8DynEnable, p.tonePeak8DynRangeDb, p.tonePeak8DynThresholdDb, false, 9500.0f, 0.90f },
+    };
+    static_assert (std::size (sources) == (size_t) params::tone::maxPeaks);
+
+    auto load = [] (std::atomic<float>* a, float def) noexcept { return a != nullptr ? a->load() : def; };
+    auto apply = [snapToTarget] (juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear>& sm, float v) noexcept
+    {
+        if (snapToTarget)
+            sm.setCurrentAndTargetValue (v);
+        else
+            setTargetIfChanged (sm, v);
+    };
+
+    for (size_t i = 0; i < tonePeaks.size(); ++i)
+    {
+        const auto& src = sources[i];
+        auto& peak = tonePeaks[i];
+        peak.on = load (src.enable, src.defaultOn ? 1.0f : 0.0f) >= 0.5f;
+        peak.type = (int) std::lround (load (src.type, (float) params::tone::peakBell));
+        peak.dynOn = load (src.dynEnable, 0.0f) >= 0.5f;
+        apply (peak.freqHzSm, load (src.freqHz, src.defaultFreqHz));
+        apply (peak.gainDbSm, load (src.gainDb, 0.0f));
+        apply (peak.qSm, load (src.q, src.defaultQ));
+        apply (peak.dynRangeDbSm, load (src.dynRangeDb, 0.0f));
+        apply (peak.dynThresholdDbSm, load (src.dynThresholdDb, -18.0f));
+    }
+}
+
+bool MonoSynthEngine::toneParamsSmoothing() const noexcept
+{
+    if (toneLowCutHzSm.isSmoothing() || toneHighCutHzSm.isSmoothing())
+        return true;
+
+    for (const auto& peak : tonePeaks)
+        if (peak.freqHzSm.isSmoothing() || peak.gainDbSm.isSmoothing() || peak.qSm.isSmoothing()
+            || peak.dynRangeDbSm.isSmoothing() || peak.dynThresholdDbSm.isSmoothing())
+            return true;
+
+    return false;
+}
+
+void MonoSynthEngine::skipToneSmoothers (int numSamples) noexcept
+{
+    toneLowCutHzSm.skip (numSamples);
+    toneHighCutHzSm.skip (numSamples);
+
+    for (auto& peak : tonePeaks)
+    {
+        peak.freqHzSm.skip (numSamples);
+        peak.gainDbSm.skip (numSamples);
+        peak.qSm.skip (numSamples);
+        peak.dynRangeDbSm.skip (numSamples);
+        peak.dynThresholdDbSm.skip (numSamples);
+    }
+}
+
+dsp::ToneEQ::BandParams MonoSynthEngine::tonePeakParams (size_t index) const noexcept
+{
+    const auto& peak = tonePeaks[index];
+    dsp::ToneEQ::BandParams b;
+    b.on = peak.on;
+    b.type = peak.type;
+    b.freqHz = peak.freqHzSm.getCurrentValue();
+    b.gainDb = peak.gainDbSm.getCurrentValue();
+    b.q = peak.qSm.getCurrentValue();
+    b.dynOn = peak.dynOn;
+    b.dynRangeDb = peak.dynRangeDbSm.getCurrentValue();
+    b.dynThresholdDb = peak.dynThresholdDbSm.getCurrentValue();
+    return b;
+}
+
+// Hands the current (smoothed) Tone settings to the EQ, which only rebuilds what actually changed.
+void MonoSynthEngine::pushToneParams() noexcept
+{
+    toneEq.setCuts (toneLowCutHzSm.getCurrentValue(), toneHighCutHzSm.getCurrentValue(), toneLowCutSlope, toneHighCutSlope);
+
+    for (size_t i = 0; i < tonePeaks.size(); ++i)
+        toneEq.setBand ((int) i, tonePeakParams (i));
+
+    toneEq.updateCoeffs();
+}
+
+// The same (smoothed) settings for the linear-phase designer. Dynamic bands contribute their static curve only.
+LinearPhaseEqDesigner::Settings MonoSynthEngine::makeToneLinearSettings (bool flat) const noexcept
+{
+    LinearPhaseEqDesigner::Settings s;
+    if (flat)
+        return s;
+
+    s.flat = false;
+    s.lowCutHz = toneLowCutHzSm.getCurrentValue();
+    s.highCutHz = toneHighCutHzSm.getCurrentValue();
+    s.lowCutSlope = toneLowCutSlope;
+    s.highCutSlope = toneHighCutSlope;
+    for (size_t i = 0; i < tonePeaks.size(); ++i)
+        s.bands[i] = tonePeakParams (i);
+
+    return s;
+}
+
+// Runs the Tone input history held by toneLinearAlign through a cleared convolver, oldest first, so a switch to
+// Linear carries on from the delayed signal instead of starting from silence. The output is discarded.
+void MonoSynthEngine::primeToneLinearConvolver() noexcept
+{
+    toneLinearConvolver.reset();
+
+    std::array<float, (size_t) dsp::PartitionedConvolver::blockSize> chunk {};
+    for (int age = toneLinearAlign.getMaxDelaySamples(); age > 0;)
+    {
+        const auto n = juce::jmin ((int) chunk.size(), age);
+        for (int i = 0; i < n; ++i)
+            chunk[(size_t) i] = toneLinearAlign.read<dsp::DelayLine::Interpolation::linear> ((float) (age - i));
+        toneLinearConvolver.process (chunk.data(), n);
+        age -= n;
+    }
+}
+
 void MonoSynthEngine::resetOscPhasesFromParams()
 {
     if (params == nullptr)
@@ -744,9 +874,13 @@ void MonoSynthEngine::resetOscPhasesFromParams()
     const auto p2 = params->osc2Phase != nullptr ? params->osc2Phase->load() : 0.0f;
     const auto p3 = params->osc3Phase != nullptr ? params->osc3Phase->load() : 0.0f;
 
-    osc1.setPhase (p1);
-    osc2.setPhase (p2);
-    osc3.setPhase (p3);
+    oscBank.setPhase (0, p1);
+    oscBank.setPhase (1, p2);
+    oscBank.setPhase (2, p3);
+
+    unison[0].resetPhases (p1, params->osc1UnisonSpread != nullptr ? params->osc1UnisonSpread->load() : 1.0f);
+    unison[1].resetPhases (p2, params->osc2UnisonSpread != nullptr ? params->osc2UnisonSpread->load() : 1.0f);
+    unison[2].resetPhases (p3, params->osc3UnisonSpread != nullptr ? params->osc3UnisonSpread->load() : 1.0f);
 }
 
 void MonoSynthEngine::resetLfoPhasesFromParams()
@@ -816,10 +950,22 @@ void MonoSynthEngine::noteOn (int midiNote, int velocity0to127)
 
     // Glide is applied whenever the note changes while the gate is already on.
     applyNoteChange (newCurrent, gateWasOn);
+
+    if (blockControls.polyMode)
+    {
+        if (params != nullptr)
+            voicePool.setStartPhases (params->osc1Phase != nullptr ? params->osc1Phase->load() : 0.0f,
+                                      params->osc2Phase != nullptr ? params->osc2Phase->load() : 0.0f,
+                                      params->osc3Phase != nullptr ? params->osc3Phase->load() : 0.0f);
+        voicePool.noteOn (midiNote, velocity0to127);
+    }
 }
 
 void MonoSynthEngine::noteOff (int midiNote)
 {
+    if (blockControls.polyMode)
+        voicePool.noteOff (midiNote);
+
     noteStack.noteOff (midiNote);
 
     if (noteStack.empty())
@@ -838,6 +984,7 @@ void MonoSynthEngine::noteOff (int midiNote)
 
 void MonoSynthEngine::allNotesOff()
 {
+    voicePool.allNotesOff();
     noteStack.clear();
     gateOn = false;
     ampEnv.noteOff();
@@ -868,30 +1015,106 @@ void MonoSynthEngine::setPitchBend (int value0to16383) noexcept
     pitchBendSemisSm.setTargetValue (juce::jlimit (-rangeSemis, rangeSemis, norm * rangeSemis));
 }
 
-void MonoSynthEngine::render (juce::AudioBuffer<float>& buffer, int startSample, int numSamples, float* preDestroyOut)
+void MonoSynthEngine::rebuildModRoutes() noexcept
 {
-    if (numSamples <= 0)
-        return;
+    // Slot depths are in [-1..1]. Dest scaling is per-destination and folded into the route scale.
+    constexpr float cutoffMaxSemis = 48.0f;
+    constexpr float shaperDriveSpanDb = 18.0f;
 
-    if (params == nullptr)
+    auto& bc = blockControls;
+    bc.numFastRoutes = 0;
+    bc.numSlowRoutes = 0;
+    bc.numFastDests = 0;
+    bc.numSlowDests = 0;
+
+    auto addDest = [] (auto& dests, int& numDests, int dst) noexcept
     {
-        buffer.clear (startSample, numSamples);
-        return;
+        for (int d = 0; d < numDests; ++d)
+            if (dests[(size_t) d] == dst)
+                return;
+        dests[(size_t) numDests++] = dst;
+    };
+
+    std::array<bool, (size_t) numModDests> slowDest {};
+    for (const auto& slot : bc.slots)
+    {
+        if (std::abs (slot.depth) < 1.0e-6f || slot.src == (int) params::mod::srcOff || slot.dst == (int) params::mod::dstOff)
+            continue;
+
+        float span = 1.0f;
+        if (slot.dst == (int) params::mod::dstFilterCutoff)
+            span = cutoffMaxSemis;
+        else if (slot.dst == (int) params::mod::dstShaperDrive)
+            span = shaperDriveSpanDb;
+
+        const bool audioRateDest = slot.dst == (int) params::mod::dstOsc1Level
+                                || slot.dst == (int) params::mod::dstOsc2Level
+                                || slot.dst == (int) params::mod::dstOsc3Level
+                                || slot.dst == (int) params::mod::dstFilterCutoff
+                                || slot.dst == (int) params::mod::dstFilterResonance;
+        const bool fast = bc.modInterval <= 1 || (bc.modAudioRateFast && audioRateDest);
+
+        auto& route = fast ? bc.fastRoutes[(size_t) bc.numFastRoutes++]
+                           : bc.slowRoutes[(size_t) bc.numSlowRoutes++];
+        route.src = slot.src;
+        route.dst = slot.dst;
+        route.scale = slot.depth * span;
+
+        if (fast)
+        {
+            addDest (bc.fastDests, bc.numFastDests, slot.dst);
+        }
+        else
+        {
+            addDest (bc.slowDests, bc.numSlowDests, slot.dst);
+            slowDest[(size_t) slot.dst] = true;
+        }
     }
 
+    // Interpolators of destinations that left the slow set restart from zero if they come back.
+    for (int d = 0; d < numModDests; ++d)
+    {
+        if (! slowDest[(size_t) d])
+        {
+            modCtrlValue[(size_t) d] = 0.0f;
+            modCtrlStep[(size_t) d] = 0.0f;
+        }
+    }
+
+    modRoutesValid = true;
+}
+
+void MonoSynthEngine::beginBlock()
+{
+    blockControlsReady = true;
+
+    if (params == nullptr)
+        return;
+
+    auto& bc = blockControls;
+
     updateAmpEnvParams();
     updateFilterEnvParams();
 
-    auto setTargetIfChanged = [](auto& sm, float v) noexcept
     {
-        if (std::abs (v - sm.getTargetValue()) > 1.0e-6f)
-            sm.setTargetValue (v);
-    };
+        const auto polyNow = params->voiceMode != nullptr
+                          && (int) std::lround (params->voiceMode->load()) == (int) params::mono::voicePoly;
+        if (polyNow != bc.polyMode)
+            voicePool.reset();
+
+        bc.polyMode = polyNow;
+        bc.polyVoices = params->polyVoices != nullptr ? (int) std::lround (params->polyVoices->load()) : VoicePool::maxVoices;
+        if (bc.polyMode)
+        {
+            voicePool.setNumVoices (bc.polyVoices);
+            voicePool.setEnvelopeParameters (ampEnvParams, filterEnvParams);
+        }
+    }
 
     const auto outDb = params->outGainDb != nullptr ? params->outGainDb->load() : 0.0f;
     setTargetIfChanged (outGain, juce::Decibels::decibelsToGain (outDb, -100.0f));
 
-    // Smooth automation-heavy params once per render segment.
+    // Smooth automation-heavy params once per host block.
     setTargetIfChanged (foldDriveDbSm, params->foldDriveDb != nullptr ? params->foldDriveDb->load() : 0.0f);
     setTargetIfChanged (foldAmountSm,  params->foldAmount  != nullptr ? params->foldAmount->load()  : 0.0f);
     setTargetIfChanged (foldMixSm,     params->foldMix     != nullptr ? params->foldMix->load()     : 1.0f);
@@ -910,6 +1133,38 @@ void MonoSynthEngine::render (juce::AudioBuffer<float>& buffer, int startSample,
     setTargetIfChanged (shaperDriveDbSm, params->shaperDriveDb != nullptr ? params->shaperDriveDb->load() : 0.0f);
     setTargetIfChanged (shaperMixSm, params->shaperMix != nullptr ? params->shaperMix->load() : 1.0f);
 
+    // Oscillators: everything the per-sample loop needs, so no atomics are touched inside it.
+    {
+        const std::array<std::atomic<float>*, 3> waves   { params->osc1Wave,   params->osc2Wave,   params->osc3Wave };
+        const std::array<std::atomic<float>*, 3> levels  { params->osc1Level,  params->osc2Level,  params->osc3Level };
+        const std::array<std::atomic<float>*, 3> coarses { params->osc1Coarse, params->osc2Coarse, params->osc3Coarse };
+        const std::array<std::atomic<float>*, 3> fines   { params->osc1Fine,   params->osc2Fine,   params->osc3Fine };
+        const std::array<std::atomic<float>*, 3> detunes { params->osc1Detune, params->osc2Detune, params->osc3Detune };
+        const std::array<std::atomic<float>*, 3> uniVoices  { params->osc1Unison,       params->osc2Unison,       params->osc3Unison };
+        const std::array<std::atomic<float>*, 3> uniDetunes { params->osc1UnisonDetune, params->osc2UnisonDetune, params->osc3UnisonDetune };
+        const std::array<std::atomic<float>*, 3> uniBlends  { params->osc1UnisonBlend,  params->osc2UnisonBlend,  params->osc3UnisonBlend };
+        constexpr std::array<float, 3> defaultLevels { 0.8f, 0.5f, 0.0f };
+
+        for (size_t k = 0; k < 3; ++k)
+        {
+            auto& o = bc.osc[k];
+            o.wave = waves[k] != nullptr ? (int) std::lround (waves[k]->load()) : (int) params::osc::saw;
+            o.level = levels[k] != nullptr ? levels[k]->load() : defaultLevels[k];
+            o.coarse = coarses[k] != nullptr ? (int) std::lround (coarses[k]->load()) : 0;
+            o.fine = fines[k] != nullptr ? fines[k]->load() : 0.0f;
+            o.detune01 = juce::jlimit (0.0f, 1.0f, detunes[k] != nullptr ? detunes[k]->load() : 0.0f);
+            o.unisonVoices = juce::jlimit (1, dsp::UnisonOscillator::maxVoices, uniVoices[k] != nullptr ? (int) std::lround (uniVoices[k]->load()) : 1);
+            o.unisonDetune = uniDetunes[k] != nullptr ? uniDetunes[k]->load() : 0.25f;
+            o.unisonBlend = uniBlends[k] != nullptr ? uniBlends[k]->load() : 0.75f;
+            setTargetIfChanged (oscLevelSm[k], o.level);
+        }
+
+        bc.osc2Sync = params->osc2Sync != nullptr && (params->osc2Sync->load() >= 0.5f);
+        bc.wtCubic = params->wtInterp != nullptr
+                  && (int) std::lround (params->wtInterp->load()) == (int) params::mono::wtCubic;
+        bc.osc2Phase = params->osc2Phase != nullptr ? params->osc2Phase->load() : 0.0f;
+    }
+
     setTargetIfChanged (noiseLevelSm, params->noiseLevel != nullptr ? params->noiseLevel->load() : 0.0f);
     setTargetIfChanged (noiseColorSm, params->noiseColor != nullptr ? params->noiseColor->load() : 0.75f);
 
@@ -934,171 +1189,84 @@ void MonoSynthEngine::render (juce::AudioBuffer<float>& buffer, int startSample,
     toneLowCutSlope = params->toneLowCutSlope != nullptr ? (int) std::lround (params->toneLowCutSlope->load()) : (int) params::tone::slope24;
     toneHighCutSlope = params->toneHighCutSlope != nullptr ? (int) std::lround (params->toneHighCutSlope->load()) : (int) params::tone::slope24;
 
-    tonePeak1On = params->tonePeak1Enable != nullptr ? (params->tonePeak1Enable->load() >= 0.5f) : true;
-    tonePeak1Type = params->tonePeak1Type != nullptr ? (int) std::lround (params->tonePeak1Type->load()) : (int) params::tone::peakBell;
-    tonePeak1DynOn = params->tonePeak1DynEnable != nullptr ? (params->tonePeak1DynEnable->load() >= 0.5f) : false;
-    setTargetIfChanged (tonePeak1FreqHzSm, params->tonePeak1FreqHz != nullptr ? params->tonePeak1FreqHz->load() : 220.0f);
-    setTargetIfChanged (tonePeak1GainDbSm, params->tonePeak1GainDb != nullptr ? params->tonePeak1GainDb->load() : 0.0f);
-    setTargetIfChanged (tonePeak1QSm,      params->tonePeak1Q      != nullptr ? params->tonePeak1Q->load()      : 0.90f);
-    setTargetIfChanged (tonePeak1DynRangeDbSm, params->tonePeak1DynRangeDb != nullptr ? params->tonePeak1DynRangeDb->load() : 0.0f);
-    setTargetIfChanged (tonePeak1DynThresholdDbSm, params->tonePeak1DynThresholdDb != nullptr ? params->tonePeak1DynThresholdDb->load() : -18.0f);
-
-    tonePeak2On = params->tonePeak2Enable != nullptr ? (params->tonePeak2Enable->load() >= 0.5f) : true;
-    tonePeak2Type = params->tonePeak2Type != nullptr ? (int) std::lround (params->tonePeak2Type->load()) : (int) params::tone::peakBell;
-    tonePeak2DynOn = params->tonePeak2DynEnable != nullptr ? (params->tonePeak2DynEnable->load() >= 0.5f) : false;
-    setTargetIfChanged (tonePeak2FreqHzSm, params->tonePeak2FreqHz != nullptr ? params->tonePeak2FreqHz->load() : 1000.0f);
-    setTargetIfChanged (tonePeak2GainDbSm, params->tonePeak2GainDb != nullptr ? params->tonePeak2GainDb->load() : 0.0f);
-    setTargetIfChanged (tonePeak2QSm,      params->tonePeak2Q      != nullptr ? params->tonePeak2Q->load()      : 0.7071f);
-    setTargetIfChanged (tonePeak2DynRangeDbSm, params->tonePeak2DynRangeDb != nullptr ? params->tonePeak2DynRangeDb->load() : 0.0f);
-    setTargetIfChanged (tonePeak2DynThresholdDbSm, params->tonePeak2DynThresholdDb != nullptr ? params->tonePeak2DynThresholdDb->load() : -18.0f);
-
-    tonePeak3On = params->tonePeak3Enable != nullptr ? (params->tonePeak3Enable->load() >= 0.5f) : true;
-    tonePeak3Type = params->tonePeak3Type != nullptr ? (int) std::lround (params->tonePeak3Type->load()) : (int) params::tone::peakBell;
-    tonePeak3DynOn = params->tonePeak3DynEnable != nullptr ? (params->tonePeak3DynEnable->load() >= 0.5f) : false;
-    setTargetIfChanged (tonePeak3FreqHzSm, params->tonePeak3FreqHz != nullptr ? params->tonePeak3FreqHz->load() : 4200.0f);
-    setTargetIfChanged (tonePeak3GainDbSm, params->tonePeak3GainDb != nullptr ? params->tonePeak3GainDb->load() : 0.0f);
-    setTargetIfChanged (tonePeak3QSm,      params->tonePeak3Q      != nullptr ? params->tonePeak3Q->load()      : 0.90f);
-    setTargetIfChanged (tonePeak3DynRangeDbSm, params->tonePeak3DynRangeDb != nullptr ? params->tonePeak3DynRangeDb->load() : 0.0f);
-    setTargetIfChanged (tonePeak3DynThresholdDbSm, params->tonePeak3DynThresholdDb != nullptr ? params->tonePeak3DynThresholdDb->load() : -18.0f);
-
-    tonePeak4On = params->tonePeak4Enable != nullptr ? (params->tonePeak4Enable->load() >= 0.5f) : false;
-    tonePeak4Type = params->tonePeak4Type != nullptr ? (int) std::lround (params->tonePeak4Type->load()) : (int) params::tone::peakBell;
-    tonePeak4DynOn = params->tonePeak4DynEnable != nullptr ? (params->tonePeak4DynEnable->load() >= 0.5f) : false;
-    setTargetIfChanged (tonePeak4FreqHzSm, params->tonePeak4FreqHz != nullptr ? params->tonePeak4FreqHz->load() : 700.0f);
-    setTargetIfChanged (tonePeak4GainDbSm, params->tonePeak4GainDb != nullptr ? params->tonePeak4GainDb->load() : 0.0f);
-    setTargetIfChanged (tonePeak4QSm,      params->tonePeak4Q      != nullptr ? params->tonePeak4Q->load()      : 0.90f);
-    setTargetIfChanged (tonePeak4DynRangeDbSm, params->tonePeak4DynRangeDb != nullptr ? params->tonePeak4DynRangeDb->load() : 0.0f);
-    setTargetIfChanged (tonePeak4DynThresholdDbSm, params->tonePeak4DynThresholdDb != nullptr ? params->tonePeak4DynThresholdDb->load() : -18.0f);
-
-    tonePeak5On = params->tonePeak5Enable != nullptr ? (params->tonePeak5Enable->load() >= 0.5f) : false;
-    tonePeak5Type = params->tonePeak5Type != nullptr ? (int) std::lround (params->tonePeak5Type->load()) : (int) params::tone::peakBell;
-    tonePeak5DynOn = params->tonePeak5DynEnable != nullptr ? (params->tonePeak5DynEnable->load() >= 0.5f) : false;
-    setTargetIfChanged (tonePeak5FreqHzSm, params->tonePeak5FreqHz != nullptr ? params->tonePeak5FreqHz->load() : 1800.0f);
-    setTargetIfChanged (tonePeak5GainDbSm, params->tonePeak5GainDb != nullptr ? params->tonePeak5GainDb->load() : 0.0f);
-    setTargetIfChanged (tonePeak5QSm,      params->tonePeak5Q      != nullptr ? params->tonePeak5Q->load()      : 0.90f);
-    setTargetIfChanged (tonePeak5DynRangeDbSm, params->tonePeak5DynRangeDb != nullptr ? params->tonePeak5DynRangeDb->load() : 0.0f);
-    setTargetIfChanged (tonePeak5DynThresholdDbSm, params->tonePeak5DynThresholdDb != nullptr ? params->tonePeak5DynThresholdDb->load() : -18.0f);
-
-    tonePeak6On = params->tonePeak6Enable != nullptr ? (params->tonePeak6Enable->load() >= 0.5f) : false;
-    tonePeak6Type = params->tonePeak6Type != nullptr ? (int) std::lround (params->tonePeak6Type->load()) : (int) params::tone::peakBell;
-    tonePeak6DynOn = params->tonePeak6DynEnable != nullptr ? (params->tonePeak6DynEnable->load() >= 0.5f) : false;
-    setTargetIfChanged (tonePeak6FreqHzSm, params->tonePeak6FreqHz != nullptr ? params->tonePeak6FreqHz->load() : 5200.0f);
-    setTargetIfChanged (tonePeak6GainDbSm, params->tonePeak6GainDb != nullptr ? params->tonePeak6GainDb->load() : 0.0f);
-    setTargetIfChanged (tonePeak6QSm,      params->tonePeak6Q      != nullptr ? params->tonePeak6Q->load()      : 0.90f);
-    setTargetIfChanged (tonePeak6DynRangeDbSm, params->tonePeak6DynRangeDb != nullptr ? params->tonePeak6DynRangeDb->load() : 0.0f);
-    setTargetIfChanged (tonePeak6DynThresholdDbSm, params->tonePeak6DynThresholdDb != nullptr ? params->tonePeak6DynThresholdDb->load() : -18.0f);
-
-    tonePeak7On = params->tonePeak7Enable != nullptr ? (params->tonePeak7Enable->load() >= 0.5f) : false;
-    tonePeak7Type = params->tonePeak7Type != nullptr ? (int) std::lround (params->tonePeak7Type->load()) : (int) params::tone::peakBell;
-    tonePeak7DynOn = params->tonePeak7DynEnable != nullptr ? (params->tonePeak7DynEnable->load() >= 0.5f) : false;
-    setTargetIfChanged (tonePeak7FreqHzSm, params->tonePeak7FreqHz != nullptr ? params->tonePeak7FreqHz->load() : 250.0f);
-    setTargetIfChanged (tonePeak7GainDbSm, params->tonePeak7GainDb != nullptr ? params->tonePeak7GainDb->load() : 0.0f);
-    setTargetIfChanged (tonePeak7QSm,      params->tonePeak7Q      != nullptr ? params->tonePeak7Q->load()      : 0.90f);
-    setTargetIfChanged (tonePeak7DynRangeDbSm, params->tonePeak7DynRangeDb != nullptr ? params->tonePeak7DynRangeDb->load() : 0.0f);
-    setTargetIfChanged (tonePeak7DynThresholdDbSm, params->tonePeak7DynThresholdDb != nullptr ? params->tonePeak7DynThresholdDb->load() : -18.0f);
-
-    tonePeak8On = params->tonePeak8Enable != nullptr ? (params->tonePeak8Enable->load() >= 0.5f) : false;
-    tonePeak8Type = params->tonePeak8Type != nullptr ? (int) std::lround (params->tonePeak8Type->load()) : (int) params::tone::peakBell;
-    tonePeak8DynOn = params->tonePeak8DynEnable != nullptr ? (params->tonePeak8DynEnable->load() >= 0.5f) : false;
-    setTargetIfChanged (tonePeak8FreqHzSm, params->tonePeak8FreqHz != nullptr ? params->tonePeak8FreqHz->load() : 9500.0f);
-    setTargetIfChanged (tonePeak8GainDbSm, params->tonePeak8GainDb != nullptr ? params->tonePeak8GainDb->load() : 0.0f);
-    setTargetIfChanged (tonePeak8QSm,      params->tonePeak8Q      != nullptr ? params->tonePeak8Q->load()      : 0.90f);
-    setTargetIfChanged (tonePeak8DynRangeDbSm, params->tonePeak8DynRangeDb != nullptr ? params->tonePeak8DynRangeDb->load() : 0.0f);
-    setTargetIfChanged (tonePeak8DynThresholdDbSm, params->tonePeak8DynThresholdDb != nullptr ? params->tonePeak8DynThresholdDb->load() : -18.0f);
-
-    // Drift cutoff ~ 1 Hz (very slow).
-    const auto alpha = (float) (2.0 * juce::MathConstants<double>::pi * 1.0 / sampleRateHz);
-
-    const auto chs = buffer.getNumChannels();
+    loadTonePeaks (false);
 
-    const auto modMode     = params->modMode != nullptr ? (int) std::lround (params->modMode->load()) : (int) params::destroy::ringMod;
-    const auto modNoteSync = params->modNoteSync != nullptr && (params->modNoteSync->load() >= 0.5f);
+    bc.modMode     = params->modMode != nullptr ? (int) std::lround (params->modMode->load()) : (int) params::destroy::ringMod;
+    bc.modNoteSync = params->modNoteSync != nullptr && (params->modNoteSync->load() >= 0.5f);
 
-    const auto crushBits       = params->crushBits       != nullptr ? (int) std::lround (params->crushBits->load())       : 16;
-    const auto crushDownsample = params->crushDownsample != nullptr ? (int) std::lround (params->crushDownsample->load()) : 1;
-    const auto pitchLockEnabled = params->destroyPitchLockEnable != nullptr && (params->destroyPitchLockEnable->load() >= 0.5f);
-    const auto pitchLockMode = params->destroyPitchLockMode != nullptr
+    auto loadAntiAlias = [] (std::atomic<float>* p) noexcept
+    {
+        return p != nullptr ? juce::jlimit ((int) params::destroy::aaOff, (int) params::destroy::aaSecondOrder, (int) std::lround (p->load()))
+                            : (int) params::destroy::aaOff;
+    };
+    bc.foldAntiAlias = loadAntiAlias (params->foldAntiAlias);
+    bc.clipAntiAlias = loadAntiAlias (params->clipAntiAlias);
+    bc.shaperAntiAlias = loadAntiAlias (params->shaperAntiAlias);
+
+    bc.crushBits       = params->crushBits       != nullptr ? (int) std::lround (params->crushBits->load())       : 16;
+    bc.crushDownsample = params->crushDownsample != nullptr ? (int) std::lround (params->crushDownsample->load()) : 1;
+    bc.pitchLockEnabled = params->destroyPitchLockEnable != nullptr && (params->destroyPitchLockEnable->load() >= 0.5f);
+    bc.pitchLockMode = params->destroyPitchLockMode != nullptr
         ? juce::jlimit ((int) params::destroy::pitchModeFundamental,
                         (int) params::destroy::pitchModeHybrid,
                         (int) std::lround (params->destroyPitchLockMode->load()))
         : (int) params::destroy::pitchModeHybrid;
 
-    const auto shaperEnabled = params->shaperEnable != nullptr && (params->shaperEnable->load() >= 0.5f);
+    bc.shaperEnabled = params->shaperEnable != nullptr && (params->shaperEnable->load() >= 0.5f);
     const auto shaperPlacement = params->shaperPlacement != nullptr
         ? (int) std::lround (params->shaperPlacement->load())
         : (int) params::shaper::preDestroy;
-    const auto shaperPre = (shaperPlacement == (int) params::shaper::preDestroy);
+    bc.shaperPre = (shaperPlacement == (int) params::shaper::preDestroy);
     const auto destroyPlacement = params->fxGlobalDestroyPlacement != nullptr
         ? (int) std::lround (params->fxGlobalDestroyPlacement->load())
         : (int) params::fx::global::preFilter;
-    const auto destroyPostFilter = (destroyPlacement == (int) params::fx::global::postFilter);
+    bc.destroyPostFilter = (destroyPlacement == (int) params::fx::global::postFilter);
     const auto tonePlacement = params->fxGlobalTonePlacement != nullptr
         ? (int) std::lround (params->fxGlobalTonePlacement->load())
         : (int) params::fx::global::postFilter;
-    const auto tonePreFilter = (tonePlacement == (int) params::fx::global::preFilter);
+    bc.tonePreFilter = (tonePlacement == (int) params::fx::global::preFilter);
 
     const auto typeIdx  = params->filterType != nullptr ? (int) std::lround (params->filterType->load()) : (int) params::filter::lp;
-    const auto keyTrack = params->filterKeyTrack != nullptr && (params->filterKeyTrack->load() >= 0.5f);
-    filter.setType ((params::filter::Type) juce::jlimit (0, 1, typeIdx));
+    bc.keyTrack = params->filterKeyTrack != nullptr && (params->filterKeyTrack->load() >= 0.5f);
+    bc.filterType = juce::jlimit (0, 1, typeIdx);
+    filter.setType ((params::filter::Type) bc.filterType);
 
-    const auto toneOn = params->toneEnable != nullptr && (params->toneEnable->load() >= 0.5f);
-    toneEq.setEnabled (toneOn);
-    if (toneOn && ! toneEnabledPrev)
+    bc.toneOn = params->toneEnable != nullptr && (params->toneEnable->load() >= 0.5f);
+    toneEq.setEnabled (bc.toneOn);
+    if (bc.toneOn && ! toneEnabledPrev)
     {
         toneEq.reset();
         toneCoeffCountdown = 0;
     }
-    toneEnabledPrev = toneOn;
+    toneEnabledPrev = bc.toneOn;
+
+    bc.toneLinearPhase = params->tonePhaseMode != nullptr
+                         && (int) std::lround (params->tonePhaseMode->load()) == (int) params::tone::phaseLinear;
+    if (bc.toneLinearPhase != toneLinearPrev)
+    {
+        // Each path starts from silence rather than from state left over from the last time it ran.
+        if (bc.toneLinearPhase)
+            primeToneLinearConvolver();
+        else
+            toneEq.reset();
+        toneCoeffCountdown = 0;
+
+        // The designer only polls for requests while the linear-phase path runs.
+        toneLinearDesigner.setActive (bc.toneLinearPhase);
+    }
+    toneLinearPrev = bc.toneLinearPhase;
 
     // Oversampling selection (Destroy only).
     const auto osChoice = params->destroyOversample != nullptr
         ? (int) std::lround (params->destroyOversample->load())
         : (int) params::destroy::osOff;
-    const auto osChoiceClamped = juce::jlimit ((int) params::destroy::osOff, (int) params::destroy::os4x, osChoice);
-    const int osFactor = (osChoiceClamped == (int) params::destroy::os2x) ? 2
+    const auto osChoiceClamped = juce::jlimit ((int) params::destroy::osOff, (int) params::destroy::osAuto, osChoice);
+    bc.destroyOsAuto = osChoiceClamped == (int) params::destroy::osAuto;
+    bc.destroyOsFactor = (osChoiceClamped == (int) params::destroy::os2x) ? 2
                        : (osChoiceClamped == (int) params::destroy::os4x) ? 4
                        : 1;
 
-    if (osFactor != destroyOversamplingFactorPrev)
-    {
-        // Avoid nasty transients when switching oversampling during playback.
-        destroyOversampling2x.reset();
-        destroyOversampling4x.reset();
-        destroyOs2.reset();
-        destroyOs4.reset();
-        destroyOversamplingFactorPrev = osFactor;
-    }
-
-    // Defensive: should never happen if prepare() used the host's max block size.
-    if (destroyBuffer.getNumSamples() < numSamples
-        || (int) destroyNoteHz.size() < numSamples
-        || (int) destroyFoldDriveDb.size() < numSamples
-        || (int) destroyFoldAmount.size() < numSamples
-        || (int) destroyFoldMix.size() < numSamples
-        || (int) destroyClipDriveDb.size() < numSamples
-        || (int) destroyClipAmount.size() < numSamples
-        || (int) destroyClipMix.size() < numSamples
-        || (int) destroyModAmount.size() < numSamples
-        || (int) destroyModMix.size() < numSamples
-        || (int) destroyModFreqHz.size() < numSamples
-        || (int) destroyCrushMix.size() < numSamples
-        || (int) shaperDriveDb.size() < numSamples
-        || (int) shaperMix.size() < numSamples
-        || (int) filterModCutoffSemis.size() < numSamples
-        || (int) filterModResAdd.size() < numSamples
-        || (int) fxDryL.size() < numSamples
-        || (int) fxDryR.size() < numSamples
-        || (int) fxParallelL.size() < numSamples
-        || (int) fxParallelR.size() < numSamples)
-    {
-        buffer.clear (startSample, numSamples);
-        return;
-    }
-
-    auto* sigBuf = destroyBuffer.getWritePointer (0);
-
     // Pull shaper curve points once per block and update LUT only if something changed.
-    if (params != nullptr)
     {
         std::array<float, (size_t) params::shaper::numPoints> points = shaperPointsCache;
         bool changed = false;
@@ -1119,9 +1287,10 @@ void MonoSynthEngine::render (juce::AudioBuffer<float>& buffer, int startSample,
         }
     }
 
-    // --- Modulation setup (per render segment) ---
-    const auto macro1 = params->macro1 != nullptr ? juce::jlimit (0.0f, 1.0f, params->macro1->load()) : 0.0f;
-    const auto macro2 = params->macro2 != nullptr ? juce::jlimit (0.0f, 1.0f, params->macro2->load()) : 0.0f;
+    // --- Modulation setup (per host block) ---
+    bc.macro1 = params->macro1 != nullptr ? juce::jlimit (0.0f, 1.0f, params->macro1->load()) : 0.0f;
+    bc.macro2 = params->macro2 != nullptr ? juce::jlimit (0.0f, 1.0f, params->macro2->load()) : 0.0f;
+    bc.msegOut = params->uiMsegOut != nullptr ? juce::jlimit (0.0f, 1.0f, params->uiMsegOut->load()) : 0.0f;
 
     const auto lfo1SyncOn = params->lfo1Sync != nullptr && (params->lfo1Sync->load() >= 0.5f);
     const auto lfo2SyncOn = params->lfo2Sync != nullptr && (params->lfo2Sync->load() >= 0.5f);
@@ -1165,26 +1334,206 @@ void MonoSynthEngine::render (juce::AudioBuffer<float>& buffer, int startSample,
     lfo1.setFrequencyHz (lfo1Hz);
     lfo2.setFrequencyHz (lfo2Hz);
 
-    struct SlotCfg final
-    {
-        int src = 0;
-        int dst = 0;
-        float depth = 0.0f;
-    };
-
-    std::array<SlotCfg, (size_t) params::mod::numSlots> slots {};
+    bool slotsChanged = ! modRoutesValid;
     for (int s = 0; s < params::mod::numSlots; ++s)
     {
         const auto src = params->modSlotSrc[(size_t) s] != nullptr ? (int) std::lround (params->modSlotSrc[(size_t) s]->load()) : (int) params::mod::srcOff;
         const auto dst = params->modSlotDst[(size_t) s] != nullptr ? (int) std::lround (params->modSlotDst[(size_t) s]->load()) : (int) params::mod::dstOff;
         const auto dep = params->modSlotDepth[(size_t) s] != nullptr ? params->modSlotDepth[(size_t) s]->load() : 0.0f;
 
-        slots[(size_t) s].src = juce::jlimit ((int) params::mod::srcOff, (int) params::mod::srcMseg, src);
-        slots[(size_t) s].dst = juce::jlimit ((int) params::mod::dstOff, (int) params::mod::dstLast, dst);
-        slots[(size_t) s].depth = juce::jlimit (-1.0f, 1.0f, dep);
+        ModSlot slot;
+        slot.src = juce::jlimit ((int) params::mod::srcOff, (int) params::mod::srcLast, src);
+        slot.dst = juce::jlimit ((int) params::mod::dstOff, (int) params::mod::dstLast, dst);
+        slot.depth = juce::jlimit (-1.0f, 1.0f, dep);
+
+        auto& cur = bc.slots[(size_t) s];
+        if (slot.src != cur.src || slot.dst != cur.dst || slot.depth != cur.depth)
+        {
+            cur = slot;
+            slotsChanged = true;
+        }
     }
 
-    const auto noiseEnabled = params->noiseEnable != nullptr && (params->noiseEnable->load() >= 0.5f);
+    const auto rateIdx = params->modControlRate != nullptr ? (int) std::lround (params->modControlRate->load()) : (int) params::mod::rateAudio;
+    const auto modInterval = params::mod::controlRateInterval (rateIdx);
+    const auto modAudioRateFast = params->modAudioRateFast != nullptr && (params->modAudioRateFast->load() >= 0.5f);
+    if (modInterval != bc.modInterval || modAudioRateFast != bc.modAudioRateFast)
+    {
+        bc.modInterval = modInterval;
+        bc.modAudioRateFast = modAudioRateFast;
+        modCtrlCountdown = 0;
+        slotsChanged = true;
+    }
+
+    if (slotsChanged)
+        rebuildModRoutes();
+
+    bc.noiseEnabled = params->noiseEnable != nullptr && (params->noiseEnable->load() >= 0.5f);
+
+    // FX rack base values; per-segment modulation offsets are applied in render().
+    const auto loadf = [&] (std::atomic<float>* p, float d) noexcept { return p != nullptr ? p->load() : d; };
+    const auto loadb = [&] (std::atomic<float>* p, bool d) noexcept { return p != nullptr ? (p->load() >= 0.5f) : d; };
+    const auto loadi = [&] (std::atomic<float>* p, int d) noexcept { return p != nullptr ? (int) std::lround (p->load()) : d; };
+
+    bc.fx.globalMix01 = juce::jlimit (0.0f, 1.0f, loadf (params->fxGlobalMix, 0.0f));
+    bc.fxGlobalMorph = loadf (params->fxGlobalMorph, 0.0f);
+
+    bc.fx.chorusEnable = loadb (params->fxChorusEnable, false);
+    bc.fx.chorusMix01 = loadf (params->fxChorusMix, 0.0f);
+    bc.fx.chorusRateHz = loadf (params->fxChorusRateHz, 0.6f);
+    bc.fx.chorusDepthMs = loadf (params->fxChorusDepthMs, 8.0f);
+    bc.fx.chorusDelayMs = juce::jlimit (0.5f, 45.0f, loadf (params->fxChorusDelayMs, 10.0f));
+    bc.fx.chorusFeedback = juce::jlimit (-0.98f, 0.98f, loadf (params->fxChorusFeedback, 0.0f));
+    bc.fx.chorusStereo01 = juce::jlimit (0.0f, 1.0f, loadf (params->fxChorusStereo, 1.0f));
+    bc.fx.chorusHpHz = juce::jlimit (10.0f, 2000.0f, loadf (params->fxChorusHpHz, 40.0f));
+
+    bc.fx.delayEnable = loadb (params->fxDelayEnable, false);
+    bc.fx.delayMix01 = loadf (params->fxDelayMix, 0.0f);
+    bc.fx.delaySync = loadb (params->fxDelaySync, true);
+    bc.fx.delayDivL = loadi (params->fxDelayDivL, (int) params::lfo::div1_4);
+    bc.fx.delayDivR = loadi (params->fxDelayDivR, (int) params::lfo::div1_4);
+    bc.fx.delayTimeMs = loadf (params->fxDelayTimeMs, 320.0f);
+    bc.fx.delayFeedback01 = loadf (params->fxDelayFeedback, 0.35f);
+    bc.fx.delayFilterHz = juce::jlimit (200.0f, 20000.0f, loadf (params->fxDelayFilterHz, 12000.0f));
+    bc.fx.delayModRateHz = juce::jlimit (0.01f, 20.0f, loadf (params->fxDelayModRate, 0.35f));
+    bc.fx.delayModDepthMs = juce::jlimit (0.0f, 25.0f, loadf (params->fxDelayModDepth, 2.0f));
+    bc.fx.delayPingpong = loadb (params->fxDelayPingpong, false);
+    bc.fx.delayDuck01 = juce::jlimit (0.0f, 1.0f, loadf (params->fxDelayDuck, 0.0f));
+
+    bc.fx.reverbEnable = loadb (params->fxReverbEnable, false);
+    bc.fx.reverbMix01 = loadf (params->fxReverbMix, 0.0f);
+    bc.fx.reverbSize01 = loadf (params->fxReverbSize, 0.5f);
+    bc.fx.reverbDecay01 = juce::jlimit (0.0f, 1.0f, loadf (params->fxReverbDecay, 0.4f));
+    bc.fx.reverbDamp01 = loadf (params->fxReverbDamp, 0.4f);
+    bc.fx.reverbPreDelayMs = juce::jlimit (0.0f, 200.0f, loadf (params->fxReverbPreDelayMs, 0.0f));
+    bc.fx.reverbWidth01 = juce::jlimit (0.0f, 1.0f, loadf (params->fxReverbWidth, 1.0f));
+    bc.fx.reverbLowCutHz = juce::jlimit (20.0f, 2000.0f, loadf (params->fxReverbLowCutHz, 40.0f));
+    bc.fx.reverbHighCutHz = juce::jlimit (2000.0f, 20000.0f, loadf (params->fxReverbHighCutHz, 16000.0f));
+    bc.fx.reverbQuality = loadi (params->fxReverbQuality, (int) params::fx::reverb::hi);
+
+    bc.fx.distEnable = loadb (params->fxDistEnable, false);
+    bc.fx.distMix01 = loadf (params->fxDistMix, 0.0f);
+    bc.fx.distType = loadi (params->fxDistType, (int) params::fx::dist::tanh);
+    bc.fx.distDriveDb = loadf (params->fxDistDriveDb, 0.0f);
+    bc.fx.distTone01 = loadf (params->fxDistTone, 0.5f);
+    bc.fx.distPostLPHz = juce::jlimit (800.0f, 20000.0f, loadf (params->fxDistPostLPHz, 18000.0f));
+    bc.fx.distOutputTrimDb = juce::jlimit (-24.0f, 24.0f, loadf (params->fxDistOutputTrimDb, 0.0f));
+
+    bc.fx.phaserEnable = loadb (params->fxPhaserEnable, false);
+    bc.fx.phaserMix01 = loadf (params->fxPhaserMix, 0.0f);
+    bc.fx.phaserRateHz = loadf (params->fxPhaserRateHz, 0.35f);
+    bc.fx.phaserDepth01 = loadf (params->fxPhaserDepth, 0.6f);
+    bc.fx.phaserCentreHz = juce::jlimit (20.0f, 18000.0f, loadf (params->fxPhaserCentreHz, 1000.0f));
+    bc.fx.phaserFeedback = loadf (params->fxPhaserFeedback, 0.2f);
+    bc.fx.phaserStages = loadi (params->fxPhaserStages, 1);
+    bc.fx.phaserStereo01 = juce::jlimit (0.0f, 1.0f, loadf (params->fxPhaserStereo, 1.0f));
+
+    bc.fx.octaverEnable = loadb (params->fxOctEnable, false);
+    bc.fx.octaverMix01 = loadf (params->fxOctMix, 0.0f);
+    bc.fx.octaverSubLevel01 = loadf (params->fxOctSubLevel, 0.5f);
+    bc.fx.octaverBlend01 = juce::jlimit (0.0f, 1.0f, loadf (params->fxOctBlend, 0.5f));
+    bc.fx.octaverSensitivity01 = juce::jlimit (0.0f, 1.0f, loadf (params->fxOctSensitivity, 0.5f));
+    bc.fx.octaverTone01 = juce::jlimit (0.0f, 1.0f, loadf (params->fxOctTone, 0.5f));
+
+    bc.fxOrder = loadi (params->fxGlobalOrder, (int) params::fx::global::orderFixedA);
+    bc.fxOs = loadi (params->fxGlobalOversample, (int) params::fx::global::osOff);
+    bc.fxRoute = loadi (params->fxGlobalRoute, (int) params::fx::global::routeSerial);
+    if (bc.fxRoute != fxRoutePrev)
+    {
+        // The parallel dry lines are only fed while they are in use; drop whatever they held last time.
+        fxParallelAlignL.reset();
+        fxParallelAlignR.reset();
+    }
+    fxRoutePrev = bc.fxRoute;
+
+    bc.xtraEnabled = loadb (params->fxXtraEnable, false);
+    bc.fxXtraMix = loadf (params->fxXtraMix, 0.0f);
+    bc.fxXtraFlangerAmount = loadf (params->fxXtraFlangerAmount, 0.0f);
+    bc.fxXtraTremoloAmount = loadf (params->fxXtraTremoloAmount, 0.0f);
+    bc.fxXtraAutopanAmount = loadf (params->fxXtraAutopanAmount, 0.0f);
+    bc.fxXtraSaturatorAmount = loadf (params->fxXtraSaturatorAmount, 0.0f);
+    bc.fxXtraClipperAmount = loadf (params->fxXtraClipperAmount, 0.0f);
+    bc.fxXtraWidthAmount = loadf (params->fxXtraWidthAmount, 0.0f);
+    bc.fxXtraTiltAmount = loadf (params->fxXtraTiltAmount, 0.0f);
+    bc.fxXtraGateAmount = loadf (params->fxXtraGateAmount, 0.0f);
+    bc.fxXtraLofiAmount = loadf (params->fxXtraLofiAmount, 0.0f);
+    bc.fxXtraDoublerAmount = loadf (params->fxXtraDoublerAmount, 0.0f);
+}
+
+void MonoSynthEngine::render (juce::AudioBuffer<float>& buffer, int startSample, int numSamples, float* preDestroyOut)
+{
+    if (numSamples <= 0)
+        return;
+
+    if (params == nullptr)
+    {
+        buffer.clear (startSample, numSamples);
+        return;
+    }
+
+    if (! blockControlsReady)
+        beginBlock();
+
+    const auto& bc = blockControls;
+
+    const auto chs = buffer.getNumChannels();
+
+    const auto modMode = bc.modMode;
+    const auto modNoteSync = bc.modNoteSync;
+    const auto crushBits = bc.crushBits;
+    const auto crushDownsample = bc.crushDownsample;
+    const auto pitchLockEnabled = bc.pitchLockEnabled;
+    const auto pitchLockMode = bc.pitchLockMode;
+    const auto shaperEnabled = bc.shaperEnabled;
+    const auto shaperPre = bc.shaperPre;
+    const auto destroyPostFilter = bc.destroyPostFilter;
+    const auto tonePreFilter = bc.tonePreFilter;
+    const auto keyTrack = bc.keyTrack;
+    const auto toneOn = bc.toneOn;
+    const auto toneLinearPhase = bc.toneLinearPhase;
+    const int osFactor = bc.destroyOsFactor;
+    const auto osAuto = bc.destroyOsAuto;
+    const auto macro1 = bc.macro1;
+    const auto macro2 = bc.macro2;
+    const auto noiseEnabled = bc.noiseEnabled;
+    const auto polyMode = bc.polyMode;
+
+    // Defensive: should never happen if prepare() used the host's max block size.
+    if (destroyBuffer.getNumSamples() < numSamples
+        || destroyFadeBuffer.getNumSamples() < numSamples
+        || (int) destroyNoteHz.size() < numSamples
+        || (int) destroyFoldDrive.size() < numSamples
+        || (int) destroyFoldAmount.size() < numSamples
+        || (int) destroyFoldMix.size() < numSamples
+        || (int) destroyClipDrive.size() < numSamples
+        || (int) destroyClipAmount.size() < numSamples
+        || (int) destroyClipMix.size() < numSamples
+        || (int) destroyModAmount.size() < numSamples
+        || (int) destroyModMix.size() < numSamples
+        || (int) destroyModFreqHz.size() < numSamples
+        || (int) destroyCrushMix.size() < numSamples
+        || (int) shaperDriveDb.size() < numSamples
+        || (int) shaperMix.size() < numSamples
+        || (int) pitchLockPhaseBuf.size() < numSamples
+        || (int) pitchLockEnvBuf.size() < numSamples
+        || (int) filterModCutoffSemis.size() < numSamples
+        || (int) filterModResAdd.size() < numSamples
+        || (int) filterCutoffBuf.size() < numSamples
+        || (int) filterResBuf.size() < numSamples
+        || (int) oscOutBuf[0].size() < numSamples
+        || (int) oscLevelBuf[0].size() < numSamples
+        || (int) noiseBuf.size() < numSamples
+        || (int) fxDryL.size() < numSamples
+        || (int) fxDryR.size() < numSamples
+        || (int) fxParallelL.size() < numSamples
+        || (int) fxParallelR.size() < numSamples)
+    {
+        buffer.clear (startSample, numSamples);
+        return;
+    }
+
+    auto* sigBuf = destroyBuffer.getWritePointer (0);
+
     auto nextNoise = [&]() noexcept -> float
     {
         // Fast, deterministic xorshift32 (no allocations, no std::random).
@@ -1197,36 +1546,96 @@ void MonoSynthEngine::render (juce::AudioBuffer<float>& buffer, int startSample,
     };
 
     // 1) Generate oscillator mix + per-sample params for the Destroy chain.
-    float fxModChorusRateSum = 0.0f;
-    float fxModChorusDepthSum = 0.0f;
-    float fxModChorusMixSum = 0.0f;
-    float fxModDelayTimeSum = 0.0f;
-    float fxModDelayFeedbackSum = 0.0f;
-    float fxModDelayMixSum = 0.0f;
-    float fxModReverbSizeSum = 0.0f;
-    float fxModReverbDampSum = 0.0f;
-    float fxModReverbMixSum = 0.0f;
-    float fxModDistDriveSum = 0.0f;
-    float fxModDistToneSum = 0.0f;
-    float fxModDistMixSum = 0.0f;
-    float fxModPhaserRateSum = 0.0f;
-    float fxModPhaserDepthSum = 0.0f;
-    float fxModPhaserFeedbackSum = 0.0f;
-    float fxModPhaserMixSum = 0.0f;
-    float fxModOctAmountSum = 0.0f;
-    float fxModOctMixSum = 0.0f;
-    float fxModXtraFlangerSum = 0.0f;
-    float fxModXtraTremoloSum = 0.0f;
-    float fxModXtraAutopanSum = 0.0f;
-    float fxModXtraSaturatorSum = 0.0f;
-    float fxModXtraClipperSum = 0.0f;
-    float fxModXtraWidthSum = 0.0f;
-    float fxModXtraTiltSum = 0.0f;
-    float fxModXtraGateSum = 0.0f;
-    float fxModXtraLofiSum = 0.0f;
-    float fxModXtraDoublerSum = 0.0f;
-    float fxModXtraMixSum = 0.0f;
-    float fxModGlobalMorphSum = 0.0f;
+    // Per-destination modulation sums over this segment (FX destinations are applied block-rate).
+    std::array<float, (size_t) numModDests> modSum {};
+    // Per-sample destination values; only routed destinations are ever written.
+    std::array<float, (size_t) numModDests> modDst {};
+    std::array<float, (size_t) numModSources> modSrc {};
+    const auto modInterval = bc.modInterval;
+    const auto* fastRoutes = bc.fastRoutes.data();
+    const auto* slowRoutes = bc.slowRoutes.data();
+    const auto numFastRoutes = bc.numFastRoutes;
+    const auto numSlowRoutes = bc.numSlowRoutes;
+    // Oscillator bank setup for this segment: 0..2 = polyBLEP primitives, 3..12 = template wavetables, 13 = Draw.
+    // Oscillators with unison run in their own stack; their bank lane is switched off (lane 0 keeps running as sync master).
+    // In Poly mode the voice pool runs its own banks and unison is not used.
+    const auto wtInterp = bc.wtCubic ? dsp::WavetableReader::Interpolation::cubic : dsp::WavetableReader::Interpolation::linear;
+    oscBank.setWavetableInterpolation (wtInterp);
+    if (polyMode)
+        voicePool.setWavetableInterpolation (wtInterp);
+
+    std::array<bool, 3> useUnison {};
+    std::array<float, 3> oscTopSemis {}; // highest pitch each oscillator reaches above the note (Auto oversampling)
+    for (int k = 0; k < 3; ++k)
+    {
+        const auto& o = bc.osc[(size_t) k];
+        const auto waveIndex = o.wave;
+        auto shape = dsp::OscillatorBank::Shape::wavetable;
+        const ies::dsp::WavetableSet* wt = nullptr;
+        if (waveIndex <= 2)
+        {
+            const auto w = (params::osc::Wave) juce::jlimit (0, 2, waveIndex);
+            shape = w == params::osc::square ? dsp::OscillatorBank::Shape::square
+                  : w == params::osc::triangle ? dsp::OscillatorBank::Shape::triangle
+                                               : dsp::OscillatorBank::Shape::saw;
+        }
+        else if (waveIndex == 13)
+        {
+            if (auto* source = customSources[(size_t) k])
+                wt = source->acquire();
+        }
+        else if (templateBank != nullptr)
+        {
+            wt = &(*templateBank)[(size_t) juce::jlimit (0, 9, waveIndex - 3)];
+        }
+
+        if (polyMode)
+            voicePool.setOscillator (k, shape, wt, (float) o.coarse + o.fine / 100.0f);
+
+        useUnison[(size_t) k] = ! polyMode && o.unisonVoices > 1;
+        if (useUnison[(size_t) k])
+        {
+            auto& u = unison[(size_t) k];
+            u.configure (o.unisonVoices, o.unisonDetune, o.unisonBlend);
+            u.setShape (shape, wt); // null => saw
+            u.setWavetableInterpolation (wtInterp);
+        }
+
+        constexpr float maxDriftSemis = 0.3f;
+        oscTopSemis[(size_t) k] = (float) o.coarse + o.fine / 100.0f + juce::jmax (0.0f, o.detune01) * maxDriftSemis
+                                + (useUnison[(size_t) k] ? o.unisonDetune * dsp::UnisonOscillator::maxDetuneCents / 100.0f : 0.0f);
+
+        const bool bankLaneNeeded = ! useUnison[(size_t) k] || (k == 0 && bc.osc2Sync);
+        oscBank.setShape (k, bankLaneNeeded ? shape : dsp::OscillatorBank::Shape::off, wt); // null => saw
+    }
+    oscBank.setHardSync (bc.osc2Sync, bc.osc2Phase);
+
+    // Static pitch (no glide ramp, no bend smoothing, no drift): note, Hz and increments are constant for the segment.
+    const auto& oscP1 = bc.osc[0];
+    const auto& oscP2 = bc.osc[1];
+    const auto& oscP3 = bc.osc[2];
+    const bool staticPitch = noteGlide.samplesLeft == 0
+                          && ! pitchBendSemisSm.isSmoothing()
+                          && oscP1.detune01 <= 0.0f && oscP2.detune01 <= 0.0f && oscP3.detune01 <= 0.0f;
+    float staticNoteHz = 0.0f;
+    std::array<float, 3> staticOscInc {};
+    if (staticPitch)
+    {
+        const auto note = noteGlide.current + pitchBendSemisSm.getCurrentValue();
+        staticNoteHz = pitchConverter.noteToHz (note);
+        staticOscInc[0] = pitchConverter.noteToIncrement (note + (float) oscP1.coarse + oscP1.fine / 100.0f);
+        staticOscInc[1] = pitchConverter.noteToIncrement (note + (float) oscP2.coarse + oscP2.fine / 100.0f);
+        staticOscInc[2] = pitchConverter.noteToIncrement (note + (float) oscP3.coarse + oscP3.fine / 100.0f);
+    }
+
+    // Drive gains are only recomputed when the smoothed dB value moves.
+    float foldDriveDb = foldDriveDbSm.getCurrentValue();
+    float clipDriveDb = clipDriveDbSm.getCurrentValue();
+    float foldDriveGain = juce::Decibels::decibelsToGain (foldDriveDb, -100.0f);
+    float clipDriveGain = juce::Decibels::decibelsToGain (clipDriveDb, -100.0f);
+
+    // Sources only need to run every sample when an audio-rate route reads them.
+    const bool sourcesPerSample = numFastRoutes > 0;
     for (int i = 0; i < numSamples; ++i)
     {
         const auto midiNote = noteGlide.getNext();
@@ -1234,6 +1643,8 @@ void MonoSynthEngine::render (juce::AudioBuffer<float>& buffer, int startSample,
         const auto velSrc  = velocityGain; // unipolar 0..1 (captured per env-mode rules)
         const auto bendSemis = pitchBendSemisSm.getNextValue();
         const auto midiNoteBended = midiNote + bendSemis;
+        if (polyMode)
+            polyBendRatio[(size_t) i] = ies::math::fastExp2 (bendSemis * (1.0f / 12.0f));
 
         // Envelope sources: compute once and reuse (for Filter, Amp and Mod Matrix).
         const auto aEnv = ampEnv.getNextSample();
@@ -1241,230 +1652,116 @@ void MonoSynthEngine::render (juce::AudioBuffer<float>& buffer, int startSample,
         ampEnvBuf[(size_t) i] = aEnv;
         filterEnvBuf[(size_t) i] = fEnv;
 
-            const auto randSrc = randomNoteValue; // unipolar 0..1, refreshed on note-on
-            const auto msegSrc = params->uiMsegOut != nullptr ? juce::jlimit (0.0f, 1.0f, params->uiMsegOut->load()) : 0.0f;
-
-        const auto l1 = lfo1.process(); // bipolar
-        const auto l2 = lfo2.process(); // bipolar
-        const auto mw = modWheelSm.getNextValue(); // unipolar 0..1
-        const auto at = aftertouchSm.getNextValue(); // unipolar 0..1
-
-        float modOsc1Level = 0.0f;
-        float modOsc2Level = 0.0f;
-        float modOsc3Level = 0.0f;
-        float modCutSemis  = 0.0f;
-        float modResAdd    = 0.0f;
-        float modFoldAdd   = 0.0f;
-        float modClipAdd   = 0.0f;
-        float modModAdd    = 0.0f;
-        float modCrushAdd  = 0.0f;
-        float modShaperDriveAdd = 0.0f;
-        float modShaperMixAdd   = 0.0f;
-        float modFxChorusRateAdd = 0.0f;
-        float modFxChorusDepthAdd = 0.0f;
-        float modFxChorusMixAdd = 0.0f;
-        float modFxDelayTimeAdd = 0.0f;
-        float modFxDelayFeedbackAdd = 0.0f;
-        float modFxDelayMixAdd = 0.0f;
-        float modFxReverbSizeAdd = 0.0f;
-        float modFxReverbDampAdd = 0.0f;
-        float modFxReverbMixAdd = 0.0f;
-        float modFxDistDriveAdd = 0.0f;
-        float modFxDistToneAdd = 0.0f;
-        float modFxDistMixAdd = 0.0f;
-        float modFxPhaserRateAdd = 0.0f;
-        float modFxPhaserDepthAdd = 0.0f;
-        float modFxPhaserFeedbackAdd = 0.0f;
-        float modFxPhaserMixAdd = 0.0f;
-        float modFxOctAmountAdd = 0.0f;
-        float modFxOctMixAdd = 0.0f;
-        float modFxXtraFlangerAdd = 0.0f;
-        float modFxXtraTremoloAdd = 0.0f;
-        float modFxXtraAutopanAdd = 0.0f;
-        float modFxXtraSaturatorAdd = 0.0f;
-        float modFxXtraClipperAdd = 0.0f;
-        float modFxXtraWidthAdd = 0.0f;
-        float modFxXtraTiltAdd = 0.0f;
-        float modFxXtraGateAdd = 0.0f;
-        float modFxXtraLofiAdd = 0.0f;
-        float modFxXtraDoublerAdd = 0.0f;
-        float modFxXtraMixAdd = 0.0f;
-        float modFxGlobalMorphAdd = 0.0f;
-
-        // Slot depths are in [-1..1]. Dest scaling is per-destination.
-        constexpr float cutoffMaxSemis = 48.0f;
-        for (const auto& slot : slots)
-        {
-            if (std::abs (slot.depth) < 1.0e-6f || slot.src == (int) params::mod::srcOff || slot.dst == (int) params::mod::dstOff)
-                continue;
+        drift.tick();
+
+        const bool controlTick = (--modCtrlCountdown <= 0);
+        if (controlTick)
+            modCtrlCountdown = modInterval;
 
-            float srcVal = 0.0f;
-            switch ((params::mod::Source) slot.src)
+        if (sourcesPerSample || controlTick)
+        {
+            const auto step = sourcesPerSample ? 1 : modInterval;
+            const auto l1 = lfo1.process (step); // bipolar
+            const auto l2 = lfo2.process (step); // bipolar
+            const auto mw = modWheelSm.getNextValue(); // unipolar 0..1
+            const auto at = aftertouchSm.getNextValue(); // unipolar 0..1
+            if (step > 1)
             {
-                case params::mod::srcOff:    srcVal = 0.0f; break;
-                case params::mod::srcLfo1:   srcVal = l1; break;
-                case params::mod::srcLfo2:   srcVal = l2; break;
-                case params::mod::srcMacro1: srcVal = macro1; break; // unipolar 0..1
-                case params::mod::srcMacro2: srcVal = macro2; break; // unipolar 0..1
-                case params::mod::srcModWheel: srcVal = mw; break;
-                case params::mod::srcAftertouch: srcVal = at; break;
-                case params::mod::srcVelocity: srcVal = velSrc; break;
-                case params::mod::srcNote: srcVal = noteSrc; break;
-                case params::mod::srcFilterEnv: srcVal = fEnv; break;
-                case params::mod::srcAmpEnv: srcVal = aEnv; break;
-                case params::mod::srcRandom: srcVal = randSrc; break;
-                case params::mod::srcMseg: srcVal = msegSrc; break;
+                modWheelSm.skip (step - 1);
+                aftertouchSm.skip (step - 1);
             }
 
-            const auto amt = srcVal * slot.depth;
+            modSrc[(size_t) params::mod::srcLfo1] = l1;
+            modSrc[(size_t) params::mod::srcLfo2] = l2;
+            modSrc[(size_t) params::mod::srcMacro1] = macro1; // unipolar 0..1
+            modSrc[(size_t) params::mod::srcMacro2] = macro2; // unipolar 0..1
+            modSrc[(size_t) params::mod::srcModWheel] = mw;
+            modSrc[(size_t) params::mod::srcAftertouch] = at;
+            modSrc[(size_t) params::mod::srcVelocity] = velSrc;
+            modSrc[(size_t) params::mod::srcNote] = noteSrc;
+            modSrc[(size_t) params::mod::srcFilterEnv] = fEnv;
+            modSrc[(size_t) params::mod::srcAmpEnv] = aEnv;
+            modSrc[(size_t) params::mod::srcRandom] = randomNoteValue; // unipolar 0..1, refreshed on note-on
+            modSrc[(size_t) params::mod::srcMseg] = bc.msegOut;
+            modSrc[(size_t) params::mod::srcDrift] = drift.getNormalised (3); // bipolar, slow
+        }
 
-            switch ((params::mod::Dest) slot.dst)
+        // Compiled routing plan: cost grows with active routes, not with matrix size.
+        // Slow routes are evaluated once per control tick and ramp linearly to the new value over the interval.
+        if (controlTick && numSlowRoutes > 0)
+        {
+            std::array<float, (size_t) numModDests> target {};
+            for (int r = 0; r < numSlowRoutes; ++r)
             {
-                case params::mod::dstOff: break;
-                case params::mod::dstOsc1Level: modOsc1Level += amt; break;
-                case params::mod::dstOsc2Level: modOsc2Level += amt; break;
-                case params::mod::dstOsc3Level: modOsc3Level += amt; break;
-                case params::mod::dstFilterCutoff: modCutSemis += (amt * cutoffMaxSemis); break;
-                case params::mod::dstFilterResonance: modResAdd += amt; break;
-                case params::mod::dstFoldAmount: modFoldAdd += amt; break;
-                case params::mod::dstClipAmount: modClipAdd += amt; break;
-                case params::mod::dstModAmount: modModAdd += amt; break;
-                case params::mod::dstCrushMix: modCrushAdd += amt; break;
-                case params::mod::dstShaperDrive: modShaperDriveAdd += (amt * 18.0f); break; // dB span
-                case params::mod::dstShaperMix: modShaperMixAdd += amt; break;
-                case params::mod::dstFxChorusRate: modFxChorusRateAdd += amt; break;
-                case params::mod::dstFxChorusDepth: modFxChorusDepthAdd += amt; break;
-                case params::mod::dstFxChorusMix: modFxChorusMixAdd += amt; break;
-                case params::mod::dstFxDelayTime: modFxDelayTimeAdd += amt; break;
-                case params::mod::dstFxDelayFeedback: modFxDelayFeedbackAdd += amt; break;
-                case params::mod::dstFxDelayMix: modFxDelayMixAdd += amt; break;
-                case params::mod::dstFxReverbSize: modFxReverbSizeAdd += amt; break;
-                case params::mod::dstFxReverbDamp: modFxReverbDampAdd += amt; break;
-                case params::mod::dstFxReverbMix: modFxReverbMixAdd += amt; break;
-                case params::mod::dstFxDistDrive: modFxDistDriveAdd += amt; break;
-                case params::mod::dstFxDistTone: modFxDistToneAdd += amt; break;
-                case params::mod::dstFxDistMix: modFxDistMixAdd += amt; break;
-                case params::mod::dstFxPhaserRate: modFxPhaserRateAdd += amt; break;
-                case params::mod::dstFxPhaserDepth: modFxPhaserDepthAdd += amt; break;
-                case params::mod::dstFxPhaserFeedback: modFxPhaserFeedbackAdd += amt; break;
-                case params::mod::dstFxPhaserMix: modFxPhaserMixAdd += amt; break;
-                case params::mod::dstFxOctaverAmount: modFxOctAmountAdd += amt; break;
-                case params::mod::dstFxOctaverMix: modFxOctMixAdd += amt; break;
-                case params::mod::dstFxXtraFlangerAmount: modFxXtraFlangerAdd += amt; break;
-                case params::mod::dstFxXtraTremoloAmount: modFxXtraTremoloAdd += amt; break;
-                case params::mod::dstFxXtraAutopanAmount: modFxXtraAutopanAdd += amt; break;
-                case params::mod::dstFxXtraSaturatorAmount: modFxXtraSaturatorAdd += amt; break;
-                case params::mod::dstFxXtraClipperAmount: modFxXtraClipperAdd += amt; break;
-                case params::mod::dstFxXtraWidthAmount: modFxXtraWidthAdd += amt; break;
-                case params::mod::dstFxXtraTiltAmount: modFxXtraTiltAdd += amt; break;
-                case params::mod::dstFxXtraGateAmount: modFxXtraGateAdd += amt; break;
-                case params::mod::dstFxXtraLofiAmount: modFxXtraLofiAdd += amt; break;
-                case params::mod::dstFxXtraDoublerAmount: modFxXtraDoublerAdd += amt; break;
-                case params::mod::dstFxXtraMix: modFxXtraMixAdd += amt; break;
-                case params::mod::dstFxGlobalMorph: modFxGlobalMorphAdd += amt; break;
+                const auto& route = slowRoutes[r];
+                target[(size_t) route.dst] += modSrc[(size_t) route.src] * route.scale;
             }
-        }
-
-        fxModChorusRateSum += modFxChorusRateAdd;
-        fxModChorusDepthSum += modFxChorusDepthAdd;
-        fxModChorusMixSum += modFxChorusMixAdd;
-        fxModDelayTimeSum += modFxDelayTimeAdd;
-        fxModDelayFeedbackSum += modFxDelayFeedbackAdd;
-        fxModDelayMixSum += modFxDelayMixAdd;
-        fxModReverbSizeSum += modFxReverbSizeAdd;
-        fxModReverbDampSum += modFxReverbDampAdd;
-        fxModReverbMixSum += modFxReverbMixAdd;
-        fxModDistDriveSum += modFxDistDriveAdd;
-        fxModDistToneSum += modFxDistToneAdd;
-        fxModDistMixSum += modFxDistMixAdd;
-        fxModPhaserRateSum += modFxPhaserRateAdd;
-        fxModPhaserDepthSum += modFxPhaserDepthAdd;
-        fxModPhaserFeedbackSum += modFxPhaserFeedbackAdd;
-        fxModPhaserMixSum += modFxPhaserMixAdd;
-        fxModOctAmountSum += modFxOctAmountAdd;
-        fxModOctMixSum += modFxOctMixAdd;
-        fxModXtraFlangerSum += modFxXtraFlangerAdd;
-        fxModXtraTremoloSum += modFxXtraTremoloAdd;
-        fxModXtraAutopanSum += modFxXtraAutopanAdd;
-        fxModXtraSaturatorSum += modFxXtraSaturatorAdd;
-        fxModXtraClipperSum += modFxXtraClipperAdd;
-        fxModXtraWidthSum += modFxXtraWidthAdd;
-        fxModXtraTiltSum += modFxXtraTiltAdd;
-        fxModXtraGateSum += modFxXtraGateAdd;
-        fxModXtraLofiSum += modFxXtraLofiAdd;
-        fxModXtraDoublerSum += modFxXtraDoublerAdd;
-        fxModXtraMixSum += modFxXtraMixAdd;
-        fxModGlobalMorphSum += modFxGlobalMorphAdd;
 
-        filterModCutoffSemis[(size_t) i] = juce::jlimit (-96.0f, 96.0f, modCutSemis);
-        filterModResAdd[(size_t) i] = modResAdd;
-
-        const auto noteHz = ies::math::midiNoteToHz (midiNoteBended);
-        destroyNoteHz[(size_t) i] = noteHz;
-
-        const auto w1 = params->osc1Wave != nullptr ? (int) std::lround (params->osc1Wave->load()) : (int) params::osc::saw;
-        const auto w2 = params->osc2Wave != nullptr ? (int) std::lround (params->osc2Wave->load()) : (int) params::osc::saw;
-        const auto w3 = params->osc3Wave != nullptr ? (int) std::lround (params->osc3Wave->load()) : (int) params::osc::saw;
-
-        auto lvl1 = params->osc1Level != nullptr ? params->osc1Level->load() : 0.8f;
-        auto lvl2 = params->osc2Level != nullptr ? params->osc2Level->load() : 0.5f;
-        auto lvl3 = params->osc3Level != nullptr ? params->osc3Level->load() : 0.0f;
-        lvl1 = juce::jlimit (0.0f, 1.0f, lvl1 + modOsc1Level);
-        lvl2 = juce::jlimit (0.0f, 1.0f, lvl2 + modOsc2Level);
-        lvl3 = juce::jlimit (0.0f, 1.0f, lvl3 + modOsc3Level);
-
-        const auto coarse1 = params->osc1Coarse != nullptr ? (int) std::lround (params->osc1Coarse->load()) : 0;
-        const auto coarse2 = params->osc2Coarse != nullptr ? (int) std::lround (params->osc2Coarse->load()) : 0;
-        const auto coarse3 = params->osc3Coarse != nullptr ? (int) std::lround (params->osc3Coarse->load()) : 0;
+            const auto invInterval = 1.0f / (float) modInterval;
+            for (int d = 0; d < bc.numSlowDests; ++d)
+            {
+                const auto dst = (size_t) bc.slowDests[(size_t) d];
+                modCtrlStep[dst] = (target[dst] - modCtrlValue[dst]) * invInterval;
+            }
+        }
 
-        const auto fine1 = params->osc1Fine != nullptr ? params->osc1Fine->load() : 0.0f;
-        const auto fine2 = params->osc2Fine != nullptr ? params->osc2Fine->load() : 0.0f;
-        const auto fine3 = params->osc3Fine != nullptr ? params->osc3Fine->load() : 0.0f;
+        for (int d = 0; d < bc.numSlowDests; ++d)
+        {
+            const auto dst = (size_t) bc.slowDests[(size_t) d];
+            modCtrlValue[dst] += modCtrlStep[dst];
+            modDst[dst] = modCtrlValue[dst];
+            modSum[dst] += modDst[dst];
+        }
 
-        const auto detune1 = params->osc1Detune != nullptr ? params->osc1Detune->load() : 0.0f;
-        const auto detune2 = params->osc2Detune != nullptr ? params->osc2Detune->load() : 0.0f;
-        const auto detune3 = params->osc3Detune != nullptr ? params->osc3Detune->load() : 0.0f;
+        for (int d = 0; d < bc.numFastDests; ++d)
+            modDst[(size_t) bc.fastDests[(size_t) d]] = 0.0f;
+        for (int r = 0; r < numFastRoutes; ++r)
+        {
+            const auto& route = fastRoutes[r];
+            const auto amt = modSrc[(size_t) route.src] * route.scale;
+            modDst[(size_t) route.dst] += amt;
+            modSum[(size_t) route.dst] += amt;
+        }
 
-        const auto driftCents1 = computeDriftCents (driftRng1, driftState1, alpha, juce::jlimit (0.0f, 1.0f, detune1));
-        const auto driftCents2 = computeDriftCents (driftRng2, driftState2, alpha, juce::jlimit (0.0f, 1.0f, detune2));
-        const auto driftCents3 = computeDriftCents (driftRng3, driftState3, alpha, juce::jlimit (0.0f, 1.0f, detune3));
+        const auto modOsc1Level = modDst[(size_t) params::mod::dstOsc1Level];
+        const auto modOsc2Level = modDst[(size_t) params::mod::dstOsc2Level];
+        const auto modOsc3Level = modDst[(size_t) params::mod::dstOsc3Level];
+        const auto modCutSemis  = modDst[(size_t) params::mod::dstFilterCutoff];
+        const auto modResAdd    = modDst[(size_t) params::mod::dstFilterResonance];
+        const auto modFoldAdd   = modDst[(size_t) params::mod::dstFoldAmount];
+        const auto modClipAdd   = modDst[(size_t) params::mod::dstClipAmount];
+        const auto modModAdd    = modDst[(size_t) params::mod::dstModAmount];
+        const auto modCrushAdd  = modDst[(size_t) params::mod::dstCrushMix];
+        const auto modShaperDriveAdd = modDst[(size_t) params::mod::dstShaperDrive];
+        const auto modShaperMixAdd   = modDst[(size_t) params::mod::dstShaperMix];
 
-        const auto note1 = midiNoteBended + (float) coarse1 + fine1 / 100.0f + driftCents1 / 100.0f;
-        const auto note2 = midiNoteBended + (float) coarse2 + fine2 / 100.0f + driftCents2 / 100.0f;
-        const auto note3 = midiNoteBended + (float) coarse3 + fine3 / 100.0f + driftCents3 / 100.0f;
+        filterModCutoffSemis[(size_t) i] = juce::jlimit (-96.0f, 96.0f, modCutSemis);
+        filterModResAdd[(size_t) i] = modResAdd;
 
-        osc1.setFrequency (ies::math::midiNoteToHz (note1));
-        osc2.setFrequency (ies::math::midiNoteToHz (note2));
-        osc3.setFrequency (ies::math::midiNoteToHz (note3));
+        oscLevelBuf[0][(size_t) i] = juce::jlimit (0.0f, 1.0f, oscLevelSm[0].getNextValue() + modOsc1Level);
+        oscLevelBuf[1][(size_t) i] = juce::jlimit (0.0f, 1.0f, oscLevelSm[1].getNextValue() + modOsc2Level);
+        oscLevelBuf[2][(size_t) i] = juce::jlimit (0.0f, 1.0f, oscLevelSm[2].getNextValue() + modOsc3Level);
 
-        auto renderOsc = [&] (dsp::PolyBlepOscillator& o, int oscIndex, int waveIndex, bool* wrapped) noexcept
+        auto* oscInc = oscBank.incrementsAt (i);
+        if (staticPitch)
         {
-            // 0..2 = polyBLEP primitives. 3..12 = template wavetables. 13 = Draw (custom per-osc).
-            if (waveIndex <= 2)
-                return o.process ((params::osc::Wave) juce::jlimit (0, 2, waveIndex), wrapped);
-
-            const ies::dsp::WavetableSet* wt = nullptr;
-            if (waveIndex == 13)
-                wt = customTables[(size_t) oscIndex].load (std::memory_order_acquire);
-            else if (templateBank != nullptr)
-                wt = &(*templateBank)[(size_t) juce::jlimit (0, 9, waveIndex - 3)];
-
-            if (wt == nullptr)
-                return o.process (params::osc::saw, wrapped);
-
-            return o.processWavetable (*wt, wrapped);
-        };
+            destroyNoteHz[(size_t) i] = staticNoteHz;
+            oscInc[0] = staticOscInc[0];
+            oscInc[1] = staticOscInc[1];
+            oscInc[2] = staticOscInc[2];
+        }
+        else
+        {
+            destroyNoteHz[(size_t) i] = pitchConverter.noteToHz (midiNoteBended);
 
-        bool wrapped1 = false;
-        const auto s1 = renderOsc (osc1, 0, w1, &wrapped1);
-        const auto s2 = renderOsc (osc2, 1, w2, nullptr);
-        const auto s3 = renderOsc (osc3, 2, w3, nullptr);
+            constexpr float maxDriftCents = 30.0f;
+            const auto driftCents1 = drift.getValue (0) * (maxDriftCents * juce::jmax (0.0f, oscP1.detune01));
+            const auto driftCents2 = drift.getValue (1) * (maxDriftCents * juce::jmax (0.0f, oscP2.detune01));
+            const auto driftCents3 = drift.getValue (2) * (maxDriftCents * juce::jmax (0.0f, oscP3.detune01));
 
-        const auto doSync = params->osc2Sync != nullptr && (params->osc2Sync->load() >= 0.5f);
-        if (doSync && wrapped1)
-        {
-            const auto p2 = params->osc2Phase != nullptr ? params->osc2Phase->load() : 0.0f;
-            osc2.setPhase (p2);
+            oscInc[0] = pitchConverter.noteToIncrement (midiNoteBended + (float) oscP1.coarse + oscP1.fine / 100.0f + driftCents1 / 100.0f);
+            oscInc[1] = pitchConverter.noteToIncrement (midiNoteBended + (float) oscP2.coarse + oscP2.fine / 100.0f + driftCents2 / 100.0f);
+            oscInc[2] = pitchConverter.noteToIncrement (midiNoteBended + (float) oscP3.coarse + oscP3.fine / 100.0f + driftCents3 / 100.0f);
         }
 
         // Noise (Serum-ish helper osc): level + color (brightness).
@@ -1481,16 +1778,31 @@ void MonoSynthEngine::render (juce::AudioBuffer<float>& buffer, int startSample,
             noiseLp += a * (n - noiseLp);
             noiseSample = noiseLp * noiseLevel;
         }
+        noiseBuf[(size_t) i] = noiseSample;
 
-        sigBuf[i] = s1 * lvl1 + s2 * lvl2 + s3 * lvl3 + noiseSample;
-        if (preDestroyOut != nullptr)
-            preDestroyOut[i] = sigBuf[i];
-
-        destroyFoldDriveDb[(size_t) i] = foldDriveDbSm.getNextValue();
+        if (foldDriveDbSm.isSmoothing())
+        {
+            const auto db = foldDriveDbSm.getNextValue();
+            if (db != foldDriveDb)
+            {
+                foldDriveDb = db;
+                foldDriveGain = juce::Decibels::decibelsToGain (db, -100.0f);
+            }
+        }
+        destroyFoldDrive[(size_t) i] = foldDriveGain;
         destroyFoldAmount[(size_t) i]  = juce::jlimit (0.0f, 1.0f, foldAmountSm.getNextValue() + modFoldAdd);
         destroyFoldMix[(size_t) i]     = foldMixSm.getNextValue();
 
-        destroyClipDriveDb[(size_t) i] = clipDriveDbSm.getNextValue();
+        if (clipDriveDbSm.isSmoothing())
+        {
+            const auto db = clipDriveDbSm.getNextValue();
+            if (db != clipDriveDb)
+            {
+                clipDriveDb = db;
+                clipDriveGain = juce::Decibels::decibelsToGain (db, -100.0f);
+            }
+        }
+        destroyClipDrive[(size_t) i] = clipDriveGain;
         destroyClipAmount[(size_t) i]  = juce::jlimit (0.0f, 1.0f, clipAmountSm.getNextValue() + modClipAdd);
         destroyClipMix[(size_t) i]     = clipMixSm.getNextValue();
 
@@ -1503,12 +1815,74 @@ void MonoSynthEngine::render (juce::AudioBuffer<float>& buffer, int startSample,
         shaperMix[(size_t) i]          = juce::jlimit (0.0f, 1.0f, shaperMixSm.getNextValue() + modShaperMixAdd);
     }
 
+    // Map resonance knob [0..1] to [min..max] exponentially.
+    auto resonanceFromKnob = [] (float knob) noexcept
+    {
+        constexpr float minRes = 0.2f;
+        constexpr float maxRes = 20.0f;
+        const auto t = juce::jlimit (0.0f, 1.0f, knob);
+        return minRes * std::exp (std::log (maxRes / minRes) * t);
+    };
+
+    // Oscillators run as one 4-lane block kernel over the increments gathered above.
+    if (! polyMode)
+    {
+        float* oscOuts[dsp::OscillatorBank::numLanes] { useUnison[0] ? nullptr : oscOutBuf[0].data(),
+                                                        useUnison[1] ? nullptr : oscOutBuf[1].data(),
+                                                        useUnison[2] ? nullptr : oscOutBuf[2].data(),
+                                                        nullptr };
+        if (! (useUnison[0] && useUnison[1] && useUnison[2] && ! bc.osc2Sync))
+            oscBank.processBlock (oscOuts, numSamples);
+
+        // Unison stacks follow the same per-sample increments (lane k of the bank's increment frames).
+        for (int k = 0; k < 3; ++k)
+            if (useUnison[(size_t) k])
+                unison[(size_t) k].processBlock (oscBank.incrementsAt (0) + k, dsp::OscillatorBank::numLanes, oscOutBuf[(size_t) k].data(), numSamples);
+
+        const auto* s1 = oscOutBuf[0].data();
+        const auto* s2 = oscOutBuf[1].data();
+        const auto* s3 = oscOutBuf[2].data();
+        const auto* lvl1 = oscLevelBuf[0].data();
+        const auto* lvl2 = oscLevelBuf[1].data();
+        const auto* lvl3 = oscLevelBuf[2].data();
+        for (int i = 0; i < numSamples; ++i)
+            sigBuf[i] = s1[i] * lvl1[i] + s2[i] * lvl2[i] + s3[i] * lvl3[i] + noiseBuf[(size_t) i];
+
+    }
+    else
+    {
+        // Poly: per-voice oscillators, filter and amp; the shared filter controls are ramped here once for all voices.
+        for (int i = 0; i < numSamples; ++i)
+        {
+            polyCutoffHz[(size_t) i] = filterCutoffHzSm.getNextValue() * std::exp2 (filterModCutoffSemis[(size_t) i] * (1.0f / 12.0f));
+            polyResonance[(size_t) i] = resonanceFromKnob (filterResKnobSm.getNextValue() + filterModResAdd[(size_t) i]);
+            polyEnvSemis[(size_t) i] = filterEnvAmountSm.getNextValue();
+        }
+
+        VoicePool::BlockInputs in;
+        in.bendRatio = polyBendRatio.data();
+        in.oscLevel[0] = oscLevelBuf[0].data();
+        in.oscLevel[1] = oscLevelBuf[1].data();
+        in.oscLevel[2] = oscLevelBuf[2].data();
+        in.noise = noiseBuf.data();
+        in.cutoffHz = polyCutoffHz.data();
+        in.envSemis = polyEnvSemis.data();
+        in.resonance = polyResonance.data();
+        in.keyTrack = keyTrack;
+        in.filterType = (params::filter::Type) bc.filterType;
+        voicePool.render (in, sigBuf, numSamples);
+    }
+
+    if (preDestroyOut != nullptr)
+        std::memcpy (preDestroyOut, sigBuf, sizeof (float) * (size_t) numSamples);
+
     auto applyDestroyAndPitch = [&]()
     {
         // 2) Optional Shaper before Destroy.
         if (shaperEnabled && shaperPre)
         {
             shaper.setEnabled (true);
+            shaper.setAntiAlias (bc.shaperAntiAlias);
             for (int i = 0; i < numSamples; ++i)
             {
                 shaper.setDriveDb (shaperDriveDb[(size_t) i]);
@@ -1522,52 +1896,101 @@ void MonoSynthEngine::render (juce::AudioBuffer<float>& buffer, int startSample,
         }
 
         // 3) Destroy chain (fold -> clip -> ringmod/FM), optionally oversampled.
-        if (osFactor == 1)
+        dsp::DestroyChain::BlockInputs destroyIn;
+        destroyIn.noteHz = destroyNoteHz.data();
+        destroyIn.foldDrive = destroyFoldDrive.data();
+        destroyIn.foldAmount = destroyFoldAmount.data();
+        destroyIn.foldMix = destroyFoldMix.data();
+        destroyIn.clipDrive = destroyClipDrive.data();
+        destroyIn.clipAmount = destroyClipAmount.data();
+        destroyIn.clipMix = destroyClipMix.data();
+        destroyIn.modAmount = destroyModAmount.data();
+        destroyIn.modMix = destroyModMix.data();
+        destroyIn.modFreqHz = destroyModFreqHz.data();
+        destroyIn.modMode = modMode;
+        destroyIn.modNoteSync = modNoteSync;
+        destroyIn.foldAntiAlias = bc.foldAntiAlias;
+        destroyIn.clipAntiAlias = bc.clipAntiAlias;
+
+        auto targetOs = osFactor;
+        if (osAuto)
         {
-            for (int i = 0; i < numSamples; ++i)
+            // Sized from the highest oscillator that is sounding (and, in Poly, the highest held voice), not the
+            // played note: a +24 coarse or a wide unison stack moves every partial up with it.
+            auto topHz = [&] (int i) noexcept
             {
-                sigBuf[i] = destroyBase.processSamplePreCrush (sigBuf[i],
-                                                               destroyNoteHz[(size_t) i],
-                                                               destroyFoldDriveDb[(size_t) i], destroyFoldAmount[(size_t) i], destroyFoldMix[(size_t) i],
-                                                               destroyClipDriveDb[(size_t) i], destroyClipAmount[(size_t) i], destroyClipMix[(size_t) i],
-                                                               modMode, destroyModAmount[(size_t) i], destroyModMix[(size_t) i], modNoteSync, destroyModFreqHz[(size_t) i]);
-            }
+                auto semis = -1000.0f;
+                for (int k = 0; k < 3; ++k)
+                    if (oscLevelBuf[(size_t) k][(size_t) i] > 0.0f)
+                        semis = juce::jmax (semis, oscTopSemis[(size_t) k]);
+                if (semis <= -1000.0f)
+                    semis = 0.0f; // noise only: the note is as good a guess as any
+
+                const auto baseHz = polyMode ? voicePool.getHighestNoteHz() * polyBendRatio[(size_t) i]
+                                             : destroyNoteHz[(size_t) i];
+                return baseHz * std::exp2 (semis * (1.0f / 12.0f));
+            };
+
+            const auto bw = juce::jmax (dsp::DestroyChain::estimateBandwidthHz (destroyIn, 0, topHz (0)),
+                                        dsp::DestroyChain::estimateBandwidthHz (destroyIn, numSamples - 1, topHz (numSamples - 1)));
+            targetOs = autoDestroyOsFactor (bw, numSamples);
         }
-        else
+
+        // A factor change starts the new path from clean filter state, with its ring/FM phasor aligned to the old
+        // path, and crossfades over ~10 ms. Changes that arrive mid-fade wait for it to finish. The first block
+        // after a reset has nothing to fade from.
+        if (! destroyOsStarted)
+        {
+            destroyOsFactor = targetOs;
+            destroyOsStarted = true;
+        }
+
+        if (targetOs != destroyOsFactor && destroyOsFadeRemaining == 0)
         {
-            auto& os = (osFactor == 2) ? destroyOversampling2x : destroyOversampling4x;
-            auto& dc = (osFactor == 2) ? destroyOs2 : destroyOs4;
+            auto chainFor = [this] (int f) -> dsp::DestroyChain&
+            {
+                return (f == 2) ? destroyOs2 : (f == 4) ? destroyOs4 : (f == 8) ? destroyOs8 : destroyBase;
+            };
+
+            chainFor (targetOs).copyModPhaseFrom (chainFor (destroyOsFactor));
+            if (targetOs == 2) destroyOversampling2x.reset();
+            if (targetOs == 4) destroyOversampling4x.reset();
+            if (targetOs == 8) destroyOversampling8x.reset();
 
-            juce::dsp::AudioBlock<float> block (destroyBuffer);
-            auto baseBlock = block.getSubBlock (0, (size_t) numSamples);
-            juce::dsp::AudioBlock<const float> constBase (baseBlock);
+            destroyOsFadeFrom = destroyOsFactor;
+            destroyOsFactor = targetOs;
+            destroyOsFadeRemaining = destroyOsFadeLength;
+        }
 
-            auto upBlock = os.processSamplesUp (constBase);
-            auto* up = upBlock.getChannelPointer (0);
-            const int upN = (int) upBlock.getNumSamples();
-            const int fac = (int) os.getOversamplingFactor(); // 2 or 4
+        if (destroyOsFadeRemaining > 0)
+        {
+            auto* oldPath = destroyFadeBuffer.getWritePointer (0);
+            std::memcpy (oldPath, sigBuf, sizeof (float) * (size_t) numSamples);
+            runDestroyPath (destroyOsFadeFrom, oldPath, numSamples, destroyIn);
+            runDestroyPath (destroyOsFactor, sigBuf, numSamples, destroyIn);
 
-            for (int j = 0; j < upN; ++j)
+            const auto step = 1.0f / (float) destroyOsFadeLength;
+            for (int i = 0; i < numSamples; ++i)
             {
-                const int i = j / fac;
-                up[j] = dc.processSamplePreCrush (up[j],
-                                                  destroyNoteHz[(size_t) i],
-                                                  destroyFoldDriveDb[(size_t) i], destroyFoldAmount[(size_t) i], destroyFoldMix[(size_t) i],
-                                                  destroyClipDriveDb[(size_t) i], destroyClipAmount[(size_t) i], destroyClipMix[(size_t) i],
-                                                  modMode, destroyModAmount[(size_t) i], destroyModMix[(size_t) i], modNoteSync, destroyModFreqHz[(size_t) i]);
+                const auto t = destroyOsFadeRemaining > 0 ? 1.0f - (float) destroyOsFadeRemaining * step : 1.0f;
+                sigBuf[i] = oldPath[i] + (sigBuf[i] - oldPath[i]) * t;
+                if (destroyOsFadeRemaining > 0)
+                    --destroyOsFadeRemaining;
             }
-
-            os.processSamplesDown (baseBlock);
+        }
+        else
+        {
+            runDestroyPath (destroyOsFactor, sigBuf, numSamples, destroyIn);
         }
 
         // 4) Crush always at base sample rate (keeps SRR behaviour stable).
-        for (int i = 0; i < numSamples; ++i)
-            sigBuf[i] = destroyBase.processSampleCrush (sigBuf[i], crushBits, crushDownsample, destroyCrushMix[(size_t) i]);
+        destroyBase.processBlockCrush (sigBuf, numSamples, crushBits, crushDownsample, destroyCrushMix.data());
 
         // 5) Optional Shaper after Destroy.
         if (shaperEnabled && ! shaperPre)
         {
             shaper.setEnabled (true);
+            shaper.setAntiAlias (bc.shaperAntiAlias);
             for (int i = 0; i < numSamples; ++i)
             {
                 shaper.setDriveDb (shaperDriveDb[(size_t) i]);
@@ -1583,82 +2006,55 @@ void MonoSynthEngine::render (juce::AudioBuffer<float>& buffer, int startSample,
             constexpr float followerAttack = 0.14f;
             constexpr float followerRelease = 0.02f;
             constexpr float brightnessFollow = 0.07f;
-            constexpr float lockGain = 0.50f;
+            constexpr int weightInterval = 16;
             const auto brightnessCut = juce::jlimit (0.001f, 0.25f, (float) (2.0 * juce::MathConstants<double>::pi * 1200.0 / sampleRateHz));
 
-            for (int i = 0; i < numSamples; ++i)
+            // Weights are held per control interval: the follower/phasor pass fills scratch buffers for the
+            // interval, then the harmonic series renders it four samples at a time.
+            for (int start = 0; start < numSamples;)
             {
-                const auto in = sigBuf[i];
-                const auto envIn = std::abs (in);
-                const auto coeff = envIn > pitchLockFollower ? followerAttack : followerRelease;
-                pitchLockFollower += coeff * (envIn - pitchLockFollower);
-
-                // Brightness proxy from simple low/high split, used to steer harmonic weights.
-                pitchLockLowpass += brightnessCut * (in - pitchLockLowpass);
-                const auto hi = in - pitchLockLowpass;
-                const auto den = std::abs (pitchLockLowpass) + std::abs (hi) + 1.0e-5f;
-                const auto brightnessNow = juce::jlimit (0.0f, 1.0f, std::abs (hi) / den);
-                pitchLockBrightness += brightnessFollow * (brightnessNow - pitchLockBrightness);
-
-                const auto noteHz = destroyNoteHz[(size_t) i];
-                const auto phaseInc = juce::jlimit (0.0f, 0.5f, noteHz / (float) sampleRateHz);
-                pitchLockPhase += phaseInc;
-                if (pitchLockPhase >= 1.0f)
-                    pitchLockPhase -= 1.0f;
-
-                const auto p = juce::MathConstants<float>::twoPi * pitchLockPhase;
-                const auto h1 = std::sin (p);
-                const auto h2 = std::sin (2.0f * p);
-                const auto h3 = std::sin (3.0f * p);
-                const auto h4 = std::sin (4.0f * p);
-                const auto h5 = std::sin (5.0f * p);
-
-                const auto nyqSafe = (float) (0.48 * sampleRateHz);
-                auto harmonicMask = [=] (float harmonicMul) noexcept
+                if (pitchLockWeightCountdown <= 0)
                 {
-                    const auto rel = (harmonicMul * noteHz) / juce::jmax (10.0f, nyqSafe);
-                    if (rel >= 1.0f)
-                        return 0.0f;
-                    const auto m = 1.0f - rel * rel;
-                    return juce::jlimit (0.0f, 1.0f, m);
-                };
-
-                const auto bright = juce::jlimit (0.0f, 1.0f, pitchLockBrightness);
-                float w1 = 1.00f;
-                float w2 = (0.22f + 0.28f * bright) * harmonicMask (2.0f);
-                float w3 = (0.12f + 0.26f * bright) * harmonicMask (3.0f);
-                float w4 = (0.05f + 0.20f * bright) * harmonicMask (4.0f);
-                float w5 = (0.02f + 0.12f * bright * bright) * harmonicMask (5.0f);
-
-                const auto norm = juce::jmax (1.0e-4f, w1 + w2 + w3 + w4 + w5);
-                const auto harmonicTone = (w1 * h1 + w2 * h2 + w3 * h3 + w4 * h4 + w5 * h5) / norm;
-                const auto fundamentalTone = h1;
-
-                float lockTone = harmonicTone;
-                float modeGain = 1.0f;
-                switch ((params::destroy::PitchLockMode) pitchLockMode)
+                    pitchLockWeightCountdown = weightInterval;
+                    updatePitchLockWeights (pitchLockMode, destroyNoteHz[(size_t) start]);
+                }
+
+                const int n = juce::jmin (pitchLockWeightCountdown, numSamples - start);
+                auto* phases = pitchLockPhaseBuf.data() + start;
+                auto* env = pitchLockEnvBuf.data() + start;
+
+                for (int j = 0; j < n; ++j)
                 {
-                    case params::destroy::pitchModeFundamental:
-                        lockTone = fundamentalTone;
-                        modeGain = 0.95f;
-                        break;
-                    case params::destroy::pitchModeHarmonic:
-                        lockTone = harmonicTone;
-                        modeGain = 1.00f;
-                        break;
-                    case params::destroy::pitchModeHybrid:
-                    default:
-                    {
-                        const auto harmonicBlend = juce::jlimit (0.0f, 1.0f, 0.35f + 0.55f * bright);
-                        lockTone = juce::jmap (harmonicBlend, fundamentalTone, harmonicTone);
-                        modeGain = 1.07f;
-                        break;
-                    }
+                    const auto in = sigBuf[start + j];
+                    const auto envIn = std::abs (in);
+                    const auto coeff = envIn > pitchLockFollower ? followerAttack : followerRelease;
+                    pitchLockFollower += coeff * (envIn - pitchLockFollower);
+
+                    // Brightness proxy from simple low/high split, used to steer harmonic weights.
+                    pitchLockLowpass += brightnessCut * (in - pitchLockLowpass);
+                    const auto hi = in - pitchLockLowpass;
+                    const auto den = std::abs (pitchLockLowpass) + std::abs (hi) + 1.0e-5f;
+                    const auto brightnessNow = juce::jlimit (0.0f, 1.0f, std::abs (hi) / den);
+                    pitchLockBrightness += brightnessFollow * (brightnessNow - pitchLockBrightness);
+                    pitchLockBrightnessSum += pitchLockBrightness;
+                    ++pitchLockBrightnessCount;
+
+                    const auto noteHz = destroyNoteHz[(size_t) (start + j)];
+                    const auto phaseInc = juce::jlimit (0.0f, 0.5f, noteHz / (float) sampleRateHz);
+                    pitchLockPhase += phaseInc;
+                    if (pitchLockPhase >= 1.0f)
+                        pitchLockPhase -= 1.0f;
+
+                    phases[j] = pitchLockPhase;
+                    env[j] = pitchLockFollower * juce::jlimit (0.0f, 1.0f, pitchLockAmountSm.getNextValue());
                 }
 
-                const auto amount = juce::jlimit (0.0f, 1.0f, pitchLockAmountSm.getNextValue());
-                const auto gain = lockGain * (0.75f + 0.35f * (1.0f - bright));
-                sigBuf[i] = in + (lockTone * pitchLockFollower * amount * gain * modeGain);
+                pitchLockHarmonics.processBlock (phases, phases, n);
+                for (int j = 0; j < n; ++j)
+                    sigBuf[start + j] += phases[j] * env[j];
+
+                pitchLockWeightCountdown -= n;
+                start += n;
             }
         }
         else
@@ -1668,125 +2064,110 @@ void MonoSynthEngine::render (juce::AudioBuffer<float>& buffer, int startSample,
         }
     };
 
-    auto applyFilterSample = [&] (float& sig, float noteHz, int i)
+    // Cutoff/resonance per sample for the block filter. Env and mod share one exp2 (skipped when both are
+    // idle), and the resonance curve only runs when its knob moves, so a static cutoff stays cheap end to end.
+    auto fillFilterControls = [&]()
     {
-        const auto baseCutoff = filterCutoffHzSm.getNextValue();
-        auto resKnob          = filterResKnobSm.getNextValue();
-        const auto envSemis   = filterEnvAmountSm.getNextValue();
-        const auto envVal = filterEnvBuf[(size_t) i];
+        float lastResKnob = -1.0f;
+        float res = 0.0f;
 
-        auto cutoff = baseCutoff;
-        if (keyTrack)
-            cutoff *= (noteHz / 440.0f);
+        for (int i = 0; i < numSamples; ++i)
+        {
+            auto cutoff = filterCutoffHzSm.getNextValue();
+            const auto resKnob = juce::jlimit (0.0f, 1.0f, filterResKnobSm.getNextValue() + filterModResAdd[(size_t) i]);
+            const auto envSemis = filterEnvAmountSm.getNextValue();
 
-        cutoff *= std::exp2 ((envSemis * envVal) * (1.0f / 12.0f));
-        cutoff *= std::exp2 (filterModCutoffSemis[(size_t) i] * (1.0f / 12.0f));
+            if (keyTrack)
+                cutoff *= (destroyNoteHz[(size_t) i] / 440.0f);
 
-        resKnob = juce::jlimit (0.0f, 1.0f, resKnob + filterModResAdd[(size_t) i]);
+            const auto semis = envSemis * filterEnvBuf[(size_t) i] + filterModCutoffSemis[(size_t) i];
+            if (semis != 0.0f)
+                cutoff *= ies::math::fastExp2 (semis * (1.0f / 12.0f));
 
-        // Map resonance knob [0..1] to [min..max] exponentially.
-        constexpr float minRes = 0.2f;
-        constexpr float maxRes = 20.0f;
-        const auto t = juce::jlimit (0.0f, 1.0f, resKnob);
-        const auto res = minRes * std::exp (std::log (maxRes / minRes) * t);
+            if (resKnob != lastResKnob)
+            {
+                lastResKnob = resKnob;
+                res = resonanceFromKnob (resKnob);
+            }
 
-        sig = filter.processSample (sig, cutoff, res);
+            filterCutoffBuf[(size_t) i] = cutoff;
+            filterResBuf[(size_t) i] = res;
+        }
     };
 
-    auto applyToneSample = [&] (float& sig)
+    // Tone runs a block at a time. Settings are pushed once per block when nothing is moving, and every 16
+    // samples while a Tone parameter is smoothing.
+    auto applyToneBlock = [&]()
     {
-        const auto lowCut = toneLowCutHzSm.getNextValue();
-        const auto highCut = toneHighCutHzSm.getNextValue();
-
-        const auto p1f = tonePeak1FreqHzSm.getNextValue();
-        const auto p1g = tonePeak1GainDbSm.getNextValue();
-        const auto p1q = tonePeak1QSm.getNextValue();
-        const auto p1dr = tonePeak1DynRangeDbSm.getNextValue();
-        const auto p1dt = tonePeak1DynThresholdDbSm.getNextValue();
-
-        const auto p2f = tonePeak2FreqHzSm.getNextValue();
-        const auto p2g = tonePeak2GainDbSm.getNextValue();
-        const auto p2q = tonePeak2QSm.getNextValue();
-        const auto p2dr = tonePeak2DynRangeDbSm.getNextValue();
-        const auto p2dt = tonePeak2DynThresholdDbSm.getNextValue();
-
-        const auto p3f = tonePeak3FreqHzSm.getNextValue();
-        const auto p3g = tonePeak3GainDbSm.getNextValue();
-        const auto p3q = tonePeak3QSm.getNextValue();
-        const auto p3dr = tonePeak3DynRangeDbSm.getNextValue();
-        const auto p3dt = tonePeak3DynThresholdDbSm.getNextValue();
-
-        const auto p4f = tonePeak4FreqHzSm.getNextValue();
-        const auto p4g = tonePeak4GainDbSm.getNextValue();
-        const auto p4q = tonePeak4QSm.getNextValue();
-        const auto p4dr = tonePeak4DynRangeDbSm.getNextValue();
-        const auto p4dt = tonePeak4DynThresholdDbSm.getNextValue();
-
-        const auto p5f = tonePeak5FreqHzSm.getNextValue();
-        const auto p5g = tonePeak5GainDbSm.getNextValue();
-        const auto p5q = tonePeak5QSm.getNextValue();
-        const auto p5dr = tonePeak5DynRangeDbSm.getNextValue();
-        const auto p5dt = tonePeak5DynThresholdDbSm.getNextValue();
-
-        const auto p6f = tonePeak6FreqHzSm.getNextValue();
-        const auto p6g = tonePeak6GainDbSm.getNextValue();
-        const auto p6q = tonePeak6QSm.getNextValue();
-        const auto p6dr = tonePeak6DynRangeDbSm.getNextValue();
-        const auto p6dt = tonePeak6DynThresholdDbSm.getNextValue();
-
-        const auto p7f = tonePeak7FreqHzSm.getNextValue();
-        const auto p7g = tonePeak7GainDbSm.getNextValue();
-        const auto p7q = tonePeak7QSm.getNextValue();
-        const auto p7dr = tonePeak7DynRangeDbSm.getNextValue();
-        const auto p7dt = tonePeak7DynThresholdDbSm.getNextValue();
-
-        const auto p8f = tonePeak8FreqHzSm.getNextValue();
-        const auto p8g = tonePeak8GainDbSm.getNextValue();
-        const auto p8q = tonePeak8QSm.getNextValue();
-        const auto p8dr = tonePeak8DynRangeDbSm.getNextValue();
-        const auto p8dt = tonePeak8DynThresholdDbSm.getNextValue();
-
-        if (toneOn)
+        toneLinearAlign.writeBlock (sigBuf, numSamples);
+
+        if (toneLinearPhase)
         {
-            if (toneCoeffCountdown-- <= 0)
+            // The kernel follows the smoothed settings at block rate; with Tone off it is a pure delay so the
+            // latency stays put. Only finished kernels are picked up here, the design runs on its own thread.
+            toneLinearDesigner.request (makeToneLinearSettings (! toneOn));
+            skipToneSmoothers (numSamples);
+
+            if (const auto* kernel = toneLinearDesigner.takeKernel())
+                toneLinearConvolver.setKernel (*kernel);
+
+            toneLinearConvolver.process (sigBuf, numSamples);
+            return;
+        }
+
+        // Minimum phase (or Tone off) gets the linear-phase latency too, so the two modes line up.
+        toneLinearAlign.readBlock<dsp::DelayLine::Interpolation::linear> (sigBuf, numSamples, (float) toneLinearDesigner.getLatencySamples());
+
+        if (! toneOn)
+        {
+            skipToneSmoothers (numSamples);
+            return;
+        }
+
+        if (! toneParamsSmoothing())
+        {
+            pushToneParams();
+            toneEq.processBlock (sigBuf, numSamples);
+            toneCoeffCountdown = 0;
+            return;
+        }
+
+        for (int start = 0; start < numSamples;)
+        {
+            if (toneCoeffCountdown <= 0)
             {
+                pushToneParams();
                 toneCoeffCountdown = 16;
-                toneEq.setParams (lowCut, highCut, toneLowCutSlope, toneHighCutSlope,
-                                  tonePeak1On, tonePeak1Type, p1f, p1g, p1q, tonePeak1DynOn, p1dr, p1dt,
-                                  tonePeak2On, tonePeak2Type, p2f, p2g, p2q, tonePeak2DynOn, p2dr, p2dt,
-                                  tonePeak3On, tonePeak3Type, p3f, p3g, p3q, tonePeak3DynOn, p3dr, p3dt,
-                                  tonePeak4On, tonePeak4Type, p4f, p4g, p4q, tonePeak4DynOn, p4dr, p4dt,
-                                  tonePeak5On, tonePeak5Type, p5f, p5g, p5q, tonePeak5DynOn, p5dr, p5dt,
-                                  tonePeak6On, tonePeak6Type, p6f, p6g, p6q, tonePeak6DynOn, p6dr, p6dt,
-                                  tonePeak7On, tonePeak7Type, p7f, p7g, p7q, tonePeak7DynOn, p7dr, p7dt,
-                                  tonePeak8On, tonePeak8Type, p8f, p8g, p8q, tonePeak8DynOn, p8dr, p8dt);
-                toneEq.updateCoeffs();
             }
 
-            sig = toneEq.processSample (sig);
+            const auto n = juce::jmin (numSamples - start, toneCoeffCountdown);
+            toneEq.processBlock (sigBuf + start, n);
+            skipToneSmoothers (n);
+            toneCoeffCountdown -= n;
+            start += n;
         }
     };
 
     auto applyFilterTone = [&]()
     {
-        for (int i = 0; i < numSamples; ++i)
+        if (polyMode)
         {
-            auto sig = sigBuf[i];
-            const auto noteHz = destroyNoteHz[(size_t) i];
-
-            if (tonePreFilter)
-                applyToneSample (sig);
+            // Voices are already filtered; only Tone runs on the sum.
+            applyToneBlock();
+            return;
+        }
 
-            applyFilterSample (sig, noteHz, i);
+        if (tonePreFilter)
+            applyToneBlock();
 
-            if (! tonePreFilter)
-                applyToneSample (sig);
+        fillFilterControls();
+        filter.processBlock (sigBuf, filterCutoffBuf.data(), filterResBuf.data(), numSamples);
 
-            sigBuf[i] = sig;
-        }
+        if (! tonePreFilter)
+            applyToneBlock();
     };
 
-    if (! destroyPostFilter)
+    if (! destroyPostFilter || polyMode)
     {
         applyDestroyAndPitch();
         applyFilterTone();
@@ -1801,8 +2182,11 @@ void MonoSynthEngine::render (juce::AudioBuffer<float>& buffer, int startSample,
     for (int i = 0; i < numSamples; ++i)
     {
         auto sig = sigBuf[i];
-        sig *= ampEnvBuf[(size_t) i];
-        sig *= velocityGain;
+        if (! polyMode)
+        {
+            sig *= ampEnvBuf[(size_t) i];
+            sig *= velocityGain;
+        }
         sig *= outGain.getNextValue();
 
         const auto sampleIndex = startSample + i;
@@ -1814,70 +2198,33 @@ void MonoSynthEngine::render (juce::AudioBuffer<float>& buffer, int startSample,
     {
         const float invN = 1.0f / (float) juce::jmax (1, numSamples);
         const auto avg = [&] (float s) noexcept { return s * invN; };
-        const auto loadf = [&] (std::atomic<float>* p, float d) noexcept { return p != nullptr ? p->load() : d; };
-        const auto loadb = [&] (std::atomic<float>* p, bool d) noexcept { return p != nullptr ? (p->load() >= 0.5f) : d; };
-        const auto loadi = [&] (std::atomic<float>* p, int d) noexcept { return p != nullptr ? (int) std::lround (p->load()) : d; };
-
-        ies::dsp::FxChain::RuntimeParams fxp;
-        fxp.globalMix01 = juce::jlimit (0.0f, 1.0f, loadf (params->fxGlobalMix, 0.0f));
-        const float fxMorph = juce::jlimit (0.0f, 1.0f, loadf (params->fxGlobalMorph, 0.0f) + avg (fxModGlobalMorphSum) * 0.45f);
-
-        fxp.chorusEnable = loadb (params->fxChorusEnable, false);
-        fxp.chorusMix01 = juce::jlimit (0.0f, 1.0f, loadf (params->fxChorusMix, 0.0f) + avg (fxModChorusMixSum));
-        fxp.chorusRateHz = juce::jlimit (0.01f, 10.0f, loadf (params->fxChorusRateHz, 0.6f) * std::exp2 (avg (fxModChorusRateSum) * 2.0f));
-        fxp.chorusDepthMs = juce::jlimit (0.0f, 25.0f, loadf (params->fxChorusDepthMs, 8.0f) + avg (fxModChorusDepthSum) * 8.0f);
-        fxp.chorusDelayMs = juce::jlimit (0.5f, 45.0f, loadf (params->fxChorusDelayMs, 10.0f));
-        fxp.chorusFeedback = juce::jlimit (-0.98f, 0.98f, loadf (params->fxChorusFeedback, 0.0f));
-        fxp.chorusStereo01 = juce::jlimit (0.0f, 1.0f, loadf (params->fxChorusStereo, 1.0f));
-        fxp.chorusHpHz = juce::jlimit (10.0f, 2000.0f, loadf (params->fxChorusHpHz, 40.0f));
-
-        fxp.delayEnable = loadb (params->fxDelayEnable, false);
-        fxp.delayMix01 = juce::jlimit (0.0f, 1.0f, loadf (params->fxDelayMix, 0.0f) + avg (fxModDelayMixSum));
-        fxp.delaySync = loadb (params->fxDelaySync, true);
-        fxp.delayDivL = loadi (params->fxDelayDivL, (int) params::lfo::div1_4);
-        fxp.delayDivR = loadi (params->fxDelayDivR, (int) params::lfo::div1_4);
-        fxp.delayTimeMs = juce::jlimit (1.0f, 4000.0f, loadf (params->fxDelayTimeMs, 320.0f) * std::exp2 (avg (fxModDelayTimeSum) * 2.0f));
-        fxp.delayFeedback01 = juce::jlimit (0.0f, 0.98f, loadf (params->fxDelayFeedback, 0.35f) + avg (fxModDelayFeedbackSum) * 0.35f);
-        fxp.delayFilterHz = juce::jlimit (200.0f, 20000.0f, loadf (params->fxDelayFilterHz, 12000.0f));
-        fxp.delayModRateHz = juce::jlimit (0.01f, 20.0f, loadf (params->fxDelayModRate, 0.35f));
-        fxp.delayModDepthMs = juce::jlimit (0.0f, 25.0f, loadf (params->fxDelayModDepth, 2.0f));
-        fxp.delayPingpong = loadb (params->fxDelayPingpong, false);
-        fxp.delayDuck01 = juce::jlimit (0.0f, 1.0f, loadf (params->fxDelayDuck, 0.0f));
-
-        fxp.reverbEnable = loadb (params->fxReverbEnable, false);
-        fxp.reverbMix01 = juce::jlimit (0.0f, 1.0f, loadf (params->fxReverbMix, 0.0f) + avg (fxModReverbMixSum));
-        fxp.reverbSize01 = juce::jlimit (0.0f, 1.0f, loadf (params->fxReverbSize, 0.5f) + avg (fxModReverbSizeSum) * 0.35f);
-        fxp.reverbDecay01 = juce::jlimit (0.0f, 1.0f, loadf (params->fxReverbDecay, 0.4f));
-        fxp.reverbDamp01 = juce::jlimit (0.0f, 1.0f, loadf (params->fxReverbDamp, 0.4f) + avg (fxModReverbDampSum) * 0.35f);
-        fxp.reverbPreDelayMs = juce::jlimit (0.0f, 200.0f, loadf (params->fxReverbPreDelayMs, 0.0f));
-        fxp.reverbWidth01 = juce::jlimit (0.0f, 1.0f, loadf (params->fxReverbWidth, 1.0f));
-        fxp.reverbLowCutHz = juce::jlimit (20.0f, 2000.0f, loadf (params->fxReverbLowCutHz, 40.0f));
-        fxp.reverbHighCutHz = juce::jlimit (2000.0f, 20000.0f, loadf (params->fxReverbHighCutHz, 16000.0f));
-        fxp.reverbQuality = loadi (params->fxReverbQuality, (int) params::fx::reverb::hi);
-
-        fxp.distEnable = loadb (params->fxDistEnable, false);
-        fxp.distMix01 = juce::jlimit (0.0f, 1.0f, loadf (params->fxDistMix, 0.0f) + avg (fxModDistMixSum));
-        fxp.distType = loadi (params->fxDistType, (int) params::fx::dist::tanh);
-        fxp.distDriveDb = juce::jlimit (-24.0f, 36.0f, loadf (params->fxDistDriveDb, 0.0f) + avg (fxModDistDriveSum) * 12.0f);
-        fxp.distTone01 = juce::jlimit (0.0f, 1.0f, loadf (params->fxDistTone, 0.5f) + avg (fxModDistToneSum) * 0.35f);
-        fxp.distPostLPHz = juce::jlimit (800.0f, 20000.0f, loadf (params->fxDistPostLPHz, 18000.0f));
-        fxp.distOutputTrimDb = juce::jlimit (-24.0f, 24.0f, loadf (params->fxDistOutputTrimDb, 0.0f));
-
-        fxp.phaserEnable = loadb (params->fxPhaserEnable, false);
-        fxp.phaserMix01 = juce::jlimit (0.0f, 1.0f, loadf (params->fxPhaserMix, 0.0f) + avg (fxModPhaserMixSum));
-        fxp.phaserRateHz = juce::jlimit (0.01f, 20.0f, loadf (params->fxPhaserRateHz, 0.35f) * std::exp2 (avg (fxModPhaserRateSum) * 2.0f));
-        fxp.phaserDepth01 = juce::jlimit (0.0f, 1.0f, loadf (params->fxPhaserDepth, 0.6f) + avg (fxModPhaserDepthSum) * 0.35f);
-        fxp.phaserCentreHz = juce::jlimit (20.0f, 18000.0f, loadf (params->fxPhaserCentreHz, 1000.0f));
-        fxp.phaserFeedback = juce::jlimit (-0.95f, 0.95f, loadf (params->fxPhaserFeedback, 0.2f) + avg (fxModPhaserFeedbackSum) * 0.3f);
-        fxp.phaserStages = loadi (params->fxPhaserStages, 1);
-        fxp.phaserStereo01 = juce::jlimit (0.0f, 1.0f, loadf (params->fxPhaserStereo, 1.0f));
-
-        fxp.octaverEnable = loadb (params->fxOctEnable, false);
-        fxp.octaverMix01 = juce::jlimit (0.0f, 1.0f, loadf (params->fxOctMix, 0.0f) + avg (fxModOctMixSum));
-        fxp.octaverSubLevel01 = juce::jlimit (0.0f, 1.0f, loadf (params->fxOctSubLevel, 0.5f) + avg (fxModOctAmountSum) * 0.4f);
-        fxp.octaverBlend01 = juce::jlimit (0.0f, 1.0f, loadf (params->fxOctBlend, 0.5f));
-        fxp.octaverSensitivity01 = juce::jlimit (0.0f, 1.0f, loadf (params->fxOctSensitivity, 0.5f));
-        fxp.octaverTone01 = juce::jlimit (0.0f, 1.0f, loadf (params->fxOctTone, 0.5f));
+
+        auto fxp = bc.fx;
+        const float fxMorph = juce::jlimit (0.0f, 1.0f, bc.fxGlobalMorph + avg (modSum[(size_t) params::mod::dstFxGlobalMorph]) * 0.45f);
+
+        fxp.chorusMix01 = juce::jlimit (0.0f, 1.0f, bc.fx.chorusMix01 + avg (modSum[(size_t) params::mod::dstFxChorusMix]));
+        fxp.chorusRateHz = juce::jlimit (0.01f, 10.0f, bc.fx.chorusRateHz * std::exp2 (avg (modSum[(size_t) params::mod::dstFxChorusRate]) * 2.0f));
+        fxp.chorusDepthMs = juce::jlimit (0.0f, 25.0f, bc.fx.chorusDepthMs + avg (modSum[(size_t) params::mod::dstFxChorusDepth]) * 8.0f);
+
+        fxp.delayMix01 = juce::jlimit (0.0f, 1.0f, bc.fx.delayMix01 + avg (modSum[(size_t) params::mod::dstFxDelayMix]));
+        fxp.delayTimeMs = juce::jlimit (1.0f, 4000.0f, bc.fx.delayTimeMs * std::exp2 (avg (modSum[(size_t) params::mod::dstFxDelayTime]) * 2.0f));
+        fxp.delayFeedback01 = juce::jlimit (0.0f, 0.98f, bc.fx.delayFeedback01 + avg (modSum[(size_t) params::mod::dstFxDelayFeedback]) * 0.35f);
+
+        fxp.reverbMix01 = juce::jlimit (0.0f, 1.0f, bc.fx.reverbMix01 + avg (modSum[(size_t) params::mod::dstFxReverbMix]));
+        fxp.reverbSize01 = juce::jlimit (0.0f, 1.0f, bc.fx.reverbSize01 + avg (modSum[(size_t) params::mod::dstFxReverbSize]) * 0.35f);
+        fxp.reverbDamp01 = juce::jlimit (0.0f, 1.0f, bc.fx.reverbDamp01 + avg (modSum[(size_t) params::mod::dstFxReverbDamp]) * 0.35f);
+
+        fxp.distMix01 = juce::jlimit (0.0f, 1.0f, bc.fx.distMix01 + avg (modSum[(size_t) params::mod::dstFxDistMix]));
+        fxp.distDriveDb = juce::jlimit (-24.0f, 36.0f, bc.fx.distDriveDb + avg (modSum[(size_t) params::mod::dstFxDistDrive]) * 12.0f);
+        fxp.distTone01 = juce::jlimit (0.0f, 1.0f, bc.fx.distTone01 + avg (modSum[(size_t) params::mod::dstFxDistTone]) * 0.35f);
+
+        fxp.phaserMix01 = juce::jlimit (0.0f, 1.0f, bc.fx.phaserMix01 + avg (modSum[(size_t) params::mod::dstFxPhaserMix]));
+        fxp.phaserRateHz = juce::jlimit (0.01f, 20.0f, bc.fx.phaserRateHz * std::exp2 (avg (modSum[(size_t) params::mod::dstFxPhaserRate]) * 2.0f));
+        fxp.phaserDepth01 = juce::jlimit (0.0f, 1.0f, bc.fx.phaserDepth01 + avg (modSum[(size_t) params::mod::dstFxPhaserDepth]) * 0.35f);
+        fxp.phaserFeedback = juce::jlimit (-0.95f, 0.95f, bc.fx.phaserFeedback + avg (modSum[(size_t) params::mod::dstFxPhaserFeedback]) * 0.3f);
+
+        fxp.octaverMix01 = juce::jlimit (0.0f, 1.0f, bc.fx.octaverMix01 + avg (modSum[(size_t) params::mod::dstFxOctaverMix]));
+        fxp.octaverSubLevel01 = juce::jlimit (0.0f, 1.0f, bc.fx.octaverSubLevel01 + avg (modSum[(size_t) params::mod::dstFxOctaverAmount]) * 0.4f);
 
         // FX Morph (global one-knob): broad macro for movement/space/aggression.
         if (fxMorph > 0.0f)
@@ -1906,31 +2253,35 @@ void MonoSynthEngine::render (juce::AudioBuffer<float>& buffer, int startSample,
             fxp.octaverMix01 = juce::jlimit (0.0f, 1.0f, fxp.octaverMix01 + 0.12f * fxMorph);
         }
 
-        const auto fxOrder = loadi (params->fxGlobalOrder, (int) params::fx::global::orderFixedA);
-        const auto fxOs = loadi (params->fxGlobalOversample, (int) params::fx::global::osOff);
-        const auto fxRoute = loadi (params->fxGlobalRoute, (int) params::fx::global::routeSerial);
+        const auto fxOrder = bc.fxOrder;
+        const auto fxOs = bc.fxOs;
+        const auto fxRoute = bc.fxRoute;
 
-        const bool xtraEnabled = loadb (params->fxXtraEnable, false);
-        const auto xtraMix = juce::jlimit (0.0f, 1.0f, loadf (params->fxXtraMix, 0.0f) + avg (fxModXtraMixSum) * 0.45f);
+        const auto xtraEnabled = bc.xtraEnabled;
+        const auto xtraMix = juce::jlimit (0.0f, 1.0f, bc.fxXtraMix + avg (modSum[(size_t) params::mod::dstFxXtraMix]) * 0.45f);
         setTargetIfChanged (fxXtraMixSm, xtraMix);
-        setTargetIfChanged (fxXtraFlangerSm, juce::jlimit (0.0f, 1.0f, loadf (params->fxXtraFlangerAmount, 0.0f) + avg (fxModXtraFlangerSum) * 0.5f));
-        setTargetIfChanged (fxXtraTremoloSm, juce::jlimit (0.0f, 1.0f, loadf (params->fxXtraTremoloAmount, 0.0f) + avg (fxModXtraTremoloSum) * 0.5f));
-        setTargetIfChanged (fxXtraAutopanSm, juce::jlimit (0.0f, 1.0f, loadf (params->fxXtraAutopanAmount, 0.0f) + avg (fxModXtraAutopanSum) * 0.5f));
-        setTargetIfChanged (fxXtraSaturatorSm, juce::jlimit (0.0f, 1.0f, loadf (params->fxXtraSaturatorAmount, 0.0f) + avg (fxModXtraSaturatorSum) * 0.45f));
-        setTargetIfChanged (fxXtraClipperSm, juce::jlimit (0.0f, 1.0f, loadf (params->fxXtraClipperAmount, 0.0f) + avg (fxModXtraClipperSum) * 0.45f));
-        setTargetIfChanged (fxXtraWidthSm, juce::jlimit (0.0f, 1.0f, loadf (params->fxXtraWidthAmount, 0.0f) + avg (fxModXtraWidthSum) * 0.45f));
-        setTargetIfChanged (fxXtraTiltSm, juce::jlimit (0.0f, 1.0f, loadf (params->fxXtraTiltAmount, 0.0f) + avg (fxModXtraTiltSum) * 0.45f));
-        setTargetIfChanged (fxXtraGateSm, juce::jlimit (0.0f, 1.0f, loadf (params->fxXtraGateAmount, 0.0f) + avg (fxModXtraGateSum) * 0.45f));
-        setTargetIfChanged (fxXtraLofiSm, juce::jlimit (0.0f, 1.0f, loadf (params->fxXtraLofiAmount, 0.0f) + avg (fxModXtraLofiSum) * 0.45f));
-        setTargetIfChanged (fxXtraDoublerSm, juce::jlimit (0.0f, 1.0f, loadf (params->fxXtraDoublerAmount, 0.0f) + avg (fxModXtraDoublerSum) * 0.45f));
+        setTargetIfChanged (fxXtraFlangerSm, juce::jlimit (0.0f, 1.0f, bc.fxXtraFlangerAmount + avg (modSum[(size_t) params::mod::dstFxXtraFlangerAmount]) * 0.5f));
+        setTargetIfChanged (fxXtraTremoloSm, juce::jlimit (0.0f, 1.0f, bc.fxXtraTremoloAmount + avg (modSum[(size_t) params::mod::dstFxXtraTremoloAmount]) * 0.5f));
+        setTargetIfChanged (fxXtraAutopanSm, juce::jlimit (0.0f, 1.0f, bc.fxXtraAutopanAmount + avg (modSum[(size_t) params::mod::dstFxXtraAutopanAmount]) * 0.5f));
+        setTargetIfChanged (fxXtraSaturatorSm, juce::jlimit (0.0f, 1.0f, bc.fxXtraSaturatorAmount + avg (modSum[(size_t) params::mod::dstFxXtraSaturatorAmount]) * 0.45f));
+        setTargetIfChanged (fxXtraClipperSm, juce::jlimit (0.0f, 1.0f, bc.fxXtraClipperAmount + avg (modSum[(size_t) params::mod::dstFxXtraClipperAmount]) * 0.45f));
+        setTargetIfChanged (fxXtraWidthSm, juce::jlimit (0.0f, 1.0f, bc.fxXtraWidthAmount + avg (modSum[(size_t) params::mod::dstFxXtraWidthAmount]) * 0.45f));
+        setTargetIfChanged (fxXtraTiltSm, juce::jlimit (0.0f, 1.0f, bc.fxXtraTiltAmount + avg (modSum[(size_t) params::mod::dstFxXtraTiltAmount]) * 0.45f));
+        setTargetIfChanged (fxXtraGateSm, juce::jlimit (0.0f, 1.0f, bc.fxXtraGateAmount + avg (modSum[(size_t) params::mod::dstFxXtraGateAmount]) * 0.45f));
+        setTargetIfChanged (fxXtraLofiSm, juce::jlimit (0.0f, 1.0f, bc.fxXtraLofiAmount + avg (modSum[(size_t) params::mod::dstFxXtraLofiAmount]) * 0.45f));
+        setTargetIfChanged (fxXtraDoublerSm, juce::jlimit (0.0f, 1.0f, bc.fxXtraDoublerAmount + avg (modSum[(size_t) params::mod::dstFxXtraDoublerAmount]) * 0.45f));
 
         auto* outL = buffer.getWritePointer (0, startSample);
         auto* outR = (buffer.getNumChannels() > 1) ? buffer.getWritePointer (1, startSample) : nullptr;
 
-        for (int i = 0; i < numSamples; ++i)
+        // The dry copy only feeds the parallel route.
+        if (fxRoute == (int) params::fx::global::routeParallel)
         {
-            fxDryL[(size_t) i] = outL[i];
-            fxDryR[(size_t) i] = (outR != nullptr) ? outR[i] : outL[i];
+            for (int i = 0; i < numSamples; ++i)
+            {
+                fxDryL[(size_t) i] = outL[i];
+                fxDryR[(size_t) i] = (outR != nullptr) ? outR[i] : outL[i];
+            }
         }
 
         fxChain.process (buffer, startSample, numSamples, fxOs, fxOrder, fxp);
@@ -1943,6 +2294,15 @@ void MonoSynthEngine::render (juce::AudioBuffer<float>& buffer, int startSample,
                 fxParallelR[(size_t) i] = fxDryR[(size_t) i];
             }
 
+            // Line the dry up with the rack output.
+            if (const auto fxLatency = fxChain.getLatencySamples(); fxLatency > 0)
+            {
+                fxParallelAlignL.writeBlock (fxParallelL.data(), numSamples);
+                fxParallelAlignR.writeBlock (fxParallelR.data(), numSamples);
+                fxParallelAlignL.readBlock<dsp::DelayLine::Interpolation::linear> (fxParallelL.data(), numSamples, (float) fxLatency);
+                fxParallelAlignR.readBlock<dsp::DelayLine::Interpolation::linear> (fxParallelR.data(), numSamples, (float) fxLatency);
+            }
+
             processXtraBlock (fxParallelL.data(), fxParallelR.data(), numSamples, xtraEnabled, xtraMix);
 
             for (int i = 0; i < numSamples; ++i)
@@ -7,15 +7,23 @@
 
 #include "../Params.h"
 #include "../Util/Math.h"
+#include "../dsp/DelayLine.h"
 #include "../dsp/DestroyChain.h"
+#include "../dsp/DriftGenerator.h"
 #include "../dsp/FxChain.h"
+#include "../dsp/HarmonicSeries.h"
 #include "../dsp/Lfo.h"
-#include "../dsp/PolyBlepOscillator.h"
+#include "../dsp/OscillatorBank.h"
+#include "../dsp/PitchConverter.h"
 #include "../dsp/SvfFilter.h"
+#include "../dsp/UnisonOscillator.h"
 #include "../dsp/ToneEQ.h"
 #include "../dsp/WavetableSet.h"
 #include "../dsp/WaveShaper.h"
+#include "LinearPhaseEqDesigner.h"
 #include "NoteStackMono.h"
+#include "VoicePool.h"
+#include "WavetableBuilder.h"
 
 namespace ies::engine
 {
@@ -27,6 +35,9 @@ public:
         std::atomic<float>* monoEnvMode = nullptr;
         std::atomic<float>* glideEnable = nullptr;
         std::atomic<float>* glideTimeMs = nullptr;
+        std::atomic<float>* voiceMode = nullptr;
+        std::atomic<float>* polyVoices = nullptr;
+        std::atomic<float>* wtInterp = nullptr;
 
         std::atomic<float>* osc1Wave = nullptr;
         std::atomic<float>* osc1Level = nullptr;
@@ -34,6 +45,10 @@ public:
         std::atomic<float>* osc1Fine = nullptr;
         std::atomic<float>* osc1Phase = nullptr;
         std::atomic<float>* osc1Detune = nullptr;
+        std::atomic<float>* osc1Unison = nullptr;
+        std::atomic<float>* osc1UnisonDetune = nullptr;
+        std::atomic<float>* osc1UnisonSpread = nullptr;
+        std::atomic<float>* osc1UnisonBlend = nullptr;
 
         std::atomic<float>* osc2Wave = nullptr;
         std::atomic<float>* osc2Level = nullptr;
@@ -41,6 +56,10 @@ public:
         std::atomic<float>* osc2Fine = nullptr;
         std::atomic<float>* osc2Phase = nullptr;
         std::atomic<float>* osc2Detune = nullptr;
+        std::atomic<float>* osc2Unison = nullptr;
+        std::atomic<float>* osc2UnisonDetune = nullptr;
+        std::atomic<float>* osc2UnisonSpread = nullptr;
+        std::atomic<float>* osc2UnisonBlend = nullptr;
         std::atomic<float>* osc2Sync = nullptr;
 
         std::atomic<float>* osc3Wave = nullptr;
@@ -49,6 +68,10 @@ public:
         std::atomic<float>* osc3Fine = nullptr;
         std::atomic<float>* osc3Phase = nullptr;
         std::atomic<float>* osc3Detune = nullptr;
+        std::atomic<float>* osc3Unison = nullptr;
+        std::atomic<float>* osc3UnisonDetune = nullptr;
+        std::atomic<float>* osc3UnisonSpread = nullptr;
+        std::atomic<float>* osc3UnisonBlend = nullptr;
 
         std::atomic<float>* noiseEnable = nullptr;
         std::atomic<float>* noiseLevel = nullptr;
@@ -68,6 +91,8 @@ public:
         std::atomic<float>* clipMix = nullptr;
 
         std::atomic<float>* destroyOversample = nullptr;
+        std::atomic<float>* foldAntiAlias = nullptr;
+        std::atomic<float>* clipAntiAlias = nullptr;
 
         std::atomic<float>* modMode = nullptr;
         std::atomic<float>* modAmount = nullptr;
@@ -86,6 +111,7 @@ public:
         std::atomic<float>* shaperPlacement = nullptr;
         std::atomic<float>* shaperDriveDb = nullptr;
         std::atomic<float>* shaperMix = nullptr;
+        std::atomic<float>* shaperAntiAlias = nullptr;
         std::array<std::atomic<float>*, (size_t) params::shaper::numPoints> shaperPoints {};
 
         std::atomic<float>* filterType = nullptr;
@@ -104,6 +130,7 @@ public:
         std::atomic<float>* toneHighCutHz = nullptr;
         std::atomic<float>* toneLowCutSlope = nullptr;
         std::atomic<float>* toneHighCutSlope = nullptr;
+        std::atomic<float>* tonePhaseMode = nullptr;
 
         std::atomic<float>* tonePeak1Enable = nullptr;
         std::atomic<float>* tonePeak1Type = nullptr;
@@ -197,6 +224,8 @@ public:
         std::array<std::atomic<float>*, (size_t) params::mod::numSlots> modSlotSrc {};
         std::array<std::atomic<float>*, (size_t) params::mod::numSlots> modSlotDst {};
         std::array<std::atomic<float>*, (size_t) params::mod::numSlots> modSlotDepth {};
+        std::atomic<float>* modControlRate = nullptr;
+        std::atomic<float>* modAudioRateFast = nullptr;
 
         // FX global
         std::atomic<float>* fxGlobalMix = nullptr;
@@ -289,20 +318,36 @@ public:
 
     void setParamPointers (const ParamPointers* ptrs) { params = ptrs; }
     void setTemplateWavetables (const std::array<ies::dsp::WavetableSet, 10>* bank) noexcept { templateBank = bank; }
-    void setCustomWavetable (int oscIndex, const ies::dsp::WavetableSet* table) noexcept
+    // Draw-mode tables are acquired from these once per render segment; null sources fall back to Saw.
+    void setCustomWavetableSource (int oscIndex, WavetableTripleBuffer* source) noexcept
     {
         if (oscIndex < 0 || oscIndex >= 3)
             return;
-        customTables[(size_t) oscIndex].store (table, std::memory_order_release);
+        customSources[(size_t) oscIndex] = source;
     }
 
     void prepare (double sampleRate, int maxBlockSize);
     void reset();
 
+    // Capture block-rate controls (smoother targets, mod slots, LFO setup, FX params) once per host block.
+    // Call before the first render() of each processBlock; render segments then only run the audio loops.
+    void beginBlock();
+
+    // Marks the host block as done: a render() without a fresh beginBlock() captures the controls itself.
+    void endBlock() noexcept { blockControlsReady = false; }
+
     // Render audio into buffer for [startSample, startSample+numSamples).
+    // Uses the controls captured by the last beginBlock().
     // Optional preDestroyOut captures the signal right before the Destroy chain.
     void render (juce::AudioBuffer<float>& buffer, int startSample, int numSamples, float* preDestroyOut = nullptr);
 
+    // Output delay in samples, fixed after prepare(): the linear-phase Tone latency (the minimum-phase path is
+    // delayed to match) plus the FX rack's.
+    int getLatencySamples() const noexcept
+    {
+        return toneLinearDesigner.getLatencySamples() + fxChain.getLatencySamples();
+    }
+
     void setHostBpm (double bpm) noexcept;
     void setFxCustomOrder (const std::array<int, (size_t) ies::dsp::FxChain::numBlocks>& order) noexcept
     {
@@ -317,6 +362,7 @@ public:
     void setAftertouch (int value0to127) noexcept;
     void setPitchBend (int value0to16383) noexcept;
     const ies::dsp::FxChain::Meters& getFxMeters() const noexcept { return fxChain.getMeters(); }
+    void setFxMetersEnabled (bool shouldMeter) noexcept { fxChain.setMetersEnabled (shouldMeter); }
 
 private:
     struct LinearRamp final
@@ -361,6 +407,111 @@ private:
         int samplesLeft = 0;
     };
 
+    struct ModSlot final
+    {
+        int src = 0;
+        int dst = 0;
+        float depth = 0.0f;
+    };
+
+    // One active matrix route: source index, destination index and depth pre-multiplied by the destination span.
+    struct ModRoute final
+    {
+        int src = 0;
+        int dst = 0;
+        float scale = 0.0f;
+    };
+
+    static constexpr int numModSources = (int) params::mod::srcLast + 1;
+    static constexpr int numModDests = (int) params::mod::dstLast + 1;
+
+    // Per-block oscillator settings; levels are ramped through oscLevelSm in render().
+    struct OscBlockParams final
+    {
+        int wave = (int) params::osc::saw;
+        float level = 0.0f;
+        int coarse = 0;
+        float fine = 0.0f;
+        float detune01 = 0.0f;
+        int unisonVoices = 1;
+        float unisonDetune = 0.0f;
+        float unisonBlend = 0.0f;
+    };
+
+    // Block-rate control snapshot, shared by all render segments of one host block.
+    struct BlockControls final
+    {
+        int modMode = (int) params::destroy::ringMod;
+        bool modNoteSync = false;
+        int crushBits = 16;
+        int crushDownsample = 1;
+        bool pitchLockEnabled = false;
+        int pitchLockMode = (int) params::destroy::pitchModeHybrid;
+        int destroyOsFactor = 1;
+        bool destroyOsAuto = false;
+        int foldAntiAlias = (int) params::destroy::aaOff;
+        int clipAntiAlias = (int) params::destroy::aaOff;
+        int shaperAntiAlias = (int) params::destroy::aaOff;
+
+        bool shaperEnabled = false;
+        bool shaperPre = true;
+        bool destroyPostFilter = false;
+        bool tonePreFilter = false;
+        bool keyTrack = false;
+        int filterType = (int) params::filter::lp;
+        bool toneOn = false;
+        bool toneLinearPhase = false;
+        bool noiseEnabled = false;
+
+        bool polyMode = false;
+        int polyVoices = VoicePool::maxVoices;
+        bool wtCubic = false;
+
+        std::array<OscBlockParams, 3> osc {};
+        bool osc2Sync = false;
+        float osc2Phase = 0.0f;
+
+        float macro1 = 0.0f;
+        float macro2 = 0.0f;
+        float msegOut = 0.0f;
+        std::array<ModSlot, (size_t) params::mod::numSlots> slots {};
+
+        int modInterval = 1;
+        bool modAudioRateFast = false;
+
+        // Compiled from slots (rebuilt only when a slot or the rate setup changes): dense lists of active routes.
+        // Fast routes run every sample; slow routes run once per control tick and are interpolated.
+        std::array<ModRoute, (size_t) params::mod::numSlots> fastRoutes {};
+        std::array<ModRoute, (size_t) params::mod::numSlots> slowRoutes {};
+        std::array<int, (size_t) params::mod::numSlots> fastDests {};
+        std::array<int, (size_t) params::mod::numSlots> slowDests {};
+        int numFastRoutes = 0;
+        int numSlowRoutes = 0;
+        int numFastDests = 0;
+        int numSlowDests = 0;
+
+        // FX base values (modulated fields are unclamped; render() adds offsets and clamps).
+        ies::dsp::FxChain::RuntimeParams fx;
+        float fxGlobalMorph = 0.0f;
+        int fxOrder = (int) params::fx::global::orderFixedA;
+        int fxOs = (int) params::fx::global::osOff;
+        int fxRoute = (int) params::fx::global::routeSerial;
+
+        bool xtraEnabled = false;
+        float fxXtraMix = 0.0f;
+        float fxXtraFlangerAmount = 0.0f;
+        float fxXtraTremoloAmount = 0.0f;
+        float fxXtraAutopanAmount = 0.0f;
+        float fxXtraSaturatorAmount = 0.0f;
+        float fxXtraClipperAmount = 0.0f;
+        float fxXtraWidthAmount = 0.0f;
+        float fxXtraTiltAmount = 0.0f;
+        float fxXtraGateAmount = 0.0f;
+        float fxXtraLofiAmount = 0.0f;
+        float fxXtraDoublerAmount = 0.0f;
+    };
+
+    void rebuildModRoutes() noexcept;
     void updateAmpEnvParams();
     void updateFilterEnvParams();
     void applyNoteChange (int newMidiNote, bool gateWasAlreadyOn);
@@ -368,10 +519,26 @@ private:
     void resetLfoPhasesFromParams();
     void resetXtraState();
     void processXtraBlock (float* left, float* right, int numSamples, bool enabled, float mix01) noexcept;
-
-    float computeDriftCents (juce::Random& rng, float& driftState, float alpha, float detuneAmount01) noexcept;
+    int autoDestroyOsFactor (float bandwidthHz, int numSamples) noexcept;
+    void updatePitchLockWeights (int mode, float noteHz) noexcept;
+    void loadTonePeaks (bool snapToTarget) noexcept;
+    bool toneParamsSmoothing() const noexcept;
+    void skipToneSmoothers (int numSamples) noexcept;
+    void pushToneParams() noexcept;
+    dsp::ToneEQ::BandParams tonePeakParams (size_t index) const noexcept;
+    LinearPhaseEqDesigner::Settings makeToneLinearSettings (bool flat) const noexcept;
+    void primeToneLinearConvolver() noexcept;
+    void runDestroyPath (int factor, float* x, int numSamples, const dsp::DestroyChain::BlockInputs& in) noexcept;
 
     const ParamPointers* params = nullptr;
+    BlockControls blockControls;
+    bool blockControlsReady = false;
+    bool modRoutesValid = false;
+
+    // Control-rate matrix state; kept across render segments so ticks don't depend on MIDI segmentation.
+    std::array<float, (size_t) numModDests> modCtrlValue {};
+    std::array<float, (size_t) numModDests> modCtrlStep {};
+    int modCtrlCountdown = 0;
 
     double sampleRateHz = 44100.0;
     float hostBpm = 120.0f;
@@ -379,6 +546,9 @@ private:
     NoteStackMono noteStack;
     bool gateOn = false;
 
+    // Poly mode: the pool renders oscillators/filter/amp per voice; the mono path above still drives mod sources.
+    VoicePool voicePool;
+
     LinearRamp noteGlide;
 
     float velocityGain = 0.0f;
@@ -417,77 +587,22 @@ private:
     int toneLowCutSlope = (int) params::tone::slope24;
     int toneHighCutSlope = (int) params::tone::slope24;
 
-    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> tonePeak1FreqHzSm;
-    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> tonePeak1GainDbSm;
-    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> tonePeak1QSm;
-    bool tonePeak1On = true;
-    int tonePeak1Type = (int) params::tone::peakBell;
-    bool tonePeak1DynOn = false;
-    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> tonePeak1DynRangeDbSm;
-    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> tonePeak1DynThresholdDbSm;
-
-    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> tonePeak2FreqHzSm;
-    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> tonePeak2GainDbSm;
-    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> tonePeak2QSm;
-    bool tonePeak2On = true;
-    int tonePeak2Type = (int) params::tone::peakBell;
-    bool tonePeak2DynOn = false;
-    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> tonePeak2DynRangeDbSm;
-    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> tonePeak2DynThresholdDbSm;
-
-    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> tonePeak3FreqHzSm;
-    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> tonePeak3GainDbSm;
-    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> tonePeak3QSm;
-    bool tonePeak3On = true;
-    int tonePeak3Type = (int) params::tone::peakBell;
-    bool tonePeak3DynOn = false;
-    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> tonePeak3DynRangeDbSm;
-    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> tonePeak3DynThresholdDbSm;
-
-    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> tonePeak4FreqHzSm;
-    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> tonePeak4GainDbSm;
-    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> tonePeak4QSm;
-    bool tonePeak4On = false;
-    int tonePeak4Type = (int) params::tone::peakBell;
-    bool tonePeak4DynOn = false;
-    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> tonePeak4DynRangeDbSm;
-    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> tonePeak4DynThresholdDbSm;
-
-    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> tonePeak5FreqHzSm;
-    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> tonePeak5GainDbSm;
-    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> tonePeak5QSm;
-    bool tonePeak5On = false;
-    int tonePeak5Type = (int) params::tone::peakBell;
-    bool tonePeak5DynOn = false;
-    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> tonePeak5DynRangeDbSm;
-    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> tonePeak5DynThresholdDbSm;
-
-    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> tonePeak6FreqHzSm;
-    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> tonePeak6GainDbSm;
-    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> tonePeak6QSm;
-    bool tonePeak6On = false;
-    int tonePeak6Type = (int) params::tone::peakBell;
-    bool tonePeak6DynOn = false;
-    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> tonePeak6DynRangeDbSm;
-    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> tonePeak6DynThresholdDbSm;
-
-    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> tonePeak7FreqHzSm;
-    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> tonePeak7GainDbSm;
-    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> tonePeak7QSm;
-    bool tonePeak7On = false;
-    int tonePeak7Type = (int) params::tone::peakBell;
-    bool tonePeak7DynOn = false;
-    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> tonePeak7DynRangeDbSm;
-    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> tonePeak7DynThresholdDbSm;
-
-    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> tonePeak8FreqHzSm;
-    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> tonePeak8GainDbSm;
-    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> tonePeak8QSm;
-    bool tonePeak8On = false;
-    int tonePeak8Type = (int) params::tone::peakBell;
-    bool tonePeak8DynOn = false;
-    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> tonePeak8DynRangeDbSm;
-    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> tonePeak8DynThresholdDbSm;
+    // Tone peak nodes, in params::tone order.
+    struct TonePeakState
+    {
+        bool on = false;
+        int type = (int) params::tone::peakBell;
+        bool dynOn = false;
+        juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> freqHzSm;
+        juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> gainDbSm;
+        juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> qSm;
+        juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> dynRangeDbSm;
+        juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> dynThresholdDbSm;
+    };
+
+    std::array<TonePeakState, (size_t) params::tone::maxPeaks> tonePeaks;
+
+    std::array<juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear>, 3> oscLevelSm;
 
     juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> noiseLevelSm;
     juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> noiseColorSm;
@@ -516,12 +631,13 @@ private:
     juce::uint32 modRngState = 0x52414e44u; // "RAND" (seed for Random mod source)
     float randomNoteValue = 0.0f; // unipolar 0..1, refreshed on note-on
 
-    dsp::PolyBlepOscillator osc1;
-    dsp::PolyBlepOscillator osc2;
-    dsp::PolyBlepOscillator osc3;
+    // osc1..3 in lanes 0..2; lane 3 is spare.
+    dsp::OscillatorBank oscBank;
+    std::array<dsp::UnisonOscillator, 3> unison;
+    dsp::PitchConverter pitchConverter;
 
     const std::array<ies::dsp::WavetableSet, 10>* templateBank = nullptr;
-    std::array<std::atomic<const ies::dsp::WavetableSet*>, 3> customTables { { nullptr, nullptr, nullptr } };
+    std::array<WavetableTripleBuffer*, 3> customSources {};
 
     dsp::Lfo lfo1;
     dsp::Lfo lfo2;
@@ -529,16 +645,24 @@ private:
     dsp::DestroyChain destroyBase;
     dsp::DestroyChain destroyOs2;
     dsp::DestroyChain destroyOs4;
+    dsp::DestroyChain destroyOs8;
     dsp::FxChain fxChain;
 
     juce::dsp::Oversampling<float> destroyOversampling2x { 1, 1, juce::dsp::Oversampling<float>::filterHalfBandPolyphaseIIR, true, false };
     juce::dsp::Oversampling<float> destroyOversampling4x { 1, 2, juce::dsp::Oversampling<float>::filterHalfBandPolyphaseIIR, true, false };
-    int destroyOversamplingFactorPrev = 1;
+    juce::dsp::Oversampling<float> destroyOversampling8x { 1, 3, juce::dsp::Oversampling<float>::filterHalfBandPolyphaseIIR, true, false };
+
+    // Active destroy oversampling factor. On a change the previous path keeps running for a short crossfade.
+    int destroyOsFactor = 1;
+    int destroyOsFadeFrom = 1;
+    int destroyOsFadeLength = 1;
+    int destroyOsFadeRemaining = 0;
+    int destroyOsAutoHold = 0; // samples before Auto may step down
+    bool destroyOsStarted = false;
 
     // FX Xtra state.
-    std::vector<float> xtraDelayL;
-    std::vector<float> xtraDelayR;
-    int xtraDelayWrite = 0;
+    dsp::DelayLine xtraDelayL;
+    dsp::DelayLine xtraDelayR;
     float xtraFlangerPhase = 0.0f;
     float xtraTremoloPhase = 0.0f;
     float xtraAutopanPhase = 0.0f;
@@ -556,16 +680,20 @@ private:
     std::vector<float> fxDryR;
     std::vector<float> fxParallelL;
     std::vector<float> fxParallelR;
+    dsp::DelayLine fxParallelAlignL; // parallel dry, delayed to match the rack
+    dsp::DelayLine fxParallelAlignR;
+    int fxRoutePrev = (int) params::fx::global::routeSerial;
 
     // Scratch buffers (allocated in prepare; no allocations in render).
     juce::AudioBuffer<float> destroyBuffer;
+    juce::AudioBuffer<float> destroyFadeBuffer;
     std::vector<float> ampEnvBuf;
     std::vector<float> filterEnvBuf;
     std::vector<float> destroyNoteHz;
-    std::vector<float> destroyFoldDriveDb;
+    std::vector<float> destroyFoldDrive; // linear gain
     std::vector<float> destroyFoldAmount;
     std::vector<float> destroyFoldMix;
-    std::vector<float> destroyClipDriveDb;
+    std::vector<float> destroyClipDrive; // linear gain
     std::vector<float> destroyClipAmount;
     std::vector<float> destroyClipMix;
     std::vector<float> destroyModAmount;
@@ -574,10 +702,24 @@ private:
     std::vector<float> destroyCrushMix;
     std::vector<float> shaperDriveDb;
     std::vector<float> shaperMix;
+    std::vector<float> pitchLockPhaseBuf; // phases in, lock tone out
+    std::vector<float> pitchLockEnvBuf;
     std::vector<float> filterModCutoffSemis;
     std::vector<float> filterModResAdd;
+    std::vector<float> filterCutoffBuf; // final mono cutoff/resonance handed to the SVF block
+    std::vector<float> filterResBuf;
+    std::array<std::vector<float>, 3> oscOutBuf;
+    std::array<std::vector<float>, 3> oscLevelBuf;
+    std::vector<float> noiseBuf;
+    std::vector<float> polyBendRatio;
+    std::vector<float> polyCutoffHz;
+    std::vector<float> polyEnvSemis;
+    std::vector<float> polyResonance;
     dsp::SvfFilter filter;
     dsp::ToneEQ toneEq;
+    dsp::PartitionedConvolver toneLinearConvolver;
+    dsp::DelayLine toneLinearAlign; // Tone input, read back with the linear-phase latency outside Linear mode
+    LinearPhaseEqDesigner toneLinearDesigner;
     dsp::WaveShaper shaper;
 
     std::array<float, (size_t) params::shaper::numPoints> shaperPointsCache
@@ -587,17 +729,18 @@ private:
 
     int toneCoeffCountdown = 0;
     bool toneEnabledPrev = false;
+    bool toneLinearPrev = false;
 
-    juce::Random driftRng1 { 0x13579bdf };
-    juce::Random driftRng2 { 0x2468ace0 };
-    juce::Random driftRng3 { 0x369cf012 };
-    float driftState1 = 0.0f;
-    float driftState2 = 0.0f;
-    float driftState3 = 0.0f;
+    // Lanes 0..2 drive oscillator pitch drift, lane 3 is the "Drift" mod source.
+    dsp::DriftGenerator drift;
 
     float pitchLockPhase = 0.0f;
     float pitchLockFollower = 0.0f;
     float pitchLockLowpass = 0.0f;
     float pitchLockBrightness = 0.0f;
+    dsp::HarmonicSeries pitchLockHarmonics;
+    int pitchLockWeightCountdown = 0;
+    float pitchLockBrightnessSum = 0.0f;
+    int pitchLockBrightnessCount = 0;
 };
 } // namespace ies::engine
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+namespace ies::engine
+{
+// Single-writer / single-reader triple buffer. The writer fills its back slot and swaps it into the middle; the
+// reader swaps the middle into its front slot when a newer value is there. Neither side ever touches a slot the
+// other one owns, so the reader never sees a half-written value and neither side ever waits.
+template <typename T>
+class TripleBuffer final
+{
+public:
+    // Writer side.
+    T& getWriteSlot() noexcept { return slots[(size_t) back]; }
+
+    void publish() noexcept
+    {
+        back = middle.exchange (back | dirtyBit, std::memory_order_acq_rel) & indexMask;
+    }
+
+    // Reader side. The returned value stays valid until the next acquire(); null until the first publish.
+    const T* acquire() noexcept
+    {
+        if ((middle.load (std::memory_order_relaxed) & dirtyBit) != 0)
+        {
+            front = middle.exchange (front, std::memory_order_acq_rel) & indexMask;
+            hasFront = true;
+        }
+
+        return hasFront ? &slots[(size_t) front] : nullptr;
+    }
+
+private:
+    static constexpr int indexMask = 3;
+    static constexpr int dirtyBit = 4;
+
+    std::array<T, 3> slots {};
+    std::atomic<int> middle { 1 };
+    int front = 0; // reader-owned
+    int back = 2;  // writer-owned
+    bool hasFront = false;
+};
+} // namespace ies::engine
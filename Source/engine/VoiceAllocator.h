@@ -0,0 +1,114 @@
+#pragma once
+
+#include <cstdint>
+
+namespace ies::engine
+{
+// Voice assignment for the poly voice pool. A note that is already sounding reuses its voice; otherwise a free
+// voice is taken, then the quietest released voice, then the oldest held one. Fixed capacity, no allocation.
+struct VoiceAllocator final
+{
+    static constexpr int maxVoices = 8;
+
+    void clear() noexcept
+    {
+        for (int v = 0; v < maxVoices; ++v)
+        {
+            notes[v] = -1;
+            held[v] = false;
+            active[v] = false;
+            levels[v] = 0.0f;
+            ages[v] = 0;
+        }
+        counter = 0;
+    }
+
+    // Voices beyond the new size are released rather than freed: they stay active until the caller marks them free
+    // at the end of their release, but are never handed out again while the pool is smaller.
+    void setNumVoices (int n) noexcept
+    {
+        size = n < 1 ? 1 : (n > maxVoices ? maxVoices : n);
+        for (int v = size; v < maxVoices; ++v)
+            held[v] = false;
+    }
+
+    int numVoices() const noexcept { return size; }
+
+    bool isActive (int v) const noexcept { return active[v]; }
+    bool isHeld (int v) const noexcept { return held[v]; }
+    int noteOf (int v) const noexcept { return notes[v]; }
+
+    // Returns the voice to start for this note. stolen is set when that voice was sounding a different note.
+    int noteOn (int note, bool* stolen = nullptr) noexcept
+    {
+        int pick = -1;
+
+        for (int v = 0; v < size && pick < 0; ++v)
+            if (active[v] && notes[v] == note)
+                pick = v;
+
+        for (int v = 0; v < size && pick < 0; ++v)
+            if (! active[v])
+                pick = v;
+
+        if (pick < 0)
+        {
+            for (int v = 0; v < size; ++v)
+                if (! held[v] && (pick < 0 || levels[v] < levels[pick]))
+                    pick = v;
+        }
+
+        if (pick < 0)
+        {
+            pick = 0;
+            for (int v = 1; v < size; ++v)
+                if (ages[v] < ages[pick])
+                    pick = v;
+        }
+
+        if (stolen != nullptr)
+            *stolen = active[pick] && notes[pick] != note;
+
+        notes[pick] = (int8_t) note;
+        held[pick] = true;
+        active[pick] = true;
+        ages[pick] = ++counter;
+        return pick;
+    }
+
+    // Returns the released voice, or -1 if no held voice plays this note.
+    int noteOff (int note) noexcept
+    {
+        for (int v = 0; v < size; ++v)
+        {
+            if (held[v] && notes[v] == note)
+            {
+                held[v] = false;
+                return v;
+            }
+        }
+        return -1;
+    }
+
+    // Last envelope level of a voice; used to pick the quietest released voice when stealing.
+    void setLevel (int v, float level) noexcept { levels[v] = level; }
+
+    // The voice finished its release (or was cut).
+    void markFree (int v) noexcept
+    {
+        notes[v] = -1;
+        held[v] = false;
+        active[v] = false;
+        levels[v] = 0.0f;
+    }
+
+private:
+    int8_t notes[maxVoices] { -1, -1, -1, -1, -1, -1, -1, -1 };
+    bool held[maxVoices] {};
+    bool active[maxVoices] {};
+    float levels[maxVoices] {};
+    uint32_t ages[maxVoices] {};
+    uint32_t counter = 0;
+    int size = maxVoices;
+};
+} // namespace ies::engine
@@ -0,0 +1,410 @@
+#pragma once
+
+#include <JuceHeader.h>
+
+#include <array>
+#include <cmath>
+#include <vector>
+
+#include "../Params.h"
+#include "../Util/Math.h"
+#include "../dsp/OscillatorBank.h"
+#include "../dsp/PitchConverter.h"
+#include "../dsp/SimdVec.h"
+#include "../dsp/SvfFilter.h"
+#include "VoiceAllocator.h"
+
+namespace ies::engine
+{
+// Preallocated voices for Poly mode: three oscillators, amp/filter envelopes and an SVF per voice, summed to mono
+// ahead of the shared Destroy/Tone/FX stages. Voices are grouped four to a SIMD pass: each oscillator runs one
+// OscillatorBank per group (lane = voice) and the filter runs four voices per vector. The noise helper is added once,
+// not per voice: it has its own SVF and follows the loudest voice's envelopes, so its level does not grow with the
+// number of held notes. Nothing allocates after prepare().
+class VoicePool final
+{
+public:
+    static constexpr int maxVoices = VoiceAllocator::maxVoices;
+    static constexpr int lanes = dsp::OscillatorBank::numLanes;
+    static constexpr int numGroups = maxVoices / lanes;
+    static constexpr int numOscs = 3;
+
+    // Per-sample signals shared by all voices.
+    struct BlockInputs final
+    {
+        const float* bendRatio = nullptr;              // pitch-bend frequency ratio
+        const float* oscLevel[numOscs] {};             // oscillator levels (mod matrix applied)
+        const float* noise = nullptr;                  // noise helper, added once to the voice sum
+        const float* cutoffHz = nullptr;               // base cutoff with mod matrix applied
+        const float* envSemis = nullptr;               // filter env amount
+        const float* resonance = nullptr;              // SVF resonance (already mapped from the knob)
+        bool keyTrack = false;
+        params::filter::Type filterType = params::filter::lp;
+    };
+
+    void prepare (double sampleRateHz, int maxBlockSize)
+    {
+        sampleRate = sampleRateHz > 0.0 ? (float) sampleRateHz : 44100.0f;
+        maxFrames = juce::jmax (1, maxBlockSize);
+        pitch.prepare (sampleRate);
+
+        for (auto& perOsc : banks)
+            for (auto& bank : perOsc)
+                bank.prepare (sampleRate, maxFrames);
+
+        for (auto& perOsc : oscOut)
+            for (auto& b : perOsc)
+                b.assign ((size_t) maxFrames, 0.0f);
+
+        for (auto& b : ampEnvBuf)
+            b.assign ((size_t) maxFrames, 0.0f);
+        for (auto& b : filterEnvBuf)
+            b.assign ((size_t) maxFrames, 0.0f);
+        noiseAmp.assign ((size_t) maxFrames, 0.0f);
+        noiseEnv.assign ((size_t) maxFrames, 0.0f);
+        noiseNoteHz.assign ((size_t) maxFrames, 440.0f);
+        noiseFilter.prepare (sampleRate);
+
+        for (int v = 0; v < maxVoices; ++v)
+        {
+            ampEnv[(size_t) v].setSampleRate (sampleRate);
+            filterEnv[(size_t) v].setSampleRate (sampleRate);
+        }
+
+        reset();
+    }
+
+    void reset() noexcept
+    {
+        allocator.clear();
+        for (int v = 0; v < maxVoices; ++v)
+        {
+            ampEnv[(size_t) v].reset();
+            filterEnv[(size_t) v].reset();
+        }
+        svfS1.fill (0.0f);
+        svfS2.fill (0.0f);
+        noiseFilter.reset();
+    }
+
+    // Unbent frequency of the highest held (or releasing) voice; 0 when none is sounding.
+    float getHighestNoteHz() const noexcept
+    {
+        auto hz = 0.0f;
+        for (int v = 0; v < maxVoices; ++v)
+            if (allocator.isActive (v))
+                hz = juce::jmax (hz, noteHz[(size_t) v]);
+        return hz;
+    }
+
+    void setNumVoices (int n) noexcept
+    {
+        if (n == allocator.numVoices())
+            return;
+
+        // Voices above the new count are let go like a released note and fade out through their amp release, the
+        // same way a stolen voice keeps running instead of being cut. render() frees them when the release ends.
+        const auto keep = juce::jlimit (1, maxVoices, n);
+        for (int v = keep; v < maxVoices; ++v)
+        {
+            if (! allocator.isHeld (v))
+                continue;
+
+            ampEnv[(size_t) v].noteOff();
+            filterEnv[(size_t) v].noteOff();
+        }
+
+        allocator.setNumVoices (n);
+    }
+
+    void setEnvelopeParameters (const juce::ADSR::Parameters& amp, const juce::ADSR::Parameters& filt) noexcept
+    {
+        for (int v = 0; v < maxVoices; ++v)
+        {
+            ampEnv[(size_t) v].setParameters (amp);
+            filterEnv[(size_t) v].setParameters (filt);
+        }
+    }
+
+    // Shape for oscillator k on every voice, plus its coarse/fine offset in semitones.
+    void setOscillator (int k, dsp::OscillatorBank::Shape shape, const dsp::WavetableSet* table, float offsetSemis) noexcept
+    {
+        for (auto& bank : banks[(size_t) k])
+            for (int l = 0; l < lanes; ++l)
+                bank.setShape (l, shape, table);
+
+        if (offsetSemis != oscOffsetSemis[(size_t) k])
+        {
+            oscOffsetSemis[(size_t) k] = offsetSemis;
+            oscRatio[(size_t) k] = std::exp2 (offsetSemis * (1.0f / 12.0f));
+        }
+    }
+
+    void setWavetableInterpolation (dsp::WavetableReader::Interpolation mode) noexcept
+    {
+        for (auto& oscBanks : banks)
+            for (auto& bank : oscBanks)
+                bank.setWavetableInterpolation (mode);
+    }
+
+    // Start phases applied when a free voice starts (stolen voices keep running to avoid clicks).
+    void setStartPhases (float p1, float p2, float p3) noexcept
+    {
+        startPhase = { p1, p2, p3 };
+    }
+
+    void noteOn (int midiNote, int velocity0to127) noexcept
+    {
+        const bool wasFree = [&]
+        {
+            for (int v = 0; v < allocator.numVoices(); ++v)
+                if (allocator.isActive (v) && allocator.noteOf (v) == midiNote)
+                    return false;
+            return true;
+        }();
+
+        bool stolen = false;
+        const auto v = allocator.noteOn (midiNote, &stolen);
+        const auto g = (size_t) (v / lanes);
+        const auto l = v % lanes;
+
+        if (wasFree && ! stolen)
+        {
+            for (size_t k = 0; k < (size_t) numOscs; ++k)
+                banks[k][g].setPhase (l, startPhase[k]);
+            svfS1[(size_t) v] = 0.0f;
+            svfS2[(size_t) v] = 0.0f;
+        }
+
+        baseIncrement[(size_t) v] = pitch.noteToIncrement ((float) midiNote);
+        noteHz[(size_t) v] = dsp::PitchConverter::noteToHz ((float) midiNote);
+        velocity[(size_t) v] = juce::jlimit (0.0f, 1.0f, (float) velocity0to127 / 127.0f);
+
+        ampEnv[(size_t) v].noteOn();
+        filterEnv[(size_t) v].noteOn();
+    }
+
+    void noteOff (int midiNote) noexcept
+    {
+        const auto v = allocator.noteOff (midiNote);
+        if (v < 0)
+            return;
+
+        ampEnv[(size_t) v].noteOff();
+        filterEnv[(size_t) v].noteOff();
+    }
+
+    void allNotesOff() noexcept
+    {
+        for (int v = 0; v < maxVoices; ++v)
+        {
+            if (! allocator.isHeld (v))
+                continue;
+
+            allocator.noteOff (allocator.noteOf (v));
+            ampEnv[(size_t) v].noteOff();
+            filterEnv[(size_t) v].noteOff();
+        }
+    }
+
+    // Sums all active voices into out[0..n).
+    void render (const BlockInputs& in, float* out, int n) noexcept
+    {
+        n = juce::jmin (n, maxFrames);
+        std::fill (out, out + juce::jmax (0, n), 0.0f);
+        std::fill (noiseAmp.begin(), noiseAmp.begin() + juce::jmax (0, n), 0.0f);
+        std::fill (noiseEnv.begin(), noiseEnv.begin() + juce::jmax (0, n), 0.0f);
+
+        for (int g = 0; g < numGroups; ++g)
+        {
+            std::array<bool, (size_t) lanes> on {};
+            bool any = false;
+            for (int l = 0; l < lanes; ++l)
+            {
+                on[(size_t) l] = allocator.isActive (g * lanes + l);
+                any = any || on[(size_t) l];
+            }
+
+            if (any)
+                renderGroup (g, on, in, out, n);
+        }
+
+        renderNoise (in, out, n);
+    }
+
+private:
+    using Vec = dsp::simd::Vec4;
+
+    void renderGroup (int g, const std::array<bool, (size_t) lanes>& on, const BlockInputs& in, float* out, int n) noexcept
+    {
+        const auto v0 = g * lanes;
+
+        // Oscillators: lane l of bank[k][g] is oscillator k of voice v0 + l.
+        for (size_t k = 0; k < (size_t) numOscs; ++k)
+        {
+            auto& bank = banks[k][(size_t) g];
+            alignas (16) float laneInc[lanes];
+            for (int l = 0; l < lanes; ++l)
+                laneInc[l] = on[(size_t) l] ? baseIncrement[(size_t) (v0 + l)] * oscRatio[k] : 0.0f;
+
+            for (int i = 0; i < n; ++i)
+            {
+                auto* inc = bank.incrementsAt (i);
+                const auto bend = in.bendRatio[i];
+                for (int l = 0; l < lanes; ++l)
+                    inc[l] = juce::jmin (0.5f, laneInc[l] * bend);
+            }
+
+            float* outs[lanes] {};
+            for (int l = 0; l < lanes; ++l)
+                outs[l] = on[(size_t) l] ? oscOut[k][(size_t) (v0 + l)].data() : nullptr;
+            bank.processBlock (outs, n);
+        }
+
+        // Envelopes.
+        for (int l = 0; l < lanes; ++l)
+        {
+            const auto v = (size_t) (v0 + l);
+            auto* a = ampEnvBuf[(size_t) l].data();
+            auto* f = filterEnvBuf[(size_t) l].data();
+            if (! on[(size_t) l])
+            {
+                std::fill (a, a + n, 0.0f);
+                std::fill (f, f + n, 0.0f);
+                continue;
+            }
+
+            for (int i = 0; i < n; ++i)
+            {
+                a[i] = ampEnv[v].getNextSample();
+                f[i] = filterEnv[v].getNextSample();
+            }
+        }
+
+        // Filter (TPT SVF, four voices per vector) and amp.
+        const auto maxCutoff = sampleRate * 0.45f;
+        const bool bandPass = in.filterType == params::filter::bp;
+
+        auto s1 = Vec::load (svfS1.data() + v0);
+        auto s2 = Vec::load (svfS2.data() + v0);
+
+        for (int i = 0; i < n; ++i)
+        {
+            alignas (16) float x[lanes], gc[lanes], r2[lanes], h[lanes], amp[lanes];
+
+            const auto r = 1.0f / juce::jmax (0.05f, in.resonance[i]);
+            for (int l = 0; l < lanes; ++l)
+            {
+                const auto v = (size_t) (v0 + l);
+                if (! on[(size_t) l])
+                {
+                    x[l] = 0.0f; gc[l] = 0.0f; r2[l] = 0.0f; h[l] = 1.0f; amp[l] = 0.0f;
+                    continue;
+                }
+
+                x[l] = oscOut[0][v][(size_t) i] * in.oscLevel[0][i]
+                     + oscOut[1][v][(size_t) i] * in.oscLevel[1][i]
+                     + oscOut[2][v][(size_t) i] * in.oscLevel[2][i];
+
+                auto cutoff = in.cutoffHz[i] * ies::math::fastExp2 (in.envSemis[i] * filterEnvBuf[(size_t) l][(size_t) i] * (1.0f / 12.0f));
+                if (in.keyTrack)
+                    cutoff *= noteHz[v] * in.bendRatio[i] * (1.0f / 440.0f); // the bent note, as in Mono
+
+                const auto fc = juce::jlimit (20.0f, maxCutoff, cutoff);
+                gc[l] = ies::math::fastTanPi (fc / sampleRate);
+                r2[l] = r;
+                h[l] = 1.0f / (1.0f + r * gc[l] + gc[l] * gc[l]);
+                amp[l] = ampEnvBuf[(size_t) l][(size_t) i] * velocity[v];
+
+                // Loudest voice so far drives the noise path.
+                if (amp[l] > noiseAmp[(size_t) i])
+                {
+                    noiseAmp[(size_t) i] = amp[l];
+                    noiseEnv[(size_t) i] = filterEnvBuf[(size_t) l][(size_t) i];
+                    noiseNoteHz[(size_t) i] = noteHz[v];
+                }
+            }
+
+            const auto vg = Vec::load (gc);
+            const auto yHP = Vec::mul (Vec::load (h), Vec::sub (Vec::sub (Vec::load (x), Vec::mul (s1, Vec::add (vg, Vec::load (r2)))), s2));
+            const auto yBP = Vec::add (Vec::mul (yHP, vg), s1);
+            s1 = Vec::add (Vec::mul (yHP, vg), yBP);
+            const auto yLP = Vec::add (Vec::mul (yBP, vg), s2);
+            s2 = Vec::add (Vec::mul (yBP, vg), yLP);
+
+            alignas (16) float y[lanes];
+            Vec::store (y, Vec::mul (bandPass ? yBP : yLP, Vec::load (amp)));
+            out[i] += (y[0] + y[1]) + (y[2] + y[3]);
+        }
+
+        Vec::store (svfS1.data() + v0, s1);
+        Vec::store (svfS2.data() + v0, s2);
+
+        // Voices whose amp envelope finished are returned to the pool.
+        for (int l = 0; l < lanes; ++l)
+        {
+            const auto v = v0 + l;
+            if (! on[(size_t) l])
+                continue;
+
+            allocator.setLevel (v, ampEnvBuf[(size_t) l][(size_t) (n - 1)]);
+            if (! ampEnv[(size_t) v].isActive())
+            {
+                allocator.markFree (v);
+                filterEnv[(size_t) v].reset();
+            }
+        }
+    }
+
+    // The shared noise helper: one filter, gated by the loudest voice's amp envelope and swept by its filter
+    // envelope (and note, with key track).
+    void renderNoise (const BlockInputs& in, float* out, int n) noexcept
+    {
+        if (in.noise == nullptr)
+            return;
+
+        noiseFilter.setType (in.filterType);
+        for (int i = 0; i < n; ++i)
+        {
+            const auto amp = noiseAmp[(size_t) i];
+            if (amp <= 0.0f)
+                continue;
+
+            auto cutoff = in.cutoffHz[i] * ies::math::fastExp2 (in.envSemis[i] * noiseEnv[(size_t) i] * (1.0f / 12.0f));
+            if (in.keyTrack)
+                cutoff *= noiseNoteHz[(size_t) i] * in.bendRatio[i] * (1.0f / 440.0f);
+
+            out[i] += noiseFilter.processSample (in.noise[i], cutoff, in.resonance[i]) * amp;
+        }
+    }
+
+    float sampleRate = 44100.0f;
+    int maxFrames = 1;
+
+    VoiceAllocator allocator;
+    dsp::PitchConverter pitch;
+
+    std::array<std::array<dsp::OscillatorBank, (size_t) numGroups>, (size_t) numOscs> banks;
+    std::array<std::array<std::vector<float>, (size_t) maxVoices>, (size_t) numOscs> oscOut;
+    std::array<std::vector<float>, (size_t) lanes> ampEnvBuf;
+    std::array<std::vector<float>, (size_t) lanes> filterEnvBuf;
+
+    dsp::SvfFilter noiseFilter;
+    std::vector<float> noiseAmp; // loudest voice's amp (envelope x velocity) per sample
+    std::vector<float> noiseEnv; // that voice's filter envelope
+    std::vector<float> noiseNoteHz; // and its note
+
+    std::array<juce::ADSR, (size_t) maxVoices> ampEnv;
+    std::array<juce::ADSR, (size_t) maxVoices> filterEnv;
+
+    std::array<float, (size_t) maxVoices> baseIncrement {};
+    std::array<float, (size_t) maxVoices> noteHz {};
+    std::array<float, (size_t) maxVoices> velocity {};
+    alignas (16) std::array<float, (size_t) maxVoices> svfS1 {};
+    alignas (16) std::array<float, (size_t) maxVoices> svfS2 {};
+
+    std::array<float, (size_t) numOscs> oscOffsetSemis { 0.0f, 0.0f, 0.0f };
+    std::array<float, (size_t) numOscs> oscRatio { 1.0f, 1.0f, 1.0f };
+    std::array<float, (size_t) numOscs> startPhase {};
+};
+} // namespace ies::engine
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <JuceHeader.h>
+
+#include <algorithm>
+#include <array>
+
+#include "../dsp/WavetableSet.h"
+#include "TripleBuffer.h"
+
+namespace ies::engine
+{
+// Draw-mode tables, written by the builder thread and acquired by the audio thread.
+using WavetableTripleBuffer = TripleBuffer<dsp::WavetableSet>;
+
+// Builds the custom "Draw" wavetables off the message thread. Requests only copy the points and wake the thread,
+// so a fast mouse drag costs nothing on the UI side; requests that arrive while a build runs are coalesced to the
+// latest points per oscillator.
+class WavetableBuilder final : private juce::Thread
+{
+public:
+    static constexpr int numOscs = 3;
+    static constexpr int maxPoints = 128;
+
+    WavetableBuilder() : juce::Thread ("IES wavetable builder") {}
+    ~WavetableBuilder() override { stop(); }
+
+    void start() { startThread(); }
+    void stop() { stopThread (1000); }
+
+    WavetableTripleBuffer& getTables (int oscIndex) noexcept
+    {
+        return tables[(size_t) juce::jlimit (0, numOscs - 1, oscIndex)];
+    }
+
+    // Any non-audio thread.
+    void request (int oscIndex, const float* points, int numPoints)
+    {
+        if (oscIndex < 0 || oscIndex >= numOscs || points == nullptr)
+            return;
+
+        {
+            const juce::SpinLock::ScopedLockType sl (pendingLock);
+            auto& p = pending[(size_t) oscIndex];
+            p.numPoints = juce::jlimit (2, maxPoints, numPoints);
+            std::copy (points, points + p.numPoints, p.points.begin());
+            p.dirty = true;
+        }
+
+        notify();
+    }
+
+    // Builds whatever is pending on the calling thread (e.g. right after a state load, so the tables are ready
+    // before the next block).
+    void flush() { buildPending(); }
+
+private:
+    struct Pending
+    {
+        std::array<float, (size_t) maxPoints> points {};
+        int numPoints = 0;
+        bool dirty = false;
+    };
+
+    void run() override
+    {
+        while (! threadShouldExit())
+        {
+            wait (-1);
+            buildPending();
+        }
+    }
+
+    void buildPending()
+    {
+        // One writer at a time per triple buffer.
+        const juce::ScopedLock sl (buildLock);
+
+        for (int o = 0; o < numOscs; ++o)
+        {
+            Pending job;
+            {
+                const juce::SpinLock::ScopedLockType psl (pendingLock);
+                job = pending[(size_t) o];
+                pending[(size_t) o].dirty = false;
+            }
+
+            if (! job.dirty)
+                continue;
+
+            auto& slots = tables[(size_t) o];
+            dsp::pointsToWavetable (slots.getWriteSlot(), job.points.data(), job.numPoints);
+            slots.publish();
+        }
+    }
+
+    std::array<WavetableTripleBuffer, (size_t) numOscs> tables;
+    std::array<Pending, (size_t) numOscs> pending {};
+    juce::SpinLock pendingLock;
+    juce::CriticalSection buildLock;
+};
+} // namespace ies::engine
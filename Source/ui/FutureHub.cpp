@@ -169,7 +169,7 @@ static juce::StringArray makeModSourceNames()
 {
     return juce::StringArray { "Off", "LFO 1", "LFO 2", "Macro 1", "Macro 2", "Mod Wheel",
                                "Aftertouch", "Velocity", "Note", "Filter Env", "Amp Env",
-                               "Random", "MSEG" };
+                               "Random", "MSEG", "Drift" };
 }
 
 static juce::StringArray makeModDestinationNames()
@@ -1286,11 +1286,11 @@ private:
             return;
 
         const auto i = (size_t) slotIndex;
-        const int clampedSrc = juce::jlimit ((int) params::mod::srcOff, (int) params::mod::srcMseg, src);
+        const int clampedSrc = juce::jlimit ((int) params::mod::srcOff, (int) params::mod::srcLast, src);
         const int clampedDst = juce::jlimit ((int) params::mod::dstOff, (int) params::mod::dstLast, dst);
         const float clampedDepth = juce::jlimit (-1.0f, 1.0f, depth);
 
-        setParamChoiceIndex (context, kModSlotSrcIds[i], clampedSrc, (int) params::mod::srcMseg);
+        setParamChoiceIndex (context, kModSlotSrcIds[i], clampedSrc, (int) params::mod::srcLast);
         setParamChoiceIndex (context, kModSlotDstIds[i], clampedDst, (int) params::mod::dstLast);
         setParamActual (context, kModSlotDepthIds[i], clampedDepth);
     }
@@ -1302,7 +1302,7 @@ private:
         {
             const auto idx = (size_t) i;
             const int src = juce::jlimit ((int) params::mod::srcOff,
-                                          (int) params::mod::srcMseg,
+                                          (int) params::mod::srcLast,
                                           (int) std::lround (getParamActual (context, kModSlotSrcIds[idx], 0.0f)));
             const int dst = juce::jlimit ((int) params::mod::dstOff,
                                           (int) params::mod::dstLast,
@@ -1326,7 +1326,7 @@ private:
                 setParamChoiceIndex (context,
                                      kModSlotSrcIds[idx],
                                      srcSlots[idx].getCombo().getSelectedItemIndex(),
-                                     (int) params::mod::srcMseg);
+                                     (int) params::mod::srcLast);
             };
 
             dstSlots[idx].getCombo().onChange = [this, idx]
@@ -3314,7 +3314,7 @@ private:
         if (targetSlot < 0)
             targetSlot = 0;
 
-        const bool okSrc = setParamChoiceIndex (context, kModSlotSrcIds[targetSlot], (int) params::mod::srcMseg, (int) params::mod::srcMseg);
+        const bool okSrc = setParamChoiceIndex (context, kModSlotSrcIds[targetSlot], (int) params::mod::srcMseg, (int) params::mod::srcLast);
         const bool okDst = setParamChoiceIndex (context, kModSlotDstIds[targetSlot], dst, (int) params::mod::dstLast);
         const bool okDepth = setParamActual (context, kModSlotDepthIds[targetSlot], (float) routeDepth.getSlider().getValue());
         if (okSrc && okDst && okDepth)
@@ -3343,7 +3343,7 @@ private:
             if (src != (int) params::mod::srcMseg)
                 continue;
 
-            if (setParamChoiceIndex (context, kModSlotSrcIds[i], (int) params::mod::srcOff, (int) params::mod::srcMseg) &&
+            if (setParamChoiceIndex (context, kModSlotSrcIds[i], (int) params::mod::srcOff, (int) params::mod::srcLast) &&
                 setParamChoiceIndex (context, kModSlotDstIds[i], (int) params::mod::dstOff, (int) params::mod::dstLast) &&
                 setParamActual (context, kModSlotDepthIds[i], 0.0f))
             {
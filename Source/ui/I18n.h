@@ -35,6 +35,13 @@ enum class Key
     envModeLegato,
     glideEnable,
     glideTime,
+    voiceMode,
+    voiceModeMono,
+    voiceModePoly,
+    polyVoices,
+    wtInterp,
+    wtInterpLinear,
+    wtInterpCubic,
 
     osc1,
     osc2,
@@ -60,6 +67,10 @@ enum class Key
     phase,
     detune,
     sync,
+    unison,
+    unisonDetune,
+    unisonSpread,
+    unisonBlend,
 
     noise,
     noiseEnable,
@@ -75,6 +86,12 @@ enum class Key
     oversampleOff,
     oversample2x,
     oversample4x,
+    oversampleAuto,
+    foldAntiAlias,
+    clipAntiAlias,
+    antiAliasOff,
+    antiAliasAdaa1,
+    antiAliasAdaa2,
     foldDrive,
     foldAmount,
     foldMix,
@@ -105,6 +122,7 @@ enum class Key
     shaperPlacementPost,
     shaperDrive,
     shaperMix,
+    shaperAntiAlias,
 
     filter,
     filterEnv,
@@ -124,6 +142,9 @@ enum class Key
 
     tone,
     toneEnable,
+    tonePhaseMode,
+    tonePhaseMinimum,
+    tonePhaseLinear,
     toneAnalyzerSource,
     toneAnalyzerPre,
     toneAnalyzerPost,
@@ -165,6 +186,7 @@ enum class Key
     modSrcFilterEnv,
     modSrcAmpEnv,
     modSrcRandom,
+    modSrcDrift,
     modDstOsc1Level,
     modDstOsc2Level,
     modDstOsc3Level,
@@ -253,6 +275,13 @@ inline juce::String tr (Key key, int languageChoiceIndex)
             case Key::envModeLegato:    return u8 (u8"Легато");
             case Key::glideEnable:  return u8 (u8"Глайд");
             case Key::glideTime:    return u8 (u8"Время глайда");
+            case Key::voiceMode:     return u8 (u8"Голоса");
+            case Key::voiceModeMono: return u8 (u8"Моно");
+            case Key::voiceModePoly: return u8 (u8"Поли");
+            case Key::polyVoices:    return u8 (u8"Полифония");
+            case Key::wtInterp:       return u8 (u8"Интерп. WT");
+            case Key::wtInterpLinear: return u8 (u8"Линейная");
+            case Key::wtInterpCubic:  return u8 (u8"Кубическая");
 
             case Key::osc1:         return u8 (u8"Осц 1");
             case Key::osc2:         return u8 (u8"Осц 2");
@@ -278,6 +307,10 @@ inline juce::String tr (Key key, int languageChoiceIndex)
             case Key::phase:        return u8 (u8"Фаза");
             case Key::detune:       return u8 (u8"Детюн (нестаб.)");
             case Key::sync:         return u8 (u8"Синхр. с Осц1");
+            case Key::unison:       return u8 (u8"Унисон");
+            case Key::unisonDetune: return u8 (u8"Детюн унисона");
+            case Key::unisonSpread: return u8 (u8"Разброс фаз");
+            case Key::unisonBlend:  return u8 (u8"Бленд унисона");
 
             case Key::noise:        return u8 (u8"Шум");
             case Key::noiseEnable:  return u8 (u8"Вкл");
@@ -293,6 +326,12 @@ inline juce::String tr (Key key, int languageChoiceIndex)
             case Key::oversampleOff: return u8 (u8"Выкл");
             case Key::oversample2x:  return u8 (u8"2x");
             case Key::oversample4x:  return u8 (u8"4x");
+            case Key::oversampleAuto: return u8 (u8"Авто");
+            case Key::foldAntiAlias:  return u8 (u8"AA (fold)");
+            case Key::clipAntiAlias:  return u8 (u8"AA (clip)");
+            case Key::antiAliasOff:   return u8 (u8"Выкл");
+            case Key::antiAliasAdaa1: return u8 (u8"ADAA 1");
+            case Key::antiAliasAdaa2: return u8 (u8"ADAA 2");
             case Key::foldDrive:    return u8 (u8"Драйв (fold)");
             case Key::foldAmount:   return u8 (u8"Amount (fold)");
             case Key::foldMix:      return u8 (u8"Mix (fold)");
@@ -323,6 +362,7 @@ inline juce::String tr (Key key, int languageChoiceIndex)
             case Key::shaperPlacementPost: return u8 (u8"После Destroy");
             case Key::shaperDrive:  return u8 (u8"Драйв (shaper)");
             case Key::shaperMix:    return u8 (u8"Mix (shaper)");
+            case Key::shaperAntiAlias: return u8 (u8"AA (shaper)");
 
             case Key::filter:       return u8 (u8"Фильтр");
             case Key::filterEnv:    return u8 (u8"Огиб. фильтра");
@@ -342,6 +382,9 @@ inline juce::String tr (Key key, int languageChoiceIndex)
 
             case Key::tone:         return u8 (u8"Тон EQ");
             case Key::toneEnable:   return u8 (u8"Вкл");
+            case Key::tonePhaseMode:    return u8 (u8"Фаза EQ");
+            case Key::tonePhaseMinimum: return u8 (u8"Минимальная");
+            case Key::tonePhaseLinear:  return u8 (u8"Линейная");
             case Key::toneAnalyzerSource: return u8 (u8"Анализатор");
             case Key::toneAnalyzerPre: return u8 (u8"PRE");
             case Key::toneAnalyzerPost: return u8 (u8"POST");
@@ -383,6 +426,7 @@ inline juce::String tr (Key key, int languageChoiceIndex)
             case Key::modSrcFilterEnv: return u8 (u8"Filter Env");
             case Key::modSrcAmpEnv: return u8 (u8"Amp Env");
             case Key::modSrcRandom: return u8 (u8"Random");
+            case Key::modSrcDrift: return u8 (u8"Дрейф");
             case Key::modDstOsc1Level:     return u8 (u8"Осц1 уровень");
             case Key::modDstOsc2Level:     return u8 (u8"Осц2 уровень");
             case Key::modDstOsc3Level:     return u8 (u8"Осц3 уровень");
@@ -466,6 +510,13 @@ inline juce::String tr (Key key, int languageChoiceIndex)
             case Key::envModeLegato:    return "Legato";
             case Key::glideEnable:  return "Glide";
             case Key::glideTime:    return "Glide Time";
+            case Key::voiceMode:     return "Voice Mode";
+            case Key::voiceModeMono: return "Mono";
+            case Key::voiceModePoly: return "Poly";
+            case Key::polyVoices:    return "Poly Voices";
+            case Key::wtInterp:       return "WT Interp";
+            case Key::wtInterpLinear: return "Linear";
+            case Key::wtInterpCubic:  return "Cubic";
 
             case Key::osc1:         return "Osc 1";
             case Key::osc2:         return "Osc 2";
@@ -491,6 +542,10 @@ inline juce::String tr (Key key, int languageChoiceIndex)
             case Key::phase:        return "Phase";
             case Key::detune:       return "Detune (unstable)";
             case Key::sync:         return "Sync to Osc1";
+            case Key::unison:       return "Unison";
+            case Key::unisonDetune: return "Uni Detune";
+            case Key::unisonSpread: return "Uni Spread";
+            case Key::unisonBlend:  return "Uni Blend";
 
             case Key::noise:        return "Noise";
             case Key::noiseEnable:  return "Enable";
@@ -506,6 +561,12 @@ inline juce::String tr (Key key, int languageChoiceIndex)
             case Key::oversampleOff: return "Off";
             case Key::oversample2x:  return "2x";
             case Key::oversample4x:  return "4x";
+            case Key::oversampleAuto: return "Auto";
+            case Key::foldAntiAlias:  return "Fold AA";
+            case Key::clipAntiAlias:  return "Clip AA";
+            case Key::antiAliasOff:   return "Off";
+            case Key::antiAliasAdaa1: return "ADAA 1";
+            case Key::antiAliasAdaa2: return "ADAA 2";
             case Key::foldDrive:    return "Fold Drive";
             case Key::foldAmount:   return "Fold Amount";
             case Key::foldMix:      return "Fold Mix";
@@ -536,6 +597,7 @@ inline juce::String tr (Key key, int languageChoiceIndex)
             case Key::shaperPlacementPost: return "Post Destroy";
             case Key::shaperDrive:  return "Shaper Drive";
             case Key::shaperMix:    return "Shaper Mix";
+            case Key::shaperAntiAlias: return "Shaper AA";
 
             case Key::filter:       return "Filter";
             case Key::filterEnv:    return "Filter Env";
@@ -555,6 +617,9 @@ inline juce::String tr (Key key, int languageChoiceIndex)
 
             case Key::tone:         return "Tone EQ";
             case Key::toneEnable:   return "Enable";
+            case Key::tonePhaseMode:    return "EQ Phase";
+            case Key::tonePhaseMinimum: return "Minimum";
+            case Key::tonePhaseLinear:  return "Linear";
             case Key::toneAnalyzerSource: return "Analyzer";
             case Key::toneAnalyzerPre: return "PRE";
             case Key::toneAnalyzerPost: return "POST";
@@ -596,6 +661,7 @@ inline juce::String tr (Key key, int languageChoiceIndex)
             case Key::modSrcFilterEnv: return "Filter Env";
             case Key::modSrcAmpEnv: return "Amp Env";
             case Key::modSrcRandom: return "Random";
+            case Key::modSrcDrift: return "Drift";
             case Key::modDstOsc1Level:     return "Osc1 Level";
             case Key::modDstOsc2Level:     return "Osc2 Level";
             case Key::modDstOsc3Level:     return "Osc3 Level";
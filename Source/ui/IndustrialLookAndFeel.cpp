@@ -346,8 +346,8 @@ void IndustrialLookAndFeel::drawRotarySlider (juce::Graphics& g,
     // Modulation rings (outer arcs, one per source) - Serum-like visual feedback.
     {
         const auto countVar = slider.getProperties().getWithDefault ("modArcCount", 0);
-        // Up to 11 sources currently (LFO1/LFO2/M1/M2/MW/AT/VEL/NOTE/FENV/AENV/RAND).
-        const int count = countVar.isInt() ? juce::jlimit (0, 12, (int) countVar) : 0;
+        // Up to 13 sources currently (LFO1/LFO2/M1/M2/MW/AT/VEL/NOTE/FENV/AENV/RAND/MSEG/DRIFT).
+        const int count = countVar.isInt() ? juce::jlimit (0, 13, (int) countVar) : 0;
         if (count > 0)
         {
             const auto range = (rotaryEndAngle - rotaryStartAngle);
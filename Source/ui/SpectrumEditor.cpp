@@ -559,6 +559,18 @@ void SpectrumEditor::paint (juce::Graphics& g)
         return accent;
     };
 
+    const ies::dsp::ToneEQ::BandParams responseBands[] =
+    {
+        { p1on, p1t, p1f, p1g, p1q },
+        { p2on, p2t, p2f, p2g, p2q },
+        { p3on, p3t, p3f, p3g, p3q },
+        { p4on, p4t, p4f, p4g, p4q },
+        { p5on, p5t, p5f, p5g, p5q },
+        { p6on, p6t, p6f, p6g, p6q },
+        { p7on, p7t, p7f, p7g, p7q },
+        { p8on, p8t, p8f, p8g, p8q },
+    };
+
     {
         juce::Path p;
         const int steps = juce::jmax (64, (int) plot.getWidth());
@@ -570,14 +582,7 @@ void SpectrumEditor::paint (juce::Graphics& g)
             float respDb = 0.0f;
             ies::dsp::ToneEQ::makeResponse (sr,
                                             lowCutHz, highCutHz, lowCutSlope, highCutSlope,
-                                            p1on, p1t, p1f, p1g, p1q,
-                                            p2on, p2t, p2f, p2g, p2q,
-                                            p3on, p3t, p3f, p3g, p3q,
-                                            p4on, p4t, p4f, p4g, p4q,
-                                            p5on, p5t, p5f, p5g, p5q,
-                                            p6on, p6t, p6f, p6g, p6q,
-                                            p7on, p7t, p7f, p7g, p7q,
-                                            p8on, p8t, p8f, p8g, p8q,
+                                            responseBands, (int) std::size (responseBands),
                                             f, respDb);
 
             const auto x = plot.getX() + t * plot.getWidth();
@@ -0,0 +1,108 @@
+#include <cassert>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "../Source/dsp/FdnReverb.h"
+
+using ies::dsp::FdnReverb;
+
+static constexpr double sampleRate = 48000.0;
+static constexpr int blockSize = 480;   // 10 ms
+static constexpr int blocksPerSecond = 100;
+
+static FdnReverb::Settings longest(int quality)
+{
+    FdnReverb::Settings s;
+    s.quality = quality;
+    s.size01 = 1.0f;
+    s.decay01 = 1.0f;
+    s.damp01 = 0.0f;
+    s.highCutHz = 20000.0f;
+    return s;
+}
+
+// Energy per second of the response to `input` (called per block, fills l/r), over `seconds`.
+template <typename Input>
+static std::vector<double> energyPerSecond(FdnReverb& r, int seconds, Input input)
+{
+    std::vector<float> l(blockSize), rr(blockSize);
+    std::vector<double> energy((size_t) seconds, 0.0);
+    for (int b = 0; b < seconds * blocksPerSecond; ++b)
+    {
+        input(b, l, rr);
+        r.process(l.data(), rr.data(), blockSize);
+        for (int i = 0; i < blockSize; ++i)
+        {
+            assert(std::isfinite(l[(size_t) i]) && std::isfinite(rr[(size_t) i]));
+            assert(std::abs(l[(size_t) i]) < 1.0f && std::abs(rr[(size_t) i]) < 1.0f);
+            energy[(size_t) (b / blocksPerSecond)] += (double) l[(size_t) i] * l[(size_t) i] + (double) rr[(size_t) i] * rr[(size_t) i];
+        }
+    }
+    return energy;
+}
+
+static void impulse(int block, std::vector<float>& l, std::vector<float>& r)
+{
+    std::fill(l.begin(), l.end(), 0.0f);
+    std::fill(r.begin(), r.end(), 0.0f);
+    if (block == 0)
+        l[0] = r[0] = 1.0f;
+}
+
+// At the longest decay the tail still dies away: every second quieter than the last, and at least 60 dB down
+// well before 20 s (the longest RT60 is about 11 s).
+static void check_tail_decays(int quality)
+{
+    FdnReverb r;
+    r.prepare(sampleRate);
+    r.setSettings(longest(quality));
+
+    const auto e = energyPerSecond(r, 20, impulse);
+    for (size_t s = 2; s < e.size(); ++s)
+        assert(e[s] < e[s - 1]);
+    assert(e[19] < 1.0e-6 * e[1]);
+}
+
+static void test_hi_tail_decays()
+{
+    check_tail_decays((int) params::fx::reverb::hi);
+}
+
+static void test_eco_tail_decays()
+{
+    check_tail_decays((int) params::fx::reverb::eco);
+}
+
+// Sustained full-scale noise with size automation sweeping: the tank level settles instead of building up.
+static void test_sustained_input_stays_bounded()
+{
+    FdnReverb r;
+    r.prepare(sampleRate);
+    auto s = longest((int) params::fx::reverb::hi);
+    r.setSettings(s);
+
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<float> dist(-0.25f, 0.25f);
+    const auto e = energyPerSecond(r, 30, [&](int block, std::vector<float>& l, std::vector<float>& rr)
+    {
+        s.size01 = 0.5f + 0.5f * (float) std::sin(0.05 * block);
+        r.setSettings(s);
+        for (int i = 0; i < blockSize; ++i)
+        {
+            l[(size_t) i] = dist(rng);
+            rr[(size_t) i] = dist(rng);
+        }
+    });
+
+    for (size_t i = 20; i < e.size(); ++i)
+        assert(e[i] < 2.0 * e[10]);
+}
+
+int main()
+{
+    test_hi_tail_decays();
+    test_eco_tail_decays();
+    test_sustained_input_stays_bounded();
+    return 0;
+}
@@ -0,0 +1,126 @@
+#include <cassert>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "../Source/dsp/PartitionedConvolver.h"
+
+using ies::dsp::ConvolutionKernel;
+using ies::dsp::PartitionedConvolver;
+
+static constexpr int blockSize = PartitionedConvolver::blockSize;
+
+static ConvolutionKernel makeKernel(const std::vector<float>& ir)
+{
+    juce::dsp::FFT fft(PartitionedConvolver::blockOrder + 1);
+    std::vector<float> scratch;
+    ConvolutionKernel k;
+    PartitionedConvolver::makeKernel(ir.data(), (int) ir.size(), k, fft, scratch);
+    return k;
+}
+
+static std::vector<float> noise(int n)
+{
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+    std::vector<float> x((size_t) n);
+    for (auto& v : x)
+        v = dist(rng);
+    return x;
+}
+
+// Runs x through the convolver in uneven chunks, the way host blocks arrive.
+static std::vector<float> run(PartitionedConvolver& c, std::vector<float> x)
+{
+    static const int chunks[] = { 1, 37, 256, 100, 511, 64 };
+    for (int start = 0, i = 0; start < (int) x.size(); ++i)
+    {
+        const int n = juce::jmin(chunks[i % 6], (int) x.size() - start);
+        c.process(x.data() + start, n);
+        start += n;
+    }
+    return x;
+}
+
+// Direct-form reference, delayed by the convolver's block latency.
+static std::vector<float> reference(const std::vector<float>& x, const std::vector<float>& ir)
+{
+    std::vector<float> y(x.size(), 0.0f);
+    for (size_t n = (size_t) blockSize; n < x.size(); ++n)
+        for (size_t k = 0; k < ir.size() && k <= n - (size_t) blockSize; ++k)
+            y[n] += ir[k] * x[n - (size_t) blockSize - k];
+    return y;
+}
+
+static void test_unit_impulse_is_pure_delay()
+{
+    PartitionedConvolver c;
+    c.prepare(1);
+    c.setKernel(makeKernel({ 1.0f }));
+    assert(c.getLatencySamples() == blockSize);
+
+    const auto x = noise(4000);
+    const auto y = run(c, x);
+    for (int n = 0; n < (int) x.size(); ++n)
+    {
+        const float expected = n < blockSize ? 0.0f : x[(size_t) (n - blockSize)];
+        assert(std::abs(y[(size_t) n] - expected) < 1.0e-5f);
+    }
+}
+
+static void test_long_kernel_matches_direct_convolution()
+{
+    // Taps in the first, a middle and the last partition.
+    std::vector<float> ir(3 * blockSize - 5, 0.0f);
+    ir[0] = 0.5f;
+    ir[3] = -0.25f;
+    ir[(size_t) blockSize + 17] = 0.3f;
+    ir.back() = -0.2f;
+
+    PartitionedConvolver c;
+    c.prepare((int) ir.size());
+    c.setKernel(makeKernel(ir));
+
+    const auto x = noise(5000);
+    const auto y = run(c, x);
+    const auto r = reference(x, ir);
+    for (size_t n = 0; n < x.size(); ++n)
+        assert(std::abs(y[n] - r[n]) < 1.0e-4f);
+}
+
+static void test_reset_clears_history()
+{
+    PartitionedConvolver c;
+    c.prepare(1);
+    c.setKernel(makeKernel({ 1.0f }));
+    run(c, noise(1000));
+
+    c.reset();
+    const auto y = run(c, std::vector<float>(2 * blockSize, 0.0f));
+    for (auto v : y)
+        assert(v == 0.0f);
+}
+
+static void test_new_kernel_takes_over_after_a_block()
+{
+    PartitionedConvolver c;
+    c.prepare(1);
+    c.setKernel(makeKernel({ 1.0f }));
+    run(c, noise(1000));
+
+    // Gain change: once the crossfade block has played out, the output is the new kernel's.
+    c.setKernel(makeKernel({ 0.5f }));
+    const auto x = noise(6 * blockSize);
+    const auto y = run(c, x);
+    for (size_t n = (size_t) (3 * blockSize); n < x.size(); ++n)
+        assert(std::abs(y[n] - 0.5f * x[n - (size_t) blockSize]) < 1.0e-5f);
+}
+
+int main()
+{
+    test_unit_impulse_is_pure_delay();
+    test_long_kernel_matches_direct_convolution();
+    test_reset_clears_history();
+    test_new_kernel_takes_over_after_a_block();
+    return 0;
+}
@@ -0,0 +1,98 @@
+#include <cassert>
+
+#include "../Source/engine/TripleBuffer.h"
+
+using ies::engine::TripleBuffer;
+
+struct Pair
+{
+    int a = 0;
+    int b = 0;
+};
+
+static void publish(TripleBuffer<Pair>& tb, int value)
+{
+    auto& slot = tb.getWriteSlot();
+    slot.a = value;
+    slot.b = -value;
+    tb.publish();
+}
+
+static void test_null_before_first_publish()
+{
+    TripleBuffer<Pair> tb;
+    assert(tb.acquire() == nullptr);
+    assert(tb.acquire() == nullptr);
+}
+
+static void test_publish_then_acquire()
+{
+    TripleBuffer<Pair> tb;
+    publish(tb, 1);
+
+    const auto* p = tb.acquire();
+    assert(p != nullptr);
+    assert(p->a == 1 && p->b == -1);
+
+    publish(tb, 2);
+    p = tb.acquire();
+    assert(p != nullptr);
+    assert(p->a == 2 && p->b == -2);
+}
+
+static void test_nothing_new_keeps_last_value()
+{
+    TripleBuffer<Pair> tb;
+    publish(tb, 7);
+    const auto* first = tb.acquire();
+    assert(first != nullptr);
+
+    // No publish in between: same slot, same value.
+    const auto* again = tb.acquire();
+    assert(again == first);
+    assert(again->a == 7 && again->b == -7);
+}
+
+static void test_writer_never_touches_reader_slot()
+{
+    TripleBuffer<Pair> tb;
+    publish(tb, 1);
+    const auto* held = tb.acquire();
+
+    // The writer keeps going while the reader holds its slot; the held value must not change.
+    for (int i = 2; i < 10; ++i)
+    {
+        assert(&tb.getWriteSlot() != held);
+        publish(tb, i);
+        assert(held->a == 1 && held->b == -1);
+    }
+}
+
+static void test_publishes_coalesce_to_latest()
+{
+    TripleBuffer<Pair> tb;
+    publish(tb, 1);
+    publish(tb, 2);
+    publish(tb, 3);
+
+    // Several publishes between acquires: only the newest is seen.
+    const auto* p = tb.acquire();
+    assert(p != nullptr);
+    assert(p->a == 3 && p->b == -3);
+
+    publish(tb, 4);
+    publish(tb, 5);
+    p = tb.acquire();
+    assert(p->a == 5 && p->b == -5);
+    assert(tb.acquire() == p);
+}
+
+int main()
+{
+    test_null_before_first_publish();
+    test_publish_then_acquire();
+    test_nothing_new_keeps_last_value();
+    test_writer_never_touches_reader_slot();
+    test_publishes_coalesce_to_latest();
+    return 0;
+}
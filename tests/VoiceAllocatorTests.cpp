@@ -0,0 +1,93 @@
+#include <cassert>
+
+#include "../Source/engine/VoiceAllocator.h"
+
+using ies::engine::VoiceAllocator;
+
+static void test_free_voices_first()
+{
+    VoiceAllocator a;
+    a.setNumVoices(4);
+    const int v0 = a.noteOn(60);
+    const int v1 = a.noteOn(64);
+    const int v2 = a.noteOn(67);
+    assert(v0 != v1 && v1 != v2 && v0 != v2);
+    assert(a.isHeld(v0) && a.isHeld(v1) && a.isHeld(v2));
+    assert(a.noteOf(v1) == 64);
+}
+
+static void test_same_note_reuses_voice()
+{
+    VoiceAllocator a;
+    a.setNumVoices(4);
+    const int v = a.noteOn(60);
+    a.noteOff(60);
+    bool stolen = true;
+    assert(a.noteOn(60, &stolen) == v);
+    assert(!stolen);
+}
+
+static void test_steals_quietest_released_before_held()
+{
+    VoiceAllocator a;
+    a.setNumVoices(3);
+    const int v0 = a.noteOn(60);
+    const int v1 = a.noteOn(62);
+    const int v2 = a.noteOn(64);
+    a.noteOff(60);
+    a.noteOff(62);
+    a.setLevel(v0, 0.5f);
+    a.setLevel(v1, 0.1f);
+    a.setLevel(v2, 0.9f);
+
+    bool stolen = false;
+    assert(a.noteOn(65, &stolen) == v1);
+    assert(stolen);
+    assert(a.noteOf(v1) == 65);
+}
+
+static void test_steals_oldest_held()
+{
+    VoiceAllocator a;
+    a.setNumVoices(2);
+    const int v0 = a.noteOn(60);
+    a.noteOn(62);
+    assert(a.noteOn(64) == v0);
+    assert(a.noteOff(60) == -1);
+}
+
+static void test_mark_free_and_voice_count()
+{
+    VoiceAllocator a;
+    a.setNumVoices(2);
+    const int v0 = a.noteOn(60);
+    a.noteOn(62);
+    a.noteOff(60);
+    a.markFree(v0);
+    assert(!a.isActive(v0));
+    assert(a.noteOn(70) == v0);
+
+    // Shrinking the pool releases voices beyond the new size; they keep sounding until their release ends
+    // but are no longer handed out.
+    a.setNumVoices(8);
+    const int v2 = a.noteOn(72);
+    assert(v2 >= 2);
+    a.setNumVoices(2);
+    assert(a.isActive(v2));
+    assert(!a.isHeld(v2));
+    assert(a.noteOff(72) == -1);
+    const int v3 = a.noteOn(72);
+    assert(v3 < 2);
+    a.markFree(v2);
+    assert(!a.isActive(v2));
+}
+
+int main()
+{
+    test_free_voices_first();
+    test_same_note_reuses_voice();
+    test_steals_quietest_released_before_held();
+    test_steals_oldest_held();
+    test_mark_free_and_voice_count();
+    return 0;
+}